@@ -0,0 +1,171 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Benchmark comparing buildIndexSetAligned against
+/// buildIndexSetAlignedParallel on 1e6 to 1e8 indices that mix runs of
+/// consecutive indices with scattered ones, as in material index lists,
+/// and buildLockFreeColorIndexset against
+/// buildLockFreeColorIndexsetParallel on quad meshes of as many elements.
+/// The largest sizes need a few GB of memory and are only run if
+/// RAJA_BENCHMARK_MAX_LENGTH is set high enough, e.g.
+///
+///   RAJA_BENCHMARK_MAX_LENGTH=100000000 ./benchmark-indexset-build
+///
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using AlignedIndexSet =
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>;
+
+using ColorIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                          RAJA::ListSegment,
+                                          RAJA::RangeStrideSegment>;
+
+/// Runs of 1 to 2000 consecutive indices separated by small gaps, with a
+/// fraction of isolated indices in between.
+std::vector<RAJA::Index_type> materialIndices(RAJA::Index_type n)
+{
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> run_length(1, 2000);
+  std::uniform_int_distribution<int> gap(1, 16);
+  std::bernoulli_distribution isolated(0.5);
+
+  std::vector<RAJA::Index_type> indices;
+  indices.reserve(n);
+  RAJA::Index_type next = 0;
+  while (static_cast<RAJA::Index_type>(indices.size()) < n) {
+    const int len = isolated(gen) ? 1 : run_length(gen);
+    for (int i = 0; i < len; ++i) {
+      indices.push_back(next++);
+    }
+    next += gap(gen);
+  }
+  indices.resize(n);
+  return indices;
+}
+
+/// Element-to-node map of a square quad mesh of about n elements.
+std::vector<RAJA::Index_type> quadMesh(RAJA::Index_type n, int& nx)
+{
+  nx = 1;
+  while (static_cast<RAJA::Index_type>(nx + 1) * (nx + 1) <= n) {
+    ++nx;
+  }
+  std::vector<RAJA::Index_type> elem_to_node;
+  elem_to_node.reserve(4 * static_cast<size_t>(nx) * nx);
+  for (int j = 0; j < nx; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const RAJA::Index_type node = i + j * (nx + 1);
+      elem_to_node.push_back(node);
+      elem_to_node.push_back(node + 1);
+      elem_to_node.push_back(node + nx + 1);
+      elem_to_node.push_back(node + nx + 2);
+    }
+  }
+  return elem_to_node;
+}
+
+void buildLengths(benchmark::internal::Benchmark* b)
+{
+  long max_len = 10000000;
+  if (const char* env = std::getenv("RAJA_BENCHMARK_MAX_LENGTH")) {
+    max_len = std::atol(env);
+  }
+  for (long len = 1000000; len <= max_len && len <= 100000000; len *= 10) {
+    b->Arg(len);
+  }
+  b->ArgNames({"len"});
+  b->Unit(benchmark::kMillisecond);
+}
+
+}  // end anonymous namespace
+
+static void BuildAligned(benchmark::State& state)
+{
+  const std::vector<RAJA::Index_type> indices =
+      materialIndices(state.range(0));
+
+  while (state.KeepRunning()) {
+    AlignedIndexSet iset;
+    RAJA::buildIndexSetAligned(iset, indices.data(), indices.size());
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BuildAlignedParallel(benchmark::State& state)
+{
+  const std::vector<RAJA::Index_type> indices =
+      materialIndices(state.range(0));
+
+  while (state.KeepRunning()) {
+    AlignedIndexSet iset;
+    RAJA::buildIndexSetAlignedParallel(iset, indices.data(), indices.size());
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BuildColor(benchmark::State& state)
+{
+  int nx;
+  const std::vector<RAJA::Index_type> mesh = quadMesh(state.range(0), nx);
+  std::vector<RAJA::Index_type> perm(static_cast<size_t>(nx) * nx);
+
+  while (state.KeepRunning()) {
+    ColorIndexSet iset;
+    RAJA::buildLockFreeColorIndexset(
+        iset, mesh.data(), nx * nx, 4, (nx + 1) * (nx + 1), perm.data());
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+
+  state.SetItemsProcessed(state.iterations() * nx * nx);
+}
+
+static void BuildColorParallel(benchmark::State& state)
+{
+  int nx;
+  const std::vector<RAJA::Index_type> mesh = quadMesh(state.range(0), nx);
+  std::vector<RAJA::Index_type> perm(static_cast<size_t>(nx) * nx);
+
+  while (state.KeepRunning()) {
+    ColorIndexSet iset;
+    RAJA::buildLockFreeColorIndexsetParallel(
+        iset, mesh.data(), nx * nx, 4, (nx + 1) * (nx + 1), perm.data());
+    benchmark::DoNotOptimize(iset.getNumSegments());
+  }
+
+  state.SetItemsProcessed(state.iterations() * nx * nx);
+}
+
+BENCHMARK(BuildAligned)->Apply(buildLengths);
+BENCHMARK(BuildAlignedParallel)->Apply(buildLengths);
+BENCHMARK(BuildColor)->Apply(buildLengths);
+BENCHMARK(BuildColorParallel)->Apply(buildLengths);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Microbenchmark comparing MemPool and SlabMemPool on the small, short-lived
+/// allocations made by reducers. Every thread repeatedly allocates a few
+/// blocks, keeps some of them alive and frees the rest.
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <omp.h>
+
+namespace
+{
+
+void threadsAndSizes(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int bytes : {64, 1024}) {
+    for (int nt = 1; nt < max_threads; nt *= 2) {
+      b->Args({nt, bytes});
+    }
+    b->Args({max_threads, bytes});
+  }
+  b->ArgNames({"threads", "bytes"});
+}
+
+const int allocs_per_thread = 1024;
+
+//! number of blocks each thread keeps alive
+const int num_live = 32;
+
+}  // end anonymous namespace
+
+template <typename Pool>
+static void MallocFree(benchmark::State& state)
+{
+  const int num_threads = static_cast<int>(state.range(0));
+  const size_t bytes = static_cast<size_t>(state.range(1));
+  Pool& pool = Pool::getInstance();
+
+  while (state.KeepRunning()) {
+#pragma omp parallel num_threads(num_threads)
+    {
+      char* live[num_live] = {};
+      for (int i = 0; i < allocs_per_thread; ++i) {
+        char*& slot = live[(i * 7) % num_live];
+        pool.free(slot);
+        slot = pool.template malloc<char>(bytes + (i % 3) * 8);
+        benchmark::DoNotOptimize(slot);
+      }
+      for (char* ptr : live) {
+        pool.free(ptr);
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_threads
+                          * allocs_per_thread);
+  pool.free_chunks();
+}
+
+using generic_allocator = RAJA::basic_mempool::generic_allocator;
+
+BENCHMARK_TEMPLATE(MallocFree, RAJA::basic_mempool::MemPool<generic_allocator>)
+    ->Apply(threadsAndSizes);
+BENCHMARK_TEMPLATE(MallocFree,
+                   RAJA::basic_mempool::SlabMemPool<generic_allocator>)
+    ->Apply(threadsAndSizes);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,197 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Microbenchmark of the launch latency of short OpenMP loops: a fork/join
+/// per loop with omp_parallel_for_exec against launches onto the team of
+/// an omp_persistent_region. Each benchmark iteration is one loop launch.
+///
+/// The Patches benchmarks run a sequence of small boundary-patch loops,
+/// one forall each, against a single forall_batch launch.
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <omp.h>
+
+#include <vector>
+
+namespace
+{
+
+void threadsAndLengths(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int len : {0, 64, 1024, 16384}) {
+    for (int nt = 1; nt < max_threads; nt *= 2) {
+      b->Args({nt, len});
+    }
+    b->Args({max_threads, len});
+  }
+  b->ArgNames({"threads", "len"});
+}
+
+}  // end anonymous namespace
+
+static void ForkJoin(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data(len, 1.0);
+  double* a = data.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, len),
+                                              [=](int i) { a[i] += 1.0; });
+  }
+
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+static void Persistent(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data(len, 1.0);
+  double* a = data.data();
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    while (state.KeepRunning()) {
+      RAJA::forall<RAJA::omp_persistent_exec>(RAJA::RangeSegment(0, len),
+                                              [=](int i) { a[i] += 1.0; });
+    }
+  });
+
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+static void PatchesForall(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int num_patches = static_cast<int>(state.range(1));
+  const int patch_len = 200;
+  std::vector<double> data(num_patches * patch_len, 1.0);
+  double* a = data.data();
+
+  while (state.KeepRunning()) {
+    for (int p = 0; p < num_patches; ++p) {
+      RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(p * patch_len, (p + 1) * patch_len),
+          [=](int i) { a[i] += 1.0; });
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_patches * patch_len);
+}
+
+static void PatchesBatch(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int num_patches = static_cast<int>(state.range(1));
+  const int patch_len = 200;
+  std::vector<double> data(num_patches * patch_len, 1.0);
+  double* a = data.data();
+
+  RAJA::LoopBatch batch;
+  for (int p = 0; p < num_patches; ++p) {
+    batch.add(RAJA::RangeSegment(p * patch_len, (p + 1) * patch_len),
+              [=](int i) { a[i] += 1.0; });
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::forall_batch<RAJA::omp_parallel_for_exec>(batch);
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_patches * patch_len);
+}
+
+//! Five launches per step; the two pairs of independent ones share phases.
+static void StepForall(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data(3 * len, 1.0);
+  double* a = data.data();
+  double* b = a + len;
+  double* c = b + len;
+  RAJA::RangeSegment range(0, len);
+
+  while (state.KeepRunning()) {
+    using pol = RAJA::omp_parallel_for_exec;
+    RAJA::forall<pol>(range, [=](int i) { a[i] += 1.0; });
+    RAJA::forall<pol>(range, [=](int i) { b[i] += 2.0; });
+    RAJA::forall<pol>(range, [=](int i) { c[i] = a[i] + b[i]; });
+    RAJA::forall<pol>(range, [=](int i) { a[i] = 0.5 * c[i]; });
+    RAJA::forall<pol>(range, [=](int i) { b[i] = 0.25 * c[i]; });
+  }
+
+  state.SetItemsProcessed(state.iterations() * 5 * len);
+}
+
+static void StepGraph(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data(3 * len, 1.0);
+  double* a = data.data();
+  double* b = a + len;
+  double* c = b + len;
+  RAJA::RangeSegment range(0, len);
+
+  using pol = RAJA::omp_parallel_for_exec;
+  RAJA::LoopGraph graph;
+  graph.forall<pol>(range, [=](int i) { a[i] += 1.0; }).writes(a);
+  graph.forall<pol>(range, [=](int i) { b[i] += 2.0; }).writes(b);
+  graph.forall<pol>(range, [=](int i) { c[i] = a[i] + b[i]; })
+      .reads(a, b)
+      .writes(c);
+  graph.forall<pol>(range, [=](int i) { a[i] = 0.5 * c[i]; })
+      .reads(c)
+      .writes(a);
+  graph.forall<pol>(range, [=](int i) { b[i] = 0.25 * c[i]; })
+      .reads(c)
+      .writes(b);
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    while (state.KeepRunning()) {
+      graph.replay<RAJA::omp_persistent_exec>();
+    }
+  });
+
+  state.SetItemsProcessed(state.iterations() * 5 * len);
+}
+
+void threadsAndPatches(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int patches : {16, 256}) {
+    for (int nt = 1; nt < max_threads; nt *= 2) {
+      b->Args({nt, patches});
+    }
+    b->Args({max_threads, patches});
+  }
+  b->ArgNames({"threads", "patches"});
+}
+
+BENCHMARK(ForkJoin)->Apply(threadsAndLengths)->UseRealTime();
+BENCHMARK(Persistent)->Apply(threadsAndLengths)->UseRealTime();
+BENCHMARK(StepForall)->Apply(threadsAndLengths)->UseRealTime();
+BENCHMARK(StepGraph)->Apply(threadsAndLengths)->UseRealTime();
+BENCHMARK(PatchesForall)->Apply(threadsAndPatches)->UseRealTime();
+BENCHMARK(PatchesBatch)->Apply(threadsAndPatches)->UseRealTime();
+
+BENCHMARK_MAIN();
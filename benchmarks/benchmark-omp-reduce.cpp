@@ -0,0 +1,185 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Microbenchmark comparing the OpenMP reduction policies on short loops
+/// as the number of threads grows. Each benchmark is run for thread counts
+/// 1, 2, 4, ... up to omp_get_max_threads() and for several loop lengths.
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <omp.h>
+
+#include <vector>
+
+namespace
+{
+
+void threadsAndLengths(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int len : {256, 4096, 65536}) {
+    for (int nt = 1; nt < max_threads; nt *= 2) {
+      b->Args({nt, len});
+    }
+    b->Args({max_threads, len});
+  }
+  b->ArgNames({"threads", "len"});
+}
+
+std::vector<double> makeData(int len)
+{
+  std::vector<double> data(len);
+  for (int i = 0; i < len; ++i) {
+    data[i] = static_cast<double>((i * 7919) % 1021) - 510.0;
+  }
+  return data;
+}
+
+}  // end anonymous namespace
+
+template <typename ReducePolicy>
+static void ReduceSum(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data = makeData(len);
+  const double* a = data.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, len),
+                                              [=](int i) { sum += a[i]; });
+
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+/// Sum that is bitwise identical for any number of threads.
+static void ReduceSumReproducible(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data = makeData(len);
+  const double* a = data.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<RAJA::omp_reduce_reproducible, double> sum(0.0);
+
+    RAJA::forall<RAJA::omp_parallel_for_reproducible<1024>>(
+        RAJA::RangeSegment(0, len), [=](int i) { sum += a[i]; });
+
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+/// All five reducers in one loop; omp_reduce enters its critical section
+/// once per reducer per thread.
+template <typename ReducePolicy>
+static void ReduceAll(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data = makeData(len);
+  const double* a = data.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+    RAJA::ReduceMin<ReducePolicy, double> min(1.0e10);
+    RAJA::ReduceMax<ReducePolicy, double> max(-1.0e10);
+    RAJA::ReduceMinLoc<ReducePolicy, double> minloc(1.0e10, -1);
+    RAJA::ReduceMaxLoc<ReducePolicy, double> maxloc(-1.0e10, -1);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, len),
+                                              [=](int i) {
+                                                sum += a[i];
+                                                min.min(a[i]);
+                                                max.max(a[i]);
+                                                minloc.minloc(a[i], i);
+                                                maxloc.maxloc(a[i], i);
+                                              });
+
+    benchmark::DoNotOptimize(sum.get());
+    benchmark::DoNotOptimize(min.get());
+    benchmark::DoNotOptimize(max.get());
+    benchmark::DoNotOptimize(minloc.getLoc());
+    benchmark::DoNotOptimize(maxloc.getLoc());
+  }
+
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+/// The same five reductions held by one ReduceTuple, combined once per
+/// thread.
+template <typename ReducePolicy>
+static void ReduceAllTuple(benchmark::State& state)
+{
+  omp_set_num_threads(static_cast<int>(state.range(0)));
+  const int len = static_cast<int>(state.range(1));
+  std::vector<double> data = makeData(len);
+  const double* a = data.data();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceTuple<ReducePolicy,
+                      RAJA::reduce::sum<double>,
+                      RAJA::reduce::min<double>,
+                      RAJA::reduce::max<double>,
+                      RAJA::reduce::minloc<double>,
+                      RAJA::reduce::maxloc<double>>
+        vals(0.0, 1.0e10, -1.0e10, 1.0e10, -1.0e10);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, len),
+                                              [=](int i) {
+                                                vals.template combine<0>(a[i]);
+                                                vals.template combine<1>(a[i]);
+                                                vals.template combine<2>(a[i]);
+                                                vals.template combine<3>(a[i],
+                                                                         i);
+                                                vals.template combine<4>(a[i],
+                                                                         i);
+                                              });
+
+    benchmark::DoNotOptimize(vals.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * len);
+}
+
+BENCHMARK_TEMPLATE(ReduceSum, RAJA::omp_reduce)->Apply(threadsAndLengths);
+BENCHMARK_TEMPLATE(ReduceSum, RAJA::omp_reduce_ordered)
+    ->Apply(threadsAndLengths);
+BENCHMARK_TEMPLATE(ReduceSum, RAJA::omp_reduce_slots)
+    ->Apply(threadsAndLengths);
+BENCHMARK(ReduceSumReproducible)->Apply(threadsAndLengths);
+
+BENCHMARK_TEMPLATE(ReduceAll, RAJA::omp_reduce)->Apply(threadsAndLengths);
+BENCHMARK_TEMPLATE(ReduceAll, RAJA::omp_reduce_ordered)
+    ->Apply(threadsAndLengths);
+BENCHMARK_TEMPLATE(ReduceAll, RAJA::omp_reduce_slots)
+    ->Apply(threadsAndLengths);
+
+BENCHMARK_TEMPLATE(ReduceAllTuple, RAJA::omp_reduce)->Apply(threadsAndLengths);
+BENCHMARK_TEMPLATE(ReduceAllTuple, RAJA::omp_reduce_slots)
+    ->Apply(threadsAndLengths);
+
+BENCHMARK_MAIN();
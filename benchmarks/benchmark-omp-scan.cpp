@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Benchmark comparing the single-pass OpenMP scan against the previous
+/// two-pass implementation (kept below for reference) on 1e6 to 1e9
+/// elements. Sizes above 1e8 need several GB of memory and are only run
+/// if RAJA_BENCHMARK_MAX_LENGTH is set high enough, e.g.
+///
+///   RAJA_BENCHMARK_MAX_LENGTH=1000000000 ./benchmark-omp-scan
+///
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+/// The two-pass scan RAJA used before the tiled look-back scan: every
+/// thread scans its block, one thread scans the block sums, then every
+/// thread sweeps its block again to add its offset.
+template <typename Iter, typename BinFn>
+void twoPassInclusiveInplace(Iter begin, Iter end, BinFn f)
+{
+  using Value = typename std::iterator_traits<Iter>::value_type;
+  const RAJA::Index_type n = end - begin;
+  const int p0 = static_cast<int>(
+      std::min<RAJA::Index_type>(n, omp_get_max_threads()));
+  std::vector<Value> sums(p0, Value());
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const RAJA::Index_type i0 = static_cast<size_t>(n) * pid / p;
+    const RAJA::Index_type i1 = static_cast<size_t>(n) * (pid + 1) / p;
+    for (RAJA::Index_type i = i0 + 1; i < i1; ++i) {
+      *(begin + i) = f(*(begin + i - 1), *(begin + i));
+    }
+    sums[pid] = *(begin + i1 - 1);
+#pragma omp barrier
+#pragma omp single
+    {
+      Value run = BinFn::identity();
+      for (int k = 0; k < p; ++k) {
+        Value s = sums[k];
+        sums[k] = run;
+        run = f(run, s);
+      }
+    }
+    const Value offset = sums[pid];
+    for (RAJA::Index_type i = i0; i < i1; ++i) {
+      *(begin + i) = f(offset, *(begin + i));
+    }
+  }
+}
+
+void scanLengths(benchmark::internal::Benchmark* b)
+{
+  long max_len = 100000000;
+  if (const char* env = std::getenv("RAJA_BENCHMARK_MAX_LENGTH")) {
+    max_len = std::atol(env);
+  }
+  for (long len = 1000000; len <= max_len && len <= 1000000000; len *= 10) {
+    b->Arg(len);
+  }
+  b->ArgNames({"len"});
+  b->Unit(benchmark::kMillisecond);
+}
+
+}  // end anonymous namespace
+
+static void ScanTwoPass(benchmark::State& state)
+{
+  const long len = state.range(0);
+  std::vector<double> data(len, 1.0);
+
+  while (state.KeepRunning()) {
+    twoPassInclusiveInplace(data.begin(),
+                            data.end(),
+                            RAJA::operators::plus<double>{});
+    benchmark::DoNotOptimize(data.back());
+  }
+
+  state.SetBytesProcessed(state.iterations() * len * sizeof(double));
+}
+
+static void ScanInclusiveInplace(benchmark::State& state)
+{
+  const long len = state.range(0);
+  std::vector<double> data(len, 1.0);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan_inplace<RAJA::omp_parallel_for_exec>(data.begin(),
+                                                              data.end());
+    benchmark::DoNotOptimize(data.back());
+  }
+
+  state.SetBytesProcessed(state.iterations() * len * sizeof(double));
+}
+
+static void ScanInclusive(benchmark::State& state)
+{
+  const long len = state.range(0);
+  std::vector<double> in(len, 1.0);
+  std::vector<double> out(len);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<RAJA::omp_parallel_for_exec>(in.begin(),
+                                                      in.end(),
+                                                      out.begin());
+    benchmark::DoNotOptimize(out.back());
+  }
+
+  state.SetBytesProcessed(state.iterations() * len * sizeof(double));
+}
+
+static void ScanExclusive(benchmark::State& state)
+{
+  const long len = state.range(0);
+  std::vector<double> in(len, 1.0);
+  std::vector<double> out(len);
+
+  while (state.KeepRunning()) {
+    RAJA::exclusive_scan<RAJA::omp_parallel_for_exec>(in.begin(),
+                                                      in.end(),
+                                                      out.begin());
+    benchmark::DoNotOptimize(out.back());
+  }
+
+  state.SetBytesProcessed(state.iterations() * len * sizeof(double));
+}
+
+BENCHMARK(ScanTwoPass)->Apply(scanLengths);
+BENCHMARK(ScanInclusiveInplace)->Apply(scanLengths);
+BENCHMARK(ScanInclusive)->Apply(scanLengths);
+BENCHMARK(ScanExclusive)->Apply(scanLengths);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Scatter-add assembly of element values into shared nodes through an
+/// atomic view, with one atomic per update on the nodes themselves
+/// (AssemblyAtomic) and with updates spread over replicas of the nodes
+/// that are flushed after the loop (AssemblyReplicated). Every element
+/// adds to 4 of only 256 nodes, so updates collide heavily.
+///
+
+#include "suite.hpp"
+
+#include <random>
+
+namespace
+{
+
+const int num_nodes = 256;
+const int nodes_per_elem = 4;
+
+template <typename Backend>
+std::unique_ptr<int[]> makeConnectivity(RAJA::Index_type num_elems)
+{
+  auto conn = suite::makeArray<Backend>(num_elems * nodes_per_elem, 0);
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> dist(0, num_nodes - 1);
+  for (RAJA::Index_type i = 0; i < num_elems * nodes_per_elem; ++i) {
+    conn[i] = dist(gen);
+  }
+  return conn;
+}
+
+//! Replicated views add their replicas into the nodes after each sweep.
+template <typename Backend, typename View>
+void flush(const View&)
+{
+}
+
+template <typename Backend, typename View, std::size_t R, typename Pol>
+void flush(const RAJA::AtomicViewWrapper<
+           View,
+           RAJA::atomic::replicated_atomic<R, Pol>>& view)
+{
+  view.template flush<typename Backend::exec_policy>();
+}
+
+template <typename Backend, typename AtomicPolicy>
+void assemble(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto conn_array = makeConnectivity<Backend>(n);
+  auto nodes = suite::makeArray<Backend>(RAJA::Index_type(num_nodes), 0.0);
+  const int* conn = conn_array.get();
+
+  RAJA::View<double, RAJA::Layout<1>> node_view(nodes.get(), num_nodes);
+  auto atomic_nodes = RAJA::make_atomic_view<AtomicPolicy>(node_view);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type e) {
+          for (int k = 0; k < nodes_per_elem; ++k) {
+            atomic_nodes(conn[e * nodes_per_elem + k]) += 0.25;
+          }
+        });
+    flush<Backend>(atomic_nodes);
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 1.0 * sizeof(int) * nodes_per_elem * n, 0.0);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+}  // end anonymous namespace
+
+template <typename Backend>
+static void AssemblyAtomic(benchmark::State& state)
+{
+  assemble<Backend, typename Backend::atomic_policy>(state);
+}
+
+template <typename Backend>
+static void AssemblyReplicated(benchmark::State& state)
+{
+  using policy =
+      RAJA::atomic::replicated_atomic<8, typename Backend::atomic_policy>;
+  assemble<Backend, policy>(state);
+}
+
+SUITE_BENCHMARK(AssemblyAtomic, 1 << 16, 1 << 20);
+SUITE_BENCHMARK(AssemblyReplicated, 1 << 16, 1 << 20);
@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Binning benchmarks, from example ex10-binning: histogram of random bin
+/// indices built with atomicAdd (Binning) and with RAJA::histogram
+/// (Histogram), for 1024 bins and for the 10 bins of the example.
+///
+
+#include "suite.hpp"
+
+#include <memory>
+#include <random>
+
+namespace
+{
+
+//! Random bin indices in [0, num_bins), the input of every binning benchmark.
+template <typename Backend>
+std::unique_ptr<int[]> makeIndices(RAJA::Index_type n, int num_bins)
+{
+  auto indices = suite::makeArray<Backend>(n, 0);
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> dist(0, num_bins - 1);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    indices[i] = dist(gen);
+  }
+  return indices;
+}
+
+template <typename Backend>
+void binAtomic(benchmark::State& state, int num_bins)
+{
+  using atomic_policy = typename Backend::atomic_policy;
+
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto indices = makeIndices<Backend>(n, num_bins);
+  auto bins = suite::makeArray<Backend>(RAJA::Index_type(num_bins), 0);
+
+  const int* idx = indices.get();
+  int* bin = bins.get();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+          RAJA::atomic::atomicAdd<atomic_policy>(&bin[idx[i]], 1);
+        });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 1.0 * sizeof(int) * n, 0.0);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename Backend>
+void binHistogram(benchmark::State& state, int num_bins)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto indices = makeIndices<Backend>(n, num_bins);
+  auto bins = suite::makeArray<Backend>(RAJA::Index_type(num_bins), 0);
+
+  const int* idx = indices.get();
+
+  while (state.KeepRunning()) {
+    RAJA::histogram<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, n),
+        bins.get(),
+        num_bins,
+        [=](RAJA::Index_type i) { return idx[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 1.0 * sizeof(int) * n, 0.0);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+}  // end anonymous namespace
+
+template <typename Backend>
+static void Binning(benchmark::State& state)
+{
+  binAtomic<Backend>(state, 1024);
+}
+
+//! As in the example, 10 bins: every thread updates the same few counters.
+template <typename Backend>
+static void BinningFew(benchmark::State& state)
+{
+  binAtomic<Backend>(state, 10);
+}
+
+template <typename Backend>
+static void Histogram(benchmark::State& state)
+{
+  binHistogram<Backend>(state, 1024);
+}
+
+template <typename Backend>
+static void HistogramFew(benchmark::State& state)
+{
+  binHistogram<Backend>(state, 10);
+}
+
+SUITE_BENCHMARK(Binning, 1 << 16, 1 << 22);
+SUITE_BENCHMARK(BinningFew, 1 << 16, 1 << 22);
+
+// RAJA::histogram has sequential, loop, OpenMP and TBB back-ends
+#define HISTOGRAM_BENCHMARK(Func, ...)                       \
+  SUITE_BENCHMARK_BACKEND(Func, seq_backend, __VA_ARGS__);  \
+  SUITE_BENCHMARK_BACKEND(Func, loop_backend, __VA_ARGS__); \
+  SUITE_BENCHMARK_OPENMP(Func, __VA_ARGS__);                \
+  SUITE_BENCHMARK_TBB(Func, __VA_ARGS__)
+
+HISTOGRAM_BENCHMARK(Histogram, 1 << 16, 1 << 22);
+HISTOGRAM_BENCHMARK(HistogramFew, 1 << 16, 1 << 22);
@@ -0,0 +1,45 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Daxpy benchmark, from example ex0-daxpy: y += a * x.
+///
+
+#include "suite.hpp"
+
+template <typename Backend>
+static void Daxpy(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto x = suite::makeArray<Backend>(n, 1.0);
+  auto y = suite::makeArray<Backend>(n, 2.0);
+  const double* xp = x.get();
+  double* yp = y.get();
+  const double a = 3.0;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { yp[i] += a * xp[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 3.0 * sizeof(double) * n, 2.0 * n);
+}
+
+SUITE_BENCHMARK(Daxpy, 1 << 16, 1 << 22);
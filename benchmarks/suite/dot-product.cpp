@@ -0,0 +1,45 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Dot product benchmark, from example ex2-dot-product.
+///
+
+#include "suite.hpp"
+
+template <typename Backend>
+static void DotProduct(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto a = suite::makeArray<Backend>(n, 1.0);
+  auto b = suite::makeArray<Backend>(n, 0.5);
+  const double* ap = a.get();
+  const double* bp = b.get();
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<typename Backend::reduce_policy, double> dot(0.0);
+    RAJA::forall<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { dot += ap[i] * bp[i]; });
+    benchmark::DoNotOptimize(dot.get());
+  }
+
+  suite::setRates(state, 2.0 * sizeof(double) * n, 2.0 * n);
+}
+
+SUITE_BENCHMARK(DotProduct, 1 << 16, 1 << 22);
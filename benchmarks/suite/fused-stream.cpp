@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Three bandwidth-bound loops over the same arrays, run as separate
+/// launches, fused per index and fused per chunk:
+///   y += a * x;  z = x + y;  x = b * z
+///
+
+#include "suite.hpp"
+
+template <typename Backend>
+static void StreamSeparate(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto x = suite::makeArray<Backend>(n, 1.0);
+  auto y = suite::makeArray<Backend>(n, 2.0);
+  auto z = suite::makeArray<Backend>(n, 0.0);
+  double* xp = x.get();
+  double* yp = y.get();
+  double* zp = z.get();
+  const double a = 3.0;
+  const double b = 0.25;
+
+  while (state.KeepRunning()) {
+    using pol = typename Backend::exec_policy;
+    RAJA::forall<pol>(RAJA::RangeSegment(0, n),
+                      [=](RAJA::Index_type i) { yp[i] += a * xp[i]; });
+    RAJA::forall<pol>(RAJA::RangeSegment(0, n),
+                      [=](RAJA::Index_type i) { zp[i] = xp[i] + yp[i]; });
+    RAJA::forall<pol>(RAJA::RangeSegment(0, n),
+                      [=](RAJA::Index_type i) { xp[i] = b * zp[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 8.0 * sizeof(double) * n, 4.0 * n);
+}
+
+template <typename Backend>
+static void StreamFused(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto x = suite::makeArray<Backend>(n, 1.0);
+  auto y = suite::makeArray<Backend>(n, 2.0);
+  auto z = suite::makeArray<Backend>(n, 0.0);
+  double* xp = x.get();
+  double* yp = y.get();
+  double* zp = z.get();
+  const double a = 3.0;
+  const double b = 0.25;
+
+  while (state.KeepRunning()) {
+    RAJA::forall_fused<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { yp[i] += a * xp[i]; },
+        [=](RAJA::Index_type i) { zp[i] = xp[i] + yp[i]; },
+        [=](RAJA::Index_type i) { xp[i] = b * zp[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  // same work as StreamSeparate, to compare rates
+  suite::setRates(state, 8.0 * sizeof(double) * n, 4.0 * n);
+}
+
+template <typename Backend>
+static void StreamFusedChunked(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto x = suite::makeArray<Backend>(n, 1.0);
+  auto y = suite::makeArray<Backend>(n, 2.0);
+  auto z = suite::makeArray<Backend>(n, 0.0);
+  double* xp = x.get();
+  double* yp = y.get();
+  double* zp = z.get();
+  const double a = 3.0;
+  const double b = 0.25;
+
+  while (state.KeepRunning()) {
+    RAJA::forall_fused_chunked<typename Backend::exec_policy>(
+        2048,
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { yp[i] += a * xp[i]; },
+        [=](RAJA::Index_type i) { zp[i] = xp[i] + yp[i]; },
+        [=](RAJA::Index_type i) { xp[i] = b * zp[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 8.0 * sizeof(double) * n, 4.0 * n);
+}
+
+SUITE_BENCHMARK(StreamSeparate, 1 << 16, 1 << 22);
+SUITE_BENCHMARK(StreamFused, 1 << 16, 1 << 22);
+SUITE_BENCHMARK(StreamFusedChunked, 1 << 16, 1 << 22);
@@ -0,0 +1,234 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Indirect daxpy benchmark, y[i] += a * x[i] over a sorted subset of the
+/// indices held in a list segment, a compressed list segment or a bitmap
+/// segment, or over a range segment with a test of a mask. The subset
+/// consists of runs of consecutive indices separated by small gaps, as for
+/// the zones of one material. The block variants select aligned blocks of
+/// 8 indices instead, held in a list segment or a block list segment.
+///
+
+#include "suite.hpp"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+//! Indices of a subset of about 3/4 of [0, 4n / 3).
+std::vector<RAJA::Index_type> subsetIndices(RAJA::Index_type n)
+{
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> run_length(1, 24);
+  std::uniform_int_distribution<int> gap(1, 8);
+  std::vector<RAJA::Index_type> indices;
+  indices.reserve(n);
+  RAJA::Index_type next = 0;
+  while (static_cast<RAJA::Index_type>(indices.size()) < n) {
+    const int len = run_length(gen);
+    for (int i = 0; i < len; ++i) {
+      indices.push_back(next++);
+    }
+    next += gap(gen);
+  }
+  indices.resize(n);
+  return indices;
+}
+
+//! Indices of a selection of about 3/5 of the aligned blocks of 8 of
+//! [0, 5n / 3).
+std::vector<RAJA::Index_type> blockIndices(RAJA::Index_type n)
+{
+  std::mt19937 gen(11);
+  std::bernoulli_distribution selected(0.6);
+  std::vector<RAJA::Index_type> indices;
+  indices.reserve(n + 8);
+  for (RAJA::Index_type b = 0;
+       static_cast<RAJA::Index_type>(indices.size()) < n;
+       b += 8) {
+    if (selected(gen)) {
+      for (RAJA::Index_type j = 0; j < 8; ++j) {
+        indices.push_back(b + j);
+      }
+    }
+  }
+  return indices;
+}
+
+template <typename Backend, typename Segment>
+void indirectDaxpy(benchmark::State& state,
+                   const Segment& seg,
+                   RAJA::Index_type n,
+                   RAJA::Index_type extent,
+                   double index_bytes)
+{
+  auto x = suite::makeArray<Backend>(extent, 1.0);
+  auto y = suite::makeArray<Backend>(extent, 2.0);
+  const double* xp = x.get();
+  double* yp = y.get();
+  const double a = 3.0;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename Backend::exec_policy>(
+        seg, [=](RAJA::Index_type i) { yp[i] += a * xp[i]; });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 3.0 * sizeof(double) * n + index_bytes, 2.0 * n);
+  state.counters["index_bytes"] = index_bytes;
+}
+
+}  // end anonymous namespace
+
+template <typename Backend>
+static void IndirectList(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  const std::vector<RAJA::Index_type> indices = subsetIndices(n);
+  RAJA::ListSegment seg(indices.data(), n);
+  indirectDaxpy<Backend>(state,
+                         seg,
+                         n,
+                         indices.back() + 1,
+                         static_cast<double>(sizeof(RAJA::Index_type) * n));
+}
+
+template <typename Backend>
+static void IndirectCompressedList(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  const std::vector<RAJA::Index_type> indices = subsetIndices(n);
+  RAJA::CompressedListSegment seg(indices);
+  indirectDaxpy<Backend>(state,
+                         seg,
+                         n,
+                         indices.back() + 1,
+                         static_cast<double>(seg.storage_bytes()));
+}
+
+template <typename Backend>
+static void IndirectBitmap(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  const std::vector<RAJA::Index_type> indices = subsetIndices(n);
+  RAJA::BitmapSegment seg(indices);
+  indirectDaxpy<Backend>(state,
+                         seg,
+                         n,
+                         indices.back() + 1,
+                         static_cast<double>(seg.storage_bytes()));
+}
+
+//! The same loop over all indices, skipping those not set in a byte mask.
+template <typename Backend>
+static void IndirectMaskedRange(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  const std::vector<RAJA::Index_type> indices = subsetIndices(n);
+  const RAJA::Index_type extent = indices.back() + 1;
+  std::vector<unsigned char> mask(extent, 0);
+  for (RAJA::Index_type i : indices) {
+    mask[i] = 1;
+  }
+  const unsigned char* maskp = mask.data();
+
+  auto x = suite::makeArray<Backend>(extent, 1.0);
+  auto y = suite::makeArray<Backend>(extent, 2.0);
+  const double* xp = x.get();
+  double* yp = y.get();
+  const double a = 3.0;
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, extent), [=](RAJA::Index_type i) {
+          if (maskp[i]) yp[i] += a * xp[i];
+        });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 3.0 * sizeof(double) * n + extent, 2.0 * n);
+  state.counters["index_bytes"] = static_cast<double>(extent);
+}
+
+template <typename Backend>
+static void IndirectBlocksAsList(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  const std::vector<RAJA::Index_type> indices = blockIndices(n);
+  RAJA::ListSegment seg(indices.data(), indices.size());
+  indirectDaxpy<Backend>(
+      state,
+      seg,
+      indices.size(),
+      indices.back() + 1,
+      static_cast<double>(sizeof(RAJA::Index_type) * indices.size()));
+}
+
+template <typename Backend>
+static void IndirectBlockList(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  const std::vector<RAJA::Index_type> indices = blockIndices(n);
+  std::vector<RAJA::Index_type> starts;
+  for (size_t k = 0; k < indices.size(); k += 8) {
+    starts.push_back(indices[k]);
+  }
+  RAJA::BlockListSegment<8> seg(starts);
+  indirectDaxpy<Backend>(
+      state,
+      seg,
+      indices.size(),
+      indices.back() + 1,
+      static_cast<double>(sizeof(RAJA::Index_type) * starts.size()));
+}
+
+// the other back-ends decode compressed lists and bitmaps one index at a
+// time
+SUITE_BENCHMARK_BACKEND(IndirectList, seq_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectList, loop_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectList, simd_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_OPENMP(IndirectList, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectCompressedList, seq_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectCompressedList, loop_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectCompressedList, simd_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_OPENMP(IndirectCompressedList, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectBitmap, seq_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectBitmap, loop_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectBitmap, simd_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_OPENMP(IndirectBitmap, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectMaskedRange, seq_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectMaskedRange, simd_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_OPENMP(IndirectMaskedRange, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectBlocksAsList, seq_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectBlocksAsList, simd_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_OPENMP(IndirectBlocksAsList, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectBlockList, seq_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(IndirectBlockList, simd_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_OPENMP(IndirectBlockList, 1 << 16, 1 << 22);
@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Jacobi benchmark, from example ex11-jacobi: one sweep of the 5-point
+/// Jacobi iteration on an N x N interior grid followed by the residual
+/// reduction and copy back. The right hand side is precomputed.
+///
+
+#include "suite.hpp"
+
+template <typename Backend>
+static void Jacobi(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  const RAJA::Index_type stride = N + 2;
+  const RAJA::Index_type num_points = stride * stride;
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto f = suite::makeArray<Backend>(num_points, 1.0e-3);
+  auto i_new = suite::makeArray<Backend>(num_points, 0.0);
+  auto i_old = suite::makeArray<Backend>(num_points, 0.0);
+  const double* fp = f.get();
+  double* I = i_new.get();
+  double* Iold = i_old.get();
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::For<
+      1,
+      typename Backend::outer_policy,
+      RAJA::statement::
+          For<0, typename Backend::inner_policy, RAJA::statement::Lambda<0>>>>;
+
+  RAJA::RangeSegment interior(1, N + 1);
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(interior, interior),
+                      [=](RAJA::Index_type m, RAJA::Index_type n) {
+                        const RAJA::Index_type id = n * stride + m;
+                        I[id] = 0.25 * (-fp[id] + Iold[id - stride]
+                                        + Iold[id + stride] + Iold[id - 1]
+                                        + Iold[id + 1]);
+                      });
+
+    RAJA::ReduceSum<typename Backend::reduce_policy, double> residual(0.0);
+    RAJA::forall<typename Backend::exec_policy>(
+        RAJA::RangeSegment(0, num_points), [=](RAJA::Index_type k) {
+          residual += (I[k] - Iold[k]) * (I[k] - Iold[k]);
+          Iold[k] = I[k];
+        });
+    benchmark::DoNotOptimize(residual.get());
+  }
+
+  // sweep: read f and Iold, write I; residual: read I and Iold, write Iold
+  suite::setRates(state,
+                  3.0 * sizeof(double) * (N * N + num_points),
+                  5.0 * N * N + 3.0 * num_points);
+}
+
+SUITE_BENCHMARK(Jacobi, 256, 1024);
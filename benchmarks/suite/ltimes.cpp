@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// LTimes benchmark, from example cpu-shmem-ltimes:
+/// phi(m, g, z) += ell(m, d) * psi(d, g, z). The size argument is the
+/// number of zones.
+///
+
+#include "suite.hpp"
+
+namespace
+{
+
+const RAJA::Index_type num_moments = 25;
+const RAJA::Index_type num_directions = 80;
+const RAJA::Index_type num_groups = 16;
+
+}  // end anonymous namespace
+
+template <typename Backend>
+static void LTimes(benchmark::State& state)
+{
+  const RAJA::Index_type num_zones = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto ell_data =
+      suite::makeArray<Backend>(num_moments * num_directions, 1.0e-2);
+  auto psi_data =
+      suite::makeArray<Backend>(num_directions * num_groups * num_zones, 2.0);
+  auto phi_data =
+      suite::makeArray<Backend>(num_moments * num_groups * num_zones, 0.0);
+
+  RAJA::View<double, RAJA::Layout<2>> ell(ell_data.get(),
+                                          num_moments,
+                                          num_directions);
+  RAJA::View<double, RAJA::Layout<3>> psi(psi_data.get(),
+                                          num_directions,
+                                          num_groups,
+                                          num_zones);
+  RAJA::View<double, RAJA::Layout<3>> phi(phi_data.get(),
+                                          num_moments,
+                                          num_groups,
+                                          num_zones);
+
+  // only the moment loop may run in parallel, every direction updates the
+  // same phi entries
+  using Pol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      typename Backend::outer_policy,
+      RAJA::statement::For<
+          1,
+          RAJA::loop_exec,
+          RAJA::statement::For<
+              2,
+              RAJA::loop_exec,
+              RAJA::statement::For<3,
+                                   typename Backend::inner_policy,
+                                   RAJA::statement::Lambda<0>>>>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, num_moments),
+                                       RAJA::RangeSegment(0, num_directions),
+                                       RAJA::RangeSegment(0, num_groups),
+                                       RAJA::RangeSegment(0, num_zones)),
+                      [=](RAJA::Index_type m,
+                          RAJA::Index_type d,
+                          RAJA::Index_type g,
+                          RAJA::Index_type z) {
+                        phi(m, g, z) += ell(m, d) * psi(d, g, z);
+                      });
+    benchmark::ClobberMemory();
+  }
+
+  // compulsory traffic: read psi and ell, read and write phi once
+  const double bytes =
+      sizeof(double) * (num_directions * num_groups * num_zones
+                        + num_moments * num_directions
+                        + 2.0 * num_moments * num_groups * num_zones);
+  suite::setRates(state,
+                  bytes,
+                  2.0 * num_moments * num_directions * num_groups * num_zones);
+}
+
+SUITE_BENCHMARK(LTimes, 256, 1024);
@@ -0,0 +1,60 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Matrix multiplication benchmark, from example ex4-matrix-multiply:
+/// C = A * B for square N x N matrices, with the row and column loops in a
+/// RAJA::kernel nest and the dot product loop inside the lambda.
+///
+
+#include "suite.hpp"
+
+template <typename Backend>
+static void MatrixMultiply(benchmark::State& state)
+{
+  const RAJA::Index_type N = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto a = suite::makeArray<Backend>(N * N, 1.0);
+  auto b = suite::makeArray<Backend>(N * N, 0.5);
+  auto c = suite::makeArray<Backend>(N * N, 0.0);
+  RAJA::View<double, RAJA::Layout<2>> A(a.get(), N, N);
+  RAJA::View<double, RAJA::Layout<2>> B(b.get(), N, N);
+  RAJA::View<double, RAJA::Layout<2>> C(c.get(), N, N);
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::For<
+      1,
+      typename Backend::outer_policy,
+      RAJA::statement::
+          For<0, typename Backend::inner_policy, RAJA::statement::Lambda<0>>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                       RAJA::RangeSegment(0, N)),
+                      [=](RAJA::Index_type col, RAJA::Index_type row) {
+                        double dot = 0.0;
+                        for (RAJA::Index_type k = 0; k < N; ++k) {
+                          dot += A(row, k) * B(k, col);
+                        }
+                        C(row, col) = dot;
+                      });
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 3.0 * sizeof(double) * N * N, 2.0 * N * N * N);
+}
+
+SUITE_BENCHMARK(MatrixMultiply, 128, 512);
@@ -0,0 +1,48 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Scan benchmark, from example ex9-scan: out-of-place inclusive sum.
+///
+
+#include "suite.hpp"
+
+template <typename Backend>
+static void InclusiveScan(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto in = suite::makeArray<Backend>(n, 1);
+  auto out = suite::makeArray<Backend>(n, 0);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<typename Backend::exec_policy>(in.get(),
+                                                        in.get() + n,
+                                                        out.get());
+    benchmark::ClobberMemory();
+  }
+
+  suite::setRates(state, 2.0 * sizeof(int) * n, 0.0);
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// the thread pool backend has no scan
+SUITE_BENCHMARK_BACKEND(InclusiveScan, seq_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(InclusiveScan, loop_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_BACKEND(InclusiveScan, simd_backend, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_OPENMP(InclusiveScan, 1 << 16, 1 << 22);
+SUITE_BENCHMARK_TBB(InclusiveScan, 1 << 16, 1 << 22);
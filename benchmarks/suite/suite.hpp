@@ -0,0 +1,291 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Common definitions for the RAJA benchmark suite.
+///
+/// Every benchmark in the suite is a function template over a backend, a
+/// struct bundling the policies used for one programming model together with
+/// a scope object that pins the number of threads it runs on. exec_policy is
+/// used for flat loops, outer_policy and inner_policy for loop nests.
+///
+/// Benchmarks take two arguments, the problem size and the thread count, and
+/// report rates as counters so that they appear in the JSON output:
+///
+///   benchmark-suite.exe --benchmark_out=suite.json --benchmark_out_format=json
+///
+
+#ifndef RAJA_benchmark_suite_HPP
+#define RAJA_benchmark_suite_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#endif
+
+namespace suite
+{
+
+//! Thread scope for backends that always run on the calling thread.
+struct serial_threads {
+  static const bool fixed = true;
+
+  explicit serial_threads(int) {}
+
+  static int max_threads() { return 1; }
+};
+
+struct seq_backend {
+  using exec_policy = RAJA::seq_exec;
+  using outer_policy = RAJA::seq_exec;
+  using inner_policy = RAJA::seq_exec;
+  using reduce_policy = RAJA::seq_reduce;
+  using atomic_policy = RAJA::atomic::seq_atomic;
+  using threads = serial_threads;
+};
+
+struct loop_backend {
+  using exec_policy = RAJA::loop_exec;
+  using outer_policy = RAJA::loop_exec;
+  using inner_policy = RAJA::loop_exec;
+  using reduce_policy = RAJA::seq_reduce;
+  using atomic_policy = RAJA::atomic::seq_atomic;
+  using threads = serial_threads;
+};
+
+struct simd_backend {
+  using exec_policy = RAJA::simd_exec;
+  using outer_policy = RAJA::loop_exec;
+  using inner_policy = RAJA::simd_exec;
+  using reduce_policy = RAJA::seq_reduce;
+  using atomic_policy = RAJA::atomic::seq_atomic;
+  using threads = serial_threads;
+};
+
+#if defined(RAJA_ENABLE_OPENMP)
+//! Sets the OpenMP thread count for the lifetime of the object.
+class omp_threads
+{
+public:
+  static const bool fixed = false;
+
+  explicit omp_threads(int num_threads) : m_saved(omp_get_max_threads())
+  {
+    omp_set_num_threads(num_threads);
+  }
+
+  ~omp_threads() { omp_set_num_threads(m_saved); }
+
+  static int max_threads() { return omp_get_num_procs(); }
+
+private:
+  int m_saved;
+};
+
+struct omp_backend {
+  using exec_policy = RAJA::omp_parallel_for_exec;
+  using outer_policy = RAJA::omp_parallel_for_exec;
+  using inner_policy = RAJA::loop_exec;
+  using reduce_policy = RAJA::omp_reduce;
+  using atomic_policy = RAJA::atomic::omp_atomic;
+  using threads = omp_threads;
+};
+
+struct omp_static_backend {
+  using exec_policy = RAJA::omp_parallel_exec<RAJA::omp_for_static<1024>>;
+  using outer_policy = RAJA::omp_parallel_exec<RAJA::omp_for_static<1024>>;
+  using inner_policy = RAJA::loop_exec;
+  using reduce_policy = RAJA::omp_reduce;
+  using atomic_policy = RAJA::atomic::omp_atomic;
+  using threads = omp_threads;
+};
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+//! Limits TBB parallelism for the lifetime of the object.
+class tbb_threads
+{
+public:
+  static const bool fixed = false;
+
+  explicit tbb_threads(int num_threads)
+      : m_control(tbb::global_control::max_allowed_parallelism,
+                  static_cast<size_t>(num_threads))
+  {
+  }
+
+  static int max_threads() { return tbb::this_task_arena::max_concurrency(); }
+
+private:
+  tbb::global_control m_control;
+};
+
+struct tbb_backend {
+  using exec_policy = RAJA::tbb_for_exec;
+  using outer_policy = RAJA::tbb_for_exec;
+  using inner_policy = RAJA::loop_exec;
+  using reduce_policy = RAJA::tbb_reduce;
+  using atomic_policy = RAJA::atomic::auto_atomic;
+  using threads = tbb_threads;
+};
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+//! The pool size is fixed when the pool starts, see RAJA_NUM_THREADS.
+class thread_pool_threads
+{
+public:
+  static const bool fixed = true;
+
+  explicit thread_pool_threads(int) {}
+
+  static int max_threads()
+  {
+    return RAJA::threads::ThreadPool::getInstance().getNumThreads();
+  }
+};
+
+struct thread_pool_backend {
+  using exec_policy = RAJA::thread_pool_static<>;
+  using outer_policy = RAJA::thread_pool_static<>;
+  using inner_policy = RAJA::loop_exec;
+  using reduce_policy = RAJA::thread_pool_reduce;
+  using atomic_policy = RAJA::atomic::auto_atomic;
+  using threads = thread_pool_threads;
+};
+#endif
+
+/*!
+ * Thread counts 1, 2, 4, ... up to and including the backend maximum, or
+ * only the maximum for backends whose thread count cannot be changed.
+ */
+template <typename Backend>
+std::vector<int> threadCounts()
+{
+  const int max_threads = Backend::threads::max_threads();
+
+  std::vector<int> counts;
+  if (Backend::threads::fixed) {
+    counts.push_back(max_threads);
+    return counts;
+  }
+  for (int nt = 1; nt < max_threads; nt *= 2) {
+    counts.push_back(nt);
+  }
+  counts.push_back(max_threads);
+  return counts;
+}
+
+//! Register the cross product of sizes and thread counts for Backend.
+template <typename Backend>
+void sizesAndThreads(benchmark::internal::Benchmark* b,
+                     std::initializer_list<long> sizes)
+{
+  for (long size : sizes) {
+    for (int nt : threadCounts<Backend>()) {
+      b->Args({size, nt});
+    }
+  }
+  b->ArgNames({"size", "threads"});
+  b->UseRealTime();
+}
+
+/*!
+ * Array of n copies of value, filled with the backend's exec_policy so that
+ * pages are first touched by the threads that later use them.
+ */
+template <typename Backend, typename T>
+std::unique_ptr<T[]> makeArray(RAJA::Index_type n, T value)
+{
+  std::unique_ptr<T[]> array(new T[n]);
+  T* data = array.get();
+  RAJA::forall<typename Backend::exec_policy>(
+      RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { data[i] = value; });
+  return array;
+}
+
+/*!
+ * Report the bytes moved and floating point operations of one benchmark
+ * iteration as rates. A zero flop count is not reported.
+ */
+inline void setRates(benchmark::State& state, double bytes, double flops)
+{
+  const double iterations = static_cast<double>(state.iterations());
+  state.counters["bytes_per_second"] =
+      benchmark::Counter(bytes * iterations, benchmark::Counter::kIsRate);
+  if (flops > 0.0) {
+    state.counters["flops"] =
+        benchmark::Counter(flops * iterations, benchmark::Counter::kIsRate);
+  }
+}
+
+}  // end namespace suite
+
+/*!
+ * Register benchmark Func for Backend over the given problem sizes.
+ */
+#define SUITE_BENCHMARK_BACKEND(Func, Backend, ...)                  \
+  BENCHMARK_TEMPLATE(Func, suite::Backend)                          \
+      ->Apply([](benchmark::internal::Benchmark* b) {               \
+        suite::sizesAndThreads<suite::Backend>(b, {__VA_ARGS__}); \
+      })
+
+#if defined(RAJA_ENABLE_OPENMP)
+#define SUITE_BENCHMARK_OPENMP(Func, ...)                        \
+  SUITE_BENCHMARK_BACKEND(Func, omp_backend, __VA_ARGS__);       \
+  SUITE_BENCHMARK_BACKEND(Func, omp_static_backend, __VA_ARGS__)
+#else
+#define SUITE_BENCHMARK_OPENMP(Func, ...) static_assert(true, "")
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#define SUITE_BENCHMARK_TBB(Func, ...) \
+  SUITE_BENCHMARK_BACKEND(Func, tbb_backend, __VA_ARGS__)
+#else
+#define SUITE_BENCHMARK_TBB(Func, ...) static_assert(true, "")
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+#define SUITE_BENCHMARK_THREADS(Func, ...) \
+  SUITE_BENCHMARK_BACKEND(Func, thread_pool_backend, __VA_ARGS__)
+#else
+#define SUITE_BENCHMARK_THREADS(Func, ...) static_assert(true, "")
+#endif
+
+/*!
+ * Register benchmark Func for every enabled backend over the given problem
+ * sizes.
+ */
+#define SUITE_BENCHMARK(Func, ...)                         \
+  SUITE_BENCHMARK_BACKEND(Func, seq_backend, __VA_ARGS__); \
+  SUITE_BENCHMARK_BACKEND(Func, loop_backend, __VA_ARGS__); \
+  SUITE_BENCHMARK_BACKEND(Func, simd_backend, __VA_ARGS__); \
+  SUITE_BENCHMARK_OPENMP(Func, __VA_ARGS__);               \
+  SUITE_BENCHMARK_TBB(Func, __VA_ARGS__);                  \
+  SUITE_BENCHMARK_THREADS(Func, __VA_ARGS__)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+///
+/// Wave equation benchmark, from example ex13-wave-eqn: two time steps of
+/// the fourth order finite difference scheme on a periodic nx x nx grid.
+///
+
+#include "suite.hpp"
+
+namespace
+{
+
+//! stencil radius
+const int sr = 2;
+
+template <typename Pol>
+void wave(double* P1, double* P2, RAJA::RangeSegment bounds, double ct, int nx)
+{
+  RAJA::kernel<Pol>(RAJA::make_tuple(bounds, bounds),
+                    [=](RAJA::Index_type tx, RAJA::Index_type ty) {
+                      const double coeff[5] = {
+                          -1.0 / 12.0, 4.0 / 3.0, -5.0 / 2.0, 4.0 / 3.0,
+                          -1.0 / 12.0};
+
+                      const int id = tx + ty * nx;
+                      const double P_old = P1[id];
+                      const double P_curr = P2[id];
+
+                      double lap = 0.0;
+                      for (int r = -sr; r <= sr; ++r) {
+                        const int xi = (tx + r + nx) % nx;
+                        lap += coeff[r + sr] * P2[xi + nx * ty];
+
+                        const int yi = (ty + r + nx) % nx;
+                        lap += coeff[r + sr] * P2[tx + nx * yi];
+                      }
+
+                      P1[id] = 2 * P_curr - P_old + ct * lap;
+                    });
+}
+
+}  // end anonymous namespace
+
+template <typename Backend>
+static void WaveEqn(benchmark::State& state)
+{
+  const int nx = static_cast<int>(state.range(0));
+  typename Backend::threads threads(static_cast<int>(state.range(1)));
+
+  auto p1 = suite::makeArray<Backend>(RAJA::Index_type(nx) * nx, 0.0);
+  auto p2 = suite::makeArray<Backend>(RAJA::Index_type(nx) * nx, 1.0);
+  const double ct = 1.0e-4;
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::For<
+      1,
+      typename Backend::outer_policy,
+      RAJA::statement::
+          For<0, typename Backend::inner_policy, RAJA::statement::Lambda<0>>>>;
+
+  RAJA::RangeSegment bounds(0, nx);
+
+  while (state.KeepRunning()) {
+    wave<Pol>(p1.get(), p2.get(), bounds, ct, nx);
+    wave<Pol>(p2.get(), p1.get(), bounds, ct, nx);
+    benchmark::ClobberMemory();
+  }
+
+  // per point and step: read P1 and P2, write P1; 20 flops for the
+  // Laplacian and 4 for the update
+  const double points = 2.0 * nx * nx;
+  suite::setRates(state, 3.0 * sizeof(double) * points, 24.0 * points);
+}
+
+SUITE_BENCHMARK(WaveEqn, 256, 1024);
@@ -39,6 +39,10 @@ macro(raja_add_executable)
     list (APPEND arg_DEPENDS_ON tbb)
   endif ()
 
+  if (ENABLE_THREADS)
+    list (APPEND arg_DEPENDS_ON threads)
+  endif ()
+
   if (${arg_TEST})
     set (_output_dir test)
   else ()
@@ -74,3 +78,23 @@ macro(raja_add_test)
     #COMMAND ${TEST_DRIVER} $<TARGET_FILE:${arg_NAME}>)
     COMMAND ${TEST_DRIVER} ${arg_NAME})
 endmacro(raja_add_test)
+
+macro(raja_add_benchmark)
+  set(options )
+  set(singleValueArgs NAME)
+  set(multiValueArgs SOURCES DEPENDS_ON ARGS)
+
+  cmake_parse_arguments(arg
+    "${options}" "${singleValueArgs}" "${multiValueArgs}" ${ARGN})
+
+  list (APPEND arg_DEPENDS_ON gbenchmark ${CMAKE_THREAD_LIBS_INIT})
+
+  raja_add_executable(
+    NAME ${arg_NAME}.exe
+    SOURCES ${arg_SOURCES}
+    DEPENDS_ON ${arg_DEPENDS_ON})
+
+  blt_add_benchmark(
+    NAME ${arg_NAME}
+    COMMAND ${arg_NAME} ${arg_ARGS})
+endmacro(raja_add_benchmark)
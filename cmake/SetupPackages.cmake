@@ -37,6 +37,34 @@ if (ENABLE_TBB)
   endif()
 endif ()
 
+if (ENABLE_THREADS)
+  find_package(Threads)
+  if(Threads_FOUND)
+    blt_register_library(
+      NAME threads
+      LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+    message(STATUS "std::thread pool Enabled")
+  else()
+    message(WARNING "Threads NOT FOUND")
+    set(ENABLE_THREADS Off)
+  endif()
+endif ()
+
+if (ENABLE_NUMA)
+  find_path(NUMA_INCLUDE_DIR numaif.h)
+  find_library(NUMA_LIBRARY numa)
+  if(NUMA_INCLUDE_DIR AND NUMA_LIBRARY)
+    blt_register_library(
+      NAME numa
+      INCLUDES ${NUMA_INCLUDE_DIR}
+      LIBRARIES ${NUMA_LIBRARY})
+    message(STATUS "libnuma Enabled")
+  else()
+    message(STATUS "libnuma NOT FOUND, first-touch allocation will not migrate pages")
+    set(ENABLE_NUMA Off)
+  endif()
+endif ()
+
 if (ENABLE_CHAI)
   message(STATUS "CHAI enabled")
   find_package(chai)
@@ -65,9 +65,12 @@ check_function_exists(_mm_malloc RAJA_HAVE_MM_MALLOC)
 set(RAJA_ENABLE_OPENMP ${ENABLE_OPENMP})
 set(RAJA_ENABLE_TARGET_OPENMP ${ENABLE_TARGET_OPENMP})
 set(RAJA_ENABLE_TBB ${ENABLE_TBB})
+set(RAJA_ENABLE_THREADS ${ENABLE_THREADS})
 set(RAJA_ENABLE_CUDA ${ENABLE_CUDA})
 set(RAJA_ENABLE_CLANG_CUDA ${ENABLE_CLANG_CUDA})
 set(RAJA_ENABLE_CHAI ${ENABLE_CHAI})
+set(RAJA_ENABLE_NUMA ${ENABLE_NUMA})
+set(RAJA_ENABLE_INSTRUMENTATION ${ENABLE_INSTRUMENTATION})
 set(RAJA_ENABLE_CUB ${ENABLE_CUB})
 
 # Configure a header file with all the variables we found.
@@ -32,6 +32,7 @@
  *  RAJA features shown:
  *    - `forall` loop iteration template method
  *    - Atomic add
+ *    - `histogram` template method
  *
  *  If CUDA is enabled, CUDA unified memory is used.
  */
@@ -114,6 +115,19 @@ int main(int RAJA_UNUSED_ARG(argc), char** RAJA_UNUSED_ARG(argv[]))
 
   printBins(bins, M);
 
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n\n Running RAJA OMP binning with histogram" << std::endl;
+  std::memset(bins, 0, M * sizeof(int));
+
+  RAJA::histogram<EXEC_POL2>(array_range, bins, M, [=](int i) {
+
+      return array[i];
+
+    });
+
+  printBins(bins, M);
+
 #endif
 //----------------------------------------------------------------------------//
 
@@ -44,6 +44,8 @@
 #include "RAJA/util/Operators.hpp"
 
 #include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/instrument.hpp"
+#include "RAJA/util/slab_mempool.hpp"
 
 #include "RAJA/util/camp_aliases.hpp"
 
@@ -80,6 +82,10 @@
 #include "RAJA/policy/tbb.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_THREADS)
+#include "RAJA/policy/threads.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 #include "RAJA/policy/cuda.hpp"
 #endif
@@ -103,6 +109,10 @@
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
 
+#include "RAJA/pattern/batch.hpp"
+#include "RAJA/pattern/fused.hpp"
+#include "RAJA/pattern/graph.hpp"
+
 #include "RAJA/policy/MultiPolicy.hpp"
 
 
@@ -166,4 +176,13 @@
 
 #include "RAJA/pattern/scan.hpp"
 
+#include "RAJA/pattern/sort.hpp"
+
+#include "RAJA/pattern/histogram.hpp"
+
+//
+// NUMA-aware first-touch allocation
+//
+#include "RAJA/util/first_touch.hpp"
+
 #endif  // closing endif for header file include guard
@@ -0,0 +1,488 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the bitmap segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BitmapSegment_HPP
+#define RAJA_BitmapSegment_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/defines.hpp"
+#include "RAJA/util/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Number of indices per word of a bitmap.
+constexpr Index_type bitmap_word_bits = 64;
+
+//! Number of words between two samples of the rank directory of a bitmap.
+constexpr Index_type bitmap_rank_words = 8;
+
+/*!
+ * Membership bits of a bitmap segment, shared by copies of the segment.
+ * Bit j of word w is set if index first + 64 * w + j is in the segment,
+ * and rank[s] is the number of bits set in the words before word 8 * s.
+ */
+struct BitmapStorage {
+  std::vector<std::uint64_t> words;
+  std::vector<Index_type> rank;
+};
+
+RAJA_INLINE int bitmapCountTrailingZeros(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int n = 0;
+  while ((word & 1) == 0) {
+    word >>= 1;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+RAJA_INLINE int bitmapPopCount(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(word);
+#else
+  int n = 0;
+  for (; word != 0; word &= word - 1) {
+    ++n;
+  }
+  return n;
+#endif
+}
+
+/*!
+ * Call body(base + j) for each bit j set in word, lowest bit first. Each
+ * step finds the lowest set bit with a count of trailing zeros and clears
+ * it, so the cost is proportional to the number of bits set.
+ */
+template <typename T, typename Body>
+RAJA_INLINE void bitmapWordForEach(std::uint64_t word, T base, Body&& body)
+{
+  while (word != 0) {
+    body(static_cast<T>(base + bitmapCountTrailingZeros(word)));
+    word &= word - 1;
+  }
+}
+
+//! Fill in the rank directory of storage from its words.
+inline void bitmapBuildRank(BitmapStorage& storage)
+{
+  const Index_type num_words = storage.words.size();
+  storage.rank.assign(
+      (num_words + bitmap_rank_words - 1) / bitmap_rank_words + 1, 0);
+  Index_type count = 0;
+  for (Index_type w = 0; w < num_words; ++w) {
+    if (w % bitmap_rank_words == 0) {
+      storage.rank[w / bitmap_rank_words] = count;
+    }
+    count += bitmapPopCount(storage.words[w]);
+  }
+  storage.rank.back() = count;
+}
+
+/*!
+ * Bit position, counted from the start of the bitmap, of the set bit with
+ * rank pos. The rank directory is searched for the sample before it and
+ * at most bitmap_rank_words words are then scanned.
+ */
+inline Index_type bitmapSelect(const BitmapStorage& storage, Index_type pos)
+{
+  const Index_type sample =
+      std::upper_bound(storage.rank.begin(), storage.rank.end() - 1, pos)
+      - storage.rank.begin() - 1;
+  Index_type remaining = pos - storage.rank[sample];
+  Index_type w = sample * bitmap_rank_words;
+  for (;; ++w) {
+    const Index_type count = bitmapPopCount(storage.words[w]);
+    if (remaining < count) break;
+    remaining -= count;
+  }
+  std::uint64_t word = storage.words[w];
+  for (; remaining > 0; --remaining) {
+    word &= word - 1;
+  }
+  return w * bitmap_word_bits + bitmapCountTrailingZeros(word);
+}
+
+}  // end namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing a set of indices stored as a bit vector over
+ *         the range of indices it spans.
+ *
+ *         A bitmap segment takes one bit per index of the range spanned,
+ *         instead of sizeof(T) bytes per index for a list segment, and
+ *         visits only the indices in the set, unlike a range segment with
+ *         a test in the loop body. It suits dense but irregular sets such
+ *         as the active cells of a domain.
+ *
+ *         Indices are visited in increasing order and each index only once,
+ *         whatever the order and repetitions of the indices it is built
+ *         from.
+ *
+ *         The forall back-ends for sequential, loop, simd, OpenMP, TBB and
+ *         the thread pool scan the set bits of one 64 bit word at a time;
+ *         the parallel ones share out whole words. Other back-ends, and
+ *         forall_Icount, use the random access iterator, which finds each
+ *         index from a rank directory sampled every 8 words: a binary
+ *         search and up to 8 popcounts per index, so it is much slower.
+ *
+ *         The bits are immutable and shared by copies of the segment. The
+ *         segment is host only.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TypedBitmapSegment
+{
+public:
+  //! value type of the indices
+  using value_type = T;
+
+  //! random access iterator over the indices in the segment
+  class iterator
+  {
+  public:
+    using value_type = T;
+    using difference_type = Index_type;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    iterator() : m_storage(nullptr), m_first(0), m_pos(0) {}
+
+    iterator(const detail::BitmapStorage* storage,
+             value_type first,
+             Index_type pos)
+        : m_storage(storage), m_first(first), m_pos(pos)
+    {
+    }
+
+    value_type operator*() const { return (*this)[0]; }
+
+    value_type operator[](difference_type rhs) const
+    {
+      return static_cast<value_type>(
+          m_first + detail::bitmapSelect(*m_storage, m_pos + rhs));
+    }
+
+    bool operator==(const iterator& rhs) const { return m_pos == rhs.m_pos; }
+    bool operator!=(const iterator& rhs) const { return m_pos != rhs.m_pos; }
+    bool operator<(const iterator& rhs) const { return m_pos < rhs.m_pos; }
+    bool operator>(const iterator& rhs) const { return m_pos > rhs.m_pos; }
+    bool operator<=(const iterator& rhs) const { return m_pos <= rhs.m_pos; }
+    bool operator>=(const iterator& rhs) const { return m_pos >= rhs.m_pos; }
+
+    iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    iterator& operator+=(difference_type rhs)
+    {
+      m_pos += rhs;
+      return *this;
+    }
+    iterator& operator-=(difference_type rhs)
+    {
+      m_pos -= rhs;
+      return *this;
+    }
+    iterator operator+(difference_type rhs) const
+    {
+      return iterator(m_storage, m_first, m_pos + rhs);
+    }
+    iterator operator-(difference_type rhs) const
+    {
+      return iterator(m_storage, m_first, m_pos - rhs);
+    }
+    friend iterator operator+(difference_type lhs, const iterator& rhs)
+    {
+      return rhs + lhs;
+    }
+    difference_type operator-(const iterator& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+  private:
+    const detail::BitmapStorage* m_storage;
+    value_type m_first;
+    Index_type m_pos;
+  };
+
+  //! prevent compiler from providing a default constructor
+  TypedBitmapSegment() = delete;
+
+  ///
+  /// \brief Construct bitmap segment from given array with specified
+  ///        length.
+  ///
+  TypedBitmapSegment(const value_type* values, Index_type length)
+  {
+    initFromValues(values, length > 0 ? length : 0);
+  }
+
+  ///
+  /// Construct bitmap segment from arbitrary object holding indices, e.g. a
+  /// list segment.
+  ///
+  /// The object must provide methods: begin(), end(), size().
+  ///
+  template <typename Container>
+  explicit TypedBitmapSegment(const Container& container)
+  {
+    initFromValues(container.begin(), container.size());
+  }
+
+  ///
+  /// \brief Construct bitmap segment holding the indices i in [begin, end)
+  ///        for which pred(i) is true.
+  ///
+  template <typename Predicate>
+  TypedBitmapSegment(value_type begin, value_type end, Predicate&& pred)
+      : m_first(begin)
+  {
+    std::shared_ptr<detail::BitmapStorage> storage =
+        std::make_shared<detail::BitmapStorage>();
+    const Index_type extent = end > begin ? end - begin : 0;
+    storage->words.assign(
+        (extent + detail::bitmap_word_bits - 1) / detail::bitmap_word_bits, 0);
+    for (Index_type i = 0; i < extent; ++i) {
+      if (pred(static_cast<value_type>(begin + i))) {
+        storage->words[i / detail::bitmap_word_bits] |=
+            std::uint64_t(1) << (i % detail::bitmap_word_bits);
+      }
+    }
+    init(storage);
+  }
+
+  //! accessor to get the begin iterator for a TypedBitmapSegment
+  iterator begin() const { return iterator(m_storage.get(), m_first, 0); }
+
+  //! accessor to get the end iterator for a TypedBitmapSegment
+  iterator end() const { return iterator(m_storage.get(), m_first, m_size); }
+
+  //! accessor to retrieve the total number of elements in a
+  //! TypedBitmapSegment
+  Index_type size() const { return m_size; }
+
+  //! number of 64 bit words in the bitmap
+  Index_type num_words() const { return m_num_words; }
+
+  //! membership words, bit j of word w stands for index wordBase(w) + j
+  const std::uint64_t* words() const { return m_words; }
+
+  //! index that bit 0 of word w stands for
+  value_type wordBase(Index_type w) const
+  {
+    return static_cast<value_type>(m_first + w * detail::bitmap_word_bits);
+  }
+
+  //! number of indices in the words before word w
+  Index_type countBefore(Index_type w) const
+  {
+    const Index_type sample = w / detail::bitmap_rank_words;
+    Index_type count = m_storage->rank[sample];
+    for (Index_type v = sample * detail::bitmap_rank_words; v < w; ++v) {
+      count += detail::bitmapPopCount(m_words[v]);
+    }
+    return count;
+  }
+
+  //! return true if index i is in the segment
+  bool contains(value_type i) const
+  {
+    if (i < m_first) return false;
+    const Index_type bit = i - m_first;
+    if (bit >= m_num_words * detail::bitmap_word_bits) return false;
+    return (m_words[bit / detail::bitmap_word_bits]
+            >> (bit % detail::bitmap_word_bits))
+           & 1;
+  }
+
+  //! number of bytes used to store the bits and the rank directory
+  std::size_t storage_bytes() const
+  {
+    return m_storage->words.size() * sizeof(std::uint64_t)
+           + m_storage->rank.size() * sizeof(Index_type);
+  }
+
+  ///
+  /// Equality operator returns true if segments hold the same indices;
+  /// else false.
+  ///
+  bool operator==(const TypedBitmapSegment& other) const
+  {
+    if (m_size != other.m_size) return false;
+    if (m_storage == other.m_storage) return true;
+    for (iterator a = begin(), b = other.begin(); a != end(); ++a, ++b) {
+      if (*a != *b) return false;
+    }
+    return true;
+  }
+
+  ///
+  /// Inequality operator returns true if segments are not equal, else false.
+  ///
+  bool operator!=(const TypedBitmapSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+private:
+  template <typename Iter>
+  void initFromValues(Iter values, Index_type length)
+  {
+    std::shared_ptr<detail::BitmapStorage> storage =
+        std::make_shared<detail::BitmapStorage>();
+    m_first = 0;
+    if (length > 0) {
+      value_type lo = values[0];
+      value_type hi = values[0];
+      for (Index_type k = 1; k < length; ++k) {
+        lo = values[k] < lo ? values[k] : lo;
+        hi = values[k] > hi ? values[k] : hi;
+      }
+      m_first = lo;
+      storage->words.assign(
+          (hi - lo) / detail::bitmap_word_bits + 1, 0);
+      for (Index_type k = 0; k < length; ++k) {
+        const Index_type bit = values[k] - lo;
+        storage->words[bit / detail::bitmap_word_bits] |=
+            std::uint64_t(1) << (bit % detail::bitmap_word_bits);
+      }
+    }
+    init(storage);
+  }
+
+  void init(const std::shared_ptr<detail::BitmapStorage>& storage)
+  {
+    detail::bitmapBuildRank(*storage);
+    m_storage = storage;
+    m_words = m_storage->words.data();
+    m_num_words = m_storage->words.size();
+    m_size = m_storage->rank.back();
+  }
+
+  //! membership bits and rank directory
+  std::shared_ptr<const detail::BitmapStorage> m_storage;
+  //! words of m_storage, for the traversals
+  const std::uint64_t* m_words;
+  Index_type m_num_words;
+  //! index of bit 0
+  value_type m_first;
+  //! number of indices in the segment
+  Index_type m_size;
+};
+
+//! alias for a TypedBitmapSegment with storage type @Index_type
+using BitmapSegment = TypedBitmapSegment<Index_type>;
+
+namespace detail
+{
+
+/*!
+ * Call body for each index of word w of seg, running a full word as a
+ * contiguous loop and scanning the set bits of any other word.
+ */
+template <typename T, typename Body>
+RAJA_INLINE void bitmapForEachInWord(const TypedBitmapSegment<T>& seg,
+                                     Index_type w,
+                                     Body&& body)
+{
+  const std::uint64_t word = seg.words()[w];
+  const T base = seg.wordBase(w);
+  if (word == ~std::uint64_t(0)) {
+    for (Index_type j = 0; j < bitmap_word_bits; ++j) {
+      body(static_cast<T>(base + j));
+    }
+  } else {
+    bitmapWordForEach(word, base, body);
+  }
+}
+
+/*!
+ * Loop body over the word numbers [0, num_words()) of a bitmap segment,
+ * running the wrapped body on the indices of each word. Back-ends share
+ * out whole words by running it with their own policy over a range of
+ * word numbers; each thread's copy privatizes the wrapped body.
+ */
+template <typename T, typename Body>
+struct BitmapWordBody {
+  TypedBitmapSegment<T> seg;
+  Body body;
+
+  void operator()(Index_type w) const { bitmapForEachInWord(seg, w, body); }
+};
+
+//! Grain or chunk size of a policy, in words; 0 (automatic) is kept.
+constexpr std::size_t bitmapWordGrain(std::size_t grain)
+{
+  return grain == 0 ? 0
+                    : (grain > static_cast<std::size_t>(bitmap_word_bits)
+                           ? grain / bitmap_word_bits
+                           : 1);
+}
+
+}  // end namespace detail
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,248 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the block list segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_BlockListSegment_HPP
+#define RAJA_BlockListSegment_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/defines.hpp"
+#include "RAJA/util/types.hpp"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing a list of blocks of BlockSize consecutive
+ *         indices, stored as the first index of each block.
+ *
+ *         A block list segment takes sizeof(T) bytes per block instead of
+ *         per index, and its forall back-ends run a contiguous inner loop
+ *         over each block, which is vectorized under simd_exec, while the
+ *         blocks themselves may be any selection.
+ *
+ *         The forall back-ends for sequential, loop, simd and OpenMP
+ *         worksharing execution loop over the blocks; OpenMP shares out
+ *         whole blocks. Other back-ends use the random access iterator.
+ *
+ *         The block starts are immutable and shared by copies of the
+ *         segment. The segment is host only.
+ *
+ ******************************************************************************
+ */
+template <typename T, Index_type BlockSize>
+class TypedBlockListSegment
+{
+  static_assert(BlockSize > 0, "block size must be positive");
+
+public:
+  //! value type of the indices
+  using value_type = T;
+
+  //! number of indices per block
+  static constexpr Index_type block_size = BlockSize;
+
+  //! random access iterator over the indices of the blocks in turn
+  class iterator
+  {
+  public:
+    using value_type = T;
+    using difference_type = Index_type;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    iterator() : m_starts(nullptr), m_pos(0) {}
+
+    iterator(const value_type* starts, Index_type pos)
+        : m_starts(starts), m_pos(pos)
+    {
+    }
+
+    value_type operator*() const { return (*this)[0]; }
+
+    value_type operator[](difference_type rhs) const
+    {
+      const Index_type pos = m_pos + rhs;
+      return static_cast<value_type>(m_starts[pos / BlockSize]
+                                     + pos % BlockSize);
+    }
+
+    bool operator==(const iterator& rhs) const { return m_pos == rhs.m_pos; }
+    bool operator!=(const iterator& rhs) const { return m_pos != rhs.m_pos; }
+    bool operator<(const iterator& rhs) const { return m_pos < rhs.m_pos; }
+    bool operator>(const iterator& rhs) const { return m_pos > rhs.m_pos; }
+    bool operator<=(const iterator& rhs) const { return m_pos <= rhs.m_pos; }
+    bool operator>=(const iterator& rhs) const { return m_pos >= rhs.m_pos; }
+
+    iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    iterator& operator+=(difference_type rhs)
+    {
+      m_pos += rhs;
+      return *this;
+    }
+    iterator& operator-=(difference_type rhs)
+    {
+      m_pos -= rhs;
+      return *this;
+    }
+    iterator operator+(difference_type rhs) const
+    {
+      return iterator(m_starts, m_pos + rhs);
+    }
+    iterator operator-(difference_type rhs) const
+    {
+      return iterator(m_starts, m_pos - rhs);
+    }
+    friend iterator operator+(difference_type lhs, const iterator& rhs)
+    {
+      return rhs + lhs;
+    }
+    difference_type operator-(const iterator& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+  private:
+    const value_type* m_starts;
+    Index_type m_pos;
+  };
+
+  //! prevent compiler from providing a default constructor
+  TypedBlockListSegment() = delete;
+
+  ///
+  /// \brief Construct block list segment from given array of the first
+  ///        index of each block, with specified number of blocks.
+  ///
+  TypedBlockListSegment(const value_type* block_starts, Index_type num_blocks)
+  {
+    init(block_starts, num_blocks > 0 ? num_blocks : 0);
+  }
+
+  ///
+  /// Construct block list segment from arbitrary object holding the first
+  /// index of each block.
+  ///
+  /// The object must provide methods: begin(), end(), size().
+  ///
+  template <typename Container>
+  explicit TypedBlockListSegment(const Container& block_starts)
+  {
+    init(block_starts.begin(), block_starts.size());
+  }
+
+  //! accessor to get the begin iterator for a TypedBlockListSegment
+  iterator begin() const { return iterator(m_starts, 0); }
+
+  //! accessor to get the end iterator for a TypedBlockListSegment
+  iterator end() const { return iterator(m_starts, size()); }
+
+  //! accessor to retrieve the total number of elements in a
+  //! TypedBlockListSegment
+  Index_type size() const { return m_num_blocks * BlockSize; }
+
+  //! number of blocks
+  Index_type num_blocks() const { return m_num_blocks; }
+
+  //! first index of each block
+  const value_type* blockStarts() const { return m_starts; }
+
+  ///
+  /// Equality operator returns true if segments hold the same blocks in
+  /// the same order; else false.
+  ///
+  bool operator==(const TypedBlockListSegment& other) const
+  {
+    if (m_num_blocks != other.m_num_blocks) return false;
+    for (Index_type b = 0; b < m_num_blocks; ++b) {
+      if (m_starts[b] != other.m_starts[b]) return false;
+    }
+    return true;
+  }
+
+  ///
+  /// Inequality operator returns true if segments are not equal, else false.
+  ///
+  bool operator!=(const TypedBlockListSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+private:
+  template <typename Iter>
+  void init(Iter block_starts, Index_type num_blocks)
+  {
+    m_storage = std::make_shared<const std::vector<value_type>>(
+        block_starts, block_starts + num_blocks);
+    m_starts = m_storage->data();
+    m_num_blocks = num_blocks;
+  }
+
+  //! first index of each block
+  std::shared_ptr<const std::vector<value_type>> m_storage;
+  //! data of m_storage, for the traversals
+  const value_type* m_starts;
+  //! number of blocks
+  Index_type m_num_blocks;
+};
+
+template <typename T, Index_type BlockSize>
+constexpr Index_type TypedBlockListSegment<T, BlockSize>::block_size;
+
+//! alias for a TypedBlockListSegment with storage type @Index_type
+template <Index_type BlockSize>
+using BlockListSegment = TypedBlockListSegment<Index_type, BlockSize>;
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for header file include guard
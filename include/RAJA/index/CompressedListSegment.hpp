@@ -0,0 +1,538 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining the compressed list segment class.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_CompressedListSegment_HPP
+#define RAJA_CompressedListSegment_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/defines.hpp"
+#include "RAJA/util/types.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * One block of a compressed list: index k of the block is
+ *
+ *   base + stride * k + residual[k]
+ *
+ * computed modulo 2^64, with the residuals packed in width bits each
+ * starting at byte offset of the packed data.
+ */
+struct CompressedListBlock {
+  std::uint64_t base;
+  std::uint64_t stride;
+  std::uint64_t offset : 56;
+  std::uint64_t width : 8;
+};
+
+//! Widest residual that is bit-packed; wider ones are stored in 64 bits.
+constexpr std::uint32_t compressed_list_max_packed_width = 56;
+
+//! Encoded indices of a compressed list, shared by copies of the segment.
+struct CompressedListStorage {
+  std::vector<CompressedListBlock> blocks;
+  //! residuals, followed by 8 bytes of padding for the 64 bit loads
+  std::vector<unsigned char> packed;
+};
+
+RAJA_INLINE std::uint64_t compressedListMask(std::uint32_t width)
+{
+  return width >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+}
+
+/*!
+ * Residual k of a block packed in width bits. Every residual is read with
+ * one unaligned 64 bit load, so that a block decodes with the same
+ * branch-free instruction sequence for every entry. Bits are numbered from
+ * the least significant bit of the first byte (little endian).
+ */
+RAJA_INLINE std::uint64_t compressedListResidual(const unsigned char* bytes,
+                                                 Index_type k,
+                                                 std::uint32_t width,
+                                                 std::uint64_t mask)
+{
+  const std::uint64_t bit = static_cast<std::uint64_t>(k) * width;
+  std::uint64_t word;
+  std::memcpy(&word, bytes + (bit >> 3), sizeof(word));
+  return (word >> (bit & 7)) & mask;
+}
+
+//! Residual J of a group of 8 residuals of Width bits.
+template <std::uint32_t Width, std::uint32_t J>
+RAJA_INLINE std::uint64_t compressedListGroupResidual(const unsigned char* group)
+{
+  std::uint64_t word;
+  std::memcpy(&word, group + (J * Width) / 8, sizeof(word));
+  return (word >> ((J * Width) & 7)) & compressedListMask(Width);
+}
+
+/*!
+ * Decode n indices of a block with residuals of Width bits. A group of 8
+ * residuals starts on a byte boundary, so that with the group unrolled all
+ * loads and shifts have constant offsets.
+ */
+template <std::uint32_t Width, typename T>
+RAJA_INLINE void decodeCompressedListBlock(const unsigned char* bytes,
+                                           std::uint64_t base,
+                                           std::uint64_t stride,
+                                           Index_type n,
+                                           T* out)
+{
+  Index_type k = 0;
+  for (; k + 8 <= n; k += 8) {
+    const unsigned char* group = bytes + (k / 8) * Width;
+    const std::uint64_t b = base + stride * static_cast<std::uint64_t>(k);
+    T* o = out + k;
+    o[0] = static_cast<T>(b + compressedListGroupResidual<Width, 0>(group));
+    o[1] = static_cast<T>(b + stride
+                          + compressedListGroupResidual<Width, 1>(group));
+    o[2] = static_cast<T>(b + 2 * stride
+                          + compressedListGroupResidual<Width, 2>(group));
+    o[3] = static_cast<T>(b + 3 * stride
+                          + compressedListGroupResidual<Width, 3>(group));
+    o[4] = static_cast<T>(b + 4 * stride
+                          + compressedListGroupResidual<Width, 4>(group));
+    o[5] = static_cast<T>(b + 5 * stride
+                          + compressedListGroupResidual<Width, 5>(group));
+    o[6] = static_cast<T>(b + 6 * stride
+                          + compressedListGroupResidual<Width, 6>(group));
+    o[7] = static_cast<T>(b + 7 * stride
+                          + compressedListGroupResidual<Width, 7>(group));
+  }
+  const std::uint64_t mask = compressedListMask(Width);
+  for (; k < n; ++k) {
+    out[k] = static_cast<T>(base + stride * static_cast<std::uint64_t>(k)
+                            + compressedListResidual(bytes, k, Width, mask));
+  }
+}
+
+/*!
+ * Dispatch decoding of a block to the version for its width, for widths up
+ * to MaxWidth; wider residuals are decoded with a run-time width.
+ */
+template <std::uint32_t MaxWidth>
+struct CompressedListDecoder {
+  template <typename T>
+  RAJA_INLINE static void decode(const CompressedListBlock& blk,
+                                 const unsigned char* bytes,
+                                 Index_type n,
+                                 T* out)
+  {
+    if (blk.width == MaxWidth) {
+      decodeCompressedListBlock<MaxWidth>(bytes, blk.base, blk.stride, n, out);
+    } else {
+      CompressedListDecoder<MaxWidth - 1>::decode(blk, bytes, n, out);
+    }
+  }
+};
+
+template <>
+struct CompressedListDecoder<0> {
+  template <typename T>
+  RAJA_INLINE static void decode(const CompressedListBlock& blk,
+                                 const unsigned char* bytes,
+                                 Index_type n,
+                                 T* out)
+  {
+    const std::uint32_t width = blk.width;
+    const std::uint64_t mask = compressedListMask(width);
+    RAJA_SIMD
+    for (Index_type k = 0; k < n; ++k) {
+      out[k] = static_cast<T>(blk.base
+                              + blk.stride * static_cast<std::uint64_t>(k)
+                              + compressedListResidual(bytes, k, width, mask));
+    }
+  }
+};
+
+//! Widest residual with a decoder for its width.
+constexpr std::uint32_t compressed_list_max_fixed_width = 16;
+
+//! Number of bits needed for residuals up to max_residual.
+RAJA_INLINE std::uint32_t compressedListWidth(std::uint64_t max_residual)
+{
+  std::uint32_t width = 0;
+  while (max_residual != 0) {
+    ++width;
+    max_residual >>= 1;
+  }
+  return width > compressed_list_max_packed_width ? 64 : width;
+}
+
+/*!
+ * Choose base, stride and width for the n indices of a block. Two strides
+ * are tried, zero and the mean step from the first to the last index, and
+ * the one giving the narrower residuals is kept; consecutive indices and
+ * other arithmetic progressions need no residual bits at all.
+ */
+template <typename Iter>
+void fitCompressedListBlock(Iter values, Index_type n, CompressedListBlock& blk)
+{
+  const std::int64_t first = static_cast<std::int64_t>(values[0]);
+  const std::int64_t last = static_cast<std::int64_t>(values[n - 1]);
+  const std::int64_t strides[2] = {n > 1 ? (last - first) / (n - 1) : 0, 0};
+
+  blk.width = 65;
+  for (std::int64_t stride : strides) {
+    std::int64_t lo = first;
+    for (Index_type k = 1; k < n; ++k) {
+      const std::int64_t v = static_cast<std::int64_t>(values[k]) - stride * k;
+      lo = v < lo ? v : lo;
+    }
+    std::uint64_t max_residual = 0;
+    for (Index_type k = 0; k < n; ++k) {
+      const std::uint64_t r = static_cast<std::uint64_t>(
+          static_cast<std::int64_t>(values[k]) - stride * k - lo);
+      max_residual = r > max_residual ? r : max_residual;
+    }
+    const std::uint32_t width = compressedListWidth(max_residual);
+    if (width < blk.width) {
+      blk.base = static_cast<std::uint64_t>(lo);
+      blk.stride = static_cast<std::uint64_t>(stride);
+      blk.width = width;
+    }
+  }
+}
+
+//! Encode length indices in blocks of block_size.
+template <typename Iter>
+std::shared_ptr<const CompressedListStorage> compressList(Iter values,
+                                                          Index_type length,
+                                                          Index_type block_size)
+{
+  std::shared_ptr<CompressedListStorage> storage =
+      std::make_shared<CompressedListStorage>();
+  const Index_type num_blocks = (length + block_size - 1) / block_size;
+  storage->blocks.resize(num_blocks);
+
+  std::uint64_t bytes = 0;
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type first = b * block_size;
+    const Index_type n =
+        length - first < block_size ? length - first : block_size;
+    CompressedListBlock& blk = storage->blocks[b];
+    fitCompressedListBlock(values + first, n, blk);
+    blk.offset = bytes;
+    bytes += (static_cast<std::uint64_t>(n) * blk.width + 7) / 8;
+  }
+  storage->packed.assign(bytes + sizeof(std::uint64_t), 0);
+
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const CompressedListBlock& blk = storage->blocks[b];
+    if (blk.width == 0) continue;
+    const Index_type first = b * block_size;
+    const Index_type n =
+        length - first < block_size ? length - first : block_size;
+    unsigned char* out = storage->packed.data() + blk.offset;
+    for (Index_type k = 0; k < n; ++k) {
+      const std::uint64_t r =
+          static_cast<std::uint64_t>(
+              static_cast<std::int64_t>(values[first + k]))
+          - blk.base - blk.stride * static_cast<std::uint64_t>(k);
+      const std::uint64_t bit = static_cast<std::uint64_t>(k) * blk.width;
+      std::uint64_t word;
+      std::memcpy(&word, out + (bit >> 3), sizeof(word));
+      word |= r << (bit & 7);
+      std::memcpy(out + (bit >> 3), &word, sizeof(word));
+    }
+  }
+  return storage;
+}
+
+}  // end namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Class representing an arbitrary collection of indices stored in
+ *         compressed form.
+ *
+ *         The indices are split into blocks of block_size. Each block is
+ *         stored as a base, a stride and a bit-packed residual per index,
+ *         so that runs of consecutive indices, and other arithmetic
+ *         progressions, take no space beyond the block header and sorted
+ *         lists with small gaps take a few bits per index instead of
+ *         sizeof(T) bytes. This cuts the memory traffic for the indices of
+ *         indirect loops.
+ *
+ *         The forall back-ends for sequential, loop, simd and OpenMP
+ *         worksharing execution decode one block at a time into a buffer
+ *         on the stack; other back-ends use the random access iterator,
+ *         which decodes each index on its own.
+ *
+ *         The encoded indices are immutable and shared by copies of the
+ *         segment. The segment is host only.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class TypedCompressedListSegment
+{
+public:
+  //! value type of the indices
+  using value_type = T;
+
+  //! number of indices per block
+  static constexpr Index_type block_size = 128;
+
+  //! random access iterator decoding one index per dereference
+  class iterator
+  {
+  public:
+    using value_type = T;
+    using difference_type = Index_type;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    iterator() : m_blocks(nullptr), m_packed(nullptr), m_pos(0) {}
+
+    iterator(const detail::CompressedListBlock* blocks,
+             const unsigned char* packed,
+             Index_type pos)
+        : m_blocks(blocks), m_packed(packed), m_pos(pos)
+    {
+    }
+
+    value_type operator*() const { return (*this)[0]; }
+
+    value_type operator[](difference_type rhs) const
+    {
+      const Index_type pos = m_pos + rhs;
+      const Index_type k = pos % block_size;
+      const detail::CompressedListBlock& blk = m_blocks[pos / block_size];
+      const std::uint64_t residual =
+          blk.width == 0
+              ? 0
+              : detail::compressedListResidual(
+                    m_packed + blk.offset,
+                    k,
+                    blk.width,
+                    detail::compressedListMask(blk.width));
+      return static_cast<value_type>(
+          blk.base + blk.stride * static_cast<std::uint64_t>(k) + residual);
+    }
+
+    bool operator==(const iterator& rhs) const { return m_pos == rhs.m_pos; }
+    bool operator!=(const iterator& rhs) const { return m_pos != rhs.m_pos; }
+    bool operator<(const iterator& rhs) const { return m_pos < rhs.m_pos; }
+    bool operator>(const iterator& rhs) const { return m_pos > rhs.m_pos; }
+    bool operator<=(const iterator& rhs) const { return m_pos <= rhs.m_pos; }
+    bool operator>=(const iterator& rhs) const { return m_pos >= rhs.m_pos; }
+
+    iterator& operator++()
+    {
+      ++m_pos;
+      return *this;
+    }
+    iterator& operator--()
+    {
+      --m_pos;
+      return *this;
+    }
+    iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++m_pos;
+      return tmp;
+    }
+    iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --m_pos;
+      return tmp;
+    }
+
+    iterator& operator+=(difference_type rhs)
+    {
+      m_pos += rhs;
+      return *this;
+    }
+    iterator& operator-=(difference_type rhs)
+    {
+      m_pos -= rhs;
+      return *this;
+    }
+    iterator operator+(difference_type rhs) const
+    {
+      return iterator(m_blocks, m_packed, m_pos + rhs);
+    }
+    iterator operator-(difference_type rhs) const
+    {
+      return iterator(m_blocks, m_packed, m_pos - rhs);
+    }
+    friend iterator operator+(difference_type lhs, const iterator& rhs)
+    {
+      return rhs + lhs;
+    }
+    difference_type operator-(const iterator& rhs) const
+    {
+      return m_pos - rhs.m_pos;
+    }
+
+  private:
+    const detail::CompressedListBlock* m_blocks;
+    const unsigned char* m_packed;
+    Index_type m_pos;
+  };
+
+  //! prevent compiler from providing a default constructor
+  TypedCompressedListSegment() = delete;
+
+  ///
+  /// \brief Construct compressed list segment from given array with
+  ///        specified length.
+  ///
+  TypedCompressedListSegment(const value_type* values, Index_type length)
+      : m_size(length > 0 ? length : 0)
+  {
+    init(values);
+  }
+
+  ///
+  /// Construct compressed list segment from arbitrary object holding
+  /// indices, e.g. a list segment.
+  ///
+  /// The object must provide methods: begin(), end(), size().
+  ///
+  template <typename Container>
+  explicit TypedCompressedListSegment(const Container& container)
+      : m_size(container.size())
+  {
+    init(container.begin());
+  }
+
+  //! accessor to get the begin iterator for a TypedCompressedListSegment
+  iterator begin() const { return iterator(m_blocks, m_packed, 0); }
+
+  //! accessor to get the end iterator for a TypedCompressedListSegment
+  iterator end() const { return iterator(m_blocks, m_packed, m_size); }
+
+  //! accessor to retrieve the total number of elements in a
+  //! TypedCompressedListSegment
+  Index_type size() const { return m_size; }
+
+  //! number of blocks of block_size indices, the last one possibly partial
+  Index_type num_blocks() const
+  {
+    return (m_size + block_size - 1) / block_size;
+  }
+
+  ///
+  /// Write the indices of block b to out, which must have room for
+  /// block_size values, and return how many were written.
+  ///
+  Index_type decodeBlock(Index_type b, value_type* out) const
+  {
+    const detail::CompressedListBlock blk = m_blocks[b];
+    const Index_type first = b * block_size;
+    const Index_type n =
+        m_size - first < block_size ? m_size - first : block_size;
+
+    if (blk.width == 0) {
+      RAJA_SIMD
+      for (Index_type k = 0; k < n; ++k) {
+        out[k] = static_cast<value_type>(
+            blk.base + blk.stride * static_cast<std::uint64_t>(k));
+      }
+    } else {
+      detail::CompressedListDecoder<detail::compressed_list_max_fixed_width>::
+          decode(blk, m_packed + blk.offset, n, out);
+    }
+    return n;
+  }
+
+  //! number of bytes used to store the encoded indices
+  std::size_t storage_bytes() const
+  {
+    return m_storage->blocks.size() * sizeof(detail::CompressedListBlock)
+           + m_storage->packed.size();
+  }
+
+  ///
+  /// Equality operator returns true if segments hold the same indices in
+  /// the same order; else false.
+  ///
+  bool operator==(const TypedCompressedListSegment& other) const
+  {
+    if (m_size != other.m_size) return false;
+    if (m_storage == other.m_storage) return true;
+    value_type lhs[block_size];
+    value_type rhs[block_size];
+    for (Index_type b = 0; b < num_blocks(); ++b) {
+      const Index_type n = decodeBlock(b, lhs);
+      other.decodeBlock(b, rhs);
+      for (Index_type k = 0; k < n; ++k) {
+        if (lhs[k] != rhs[k]) return false;
+      }
+    }
+    return true;
+  }
+
+  ///
+  /// Inequality operator returns true if segments are not equal, else false.
+  ///
+  bool operator!=(const TypedCompressedListSegment& other) const
+  {
+    return (!(*this == other));
+  }
+
+private:
+  template <typename Iter>
+  void init(Iter values)
+  {
+    m_storage = detail::compressList(values, m_size, block_size);
+    m_blocks = m_storage->blocks.data();
+    m_packed = m_storage->packed.data();
+  }
+
+  //! encoded indices
+  std::shared_ptr<const detail::CompressedListStorage> m_storage;
+  //! block headers and residuals of m_storage, for decoding
+  const detail::CompressedListBlock* m_blocks;
+  const unsigned char* m_packed;
+  //! size of compressed list segment
+  Index_type m_size;
+};
+
+template <typename T>
+constexpr Index_type TypedCompressedListSegment<T>::block_size;
+
+//! alias for a TypedCompressedListSegment with storage type @Index_type
+using CompressedListSegment = TypedCompressedListSegment<Index_type>;
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for header file include guard
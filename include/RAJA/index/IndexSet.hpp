@@ -28,9 +28,13 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/index/BitmapSegment.hpp"
+#include "RAJA/index/BlockListSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
@@ -39,6 +43,10 @@
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/concepts.hpp"
 
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace RAJA
 {
 
@@ -112,6 +120,8 @@ public:
     }
     // mark all as not owned by us
     owner.resize(num, 0);
+    m_seg_interval_begin = c.m_seg_interval_begin;
+    m_seg_interval_end = c.m_seg_interval_end;
   }
 
   //! Copy-assignment operator for index set
@@ -145,6 +155,8 @@ public:
     using std::swap;
     swap(data, other.data);
     swap(owner, other.owner);
+    swap(m_seg_interval_begin, other.m_seg_interval_begin);
+    swap(m_seg_interval_end, other.m_seg_interval_end);
   }
 
   ///
@@ -190,7 +202,7 @@ public:
   {
     if (getSegmentTypes()[segid] == T0_TypeId) {
       Index_type offset = getSegmentOffsets()[segid];
-      return *reinterpret_cast<P0 const *>(data[offset]);
+      return *reinterpret_cast<P0 *>(data[offset]);
     }
     return PARENT::template getSegment<P0>(segid);
   }
@@ -311,6 +323,27 @@ public:
     push_internal(new Tnew(val), PUSH_FRONT, PUSH_COPY);
   }
 
+  //! Move segment to back end of index set, e.g. without copying the
+  //! indices of an owning list segment.
+  template <typename Tnew,
+            typename = typename std::enable_if<
+                std::is_same<Tnew, typename std::decay<Tnew>::type>::value>::
+                type>
+  RAJA_INLINE void push_back(Tnew &&val)
+  {
+    push_internal(new Tnew(std::move(val)), PUSH_BACK, PUSH_COPY);
+  }
+
+  //! Move segment to front end of index set.
+  template <typename Tnew,
+            typename = typename std::enable_if<
+                std::is_same<Tnew, typename std::decay<Tnew>::type>::value>::
+                type>
+  RAJA_INLINE void push_front(Tnew &&val)
+  {
+    push_internal(new Tnew(std::move(val)), PUSH_FRONT, PUSH_COPY);
+  }
+
   //! Return total length -- sum of lengths of all segments
   RAJA_INLINE size_t getLength() const
   {
@@ -491,6 +524,10 @@ public:
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
+    if (interval_id >= m_seg_interval_begin.size()) {
+      m_seg_interval_begin.resize(interval_id + 1, 0);
+      m_seg_interval_end.resize(interval_id + 1, 0);
+    }
     m_seg_interval_begin[interval_id] = begin;
     m_seg_interval_end[interval_id] = end;
   }
@@ -507,6 +544,9 @@ public:
     return m_seg_interval_end[interval_id];
   }
 
+  //! get number of segment intervals; ids are [0, getNumSegmentIntervals())
+  size_t getNumSegmentIntervals() const { return m_seg_interval_begin.size(); }
+
 protected:
   //! Returns the mapping of  segment_index -> segment_type
   RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
@@ -609,6 +649,7 @@ public:
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    m_dep_graph = c.m_dep_graph;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,6 +660,7 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
   }
 
 protected:
@@ -741,6 +783,44 @@ public:
   //! Return the number of elements in the range.
   Index_type size() const { return getNumSegments(); }
 
+  //!  @name Segment dependency graph methods
+  ///
+  /// A dependency graph node is attached to every segment for use with
+  /// task-graph segment iteration policies (e.g., omp_taskgraph_segit).
+  /// Build the graph after all segments have been added: call
+  /// initDependencyGraph(), set each node's reload value and forward
+  /// dependencies, then call finalizeDependencyGraph(). The graph must be
+  /// acyclic.
+  ///
+  void initDependencyGraph()
+  {
+    m_dep_graph.clear();
+    m_dep_graph.resize(segment_types.size());
+  }
+
+  //! Arm all semaphores with their reload values.
+  void finalizeDependencyGraph()
+  {
+    for (auto &node : m_dep_graph) {
+      node.reset();
+    }
+  }
+
+  //! Return true if a dependency graph covers every segment.
+  bool dependencyGraphSet() const
+  {
+    return !m_dep_graph.empty() && m_dep_graph.size() == segment_types.size();
+  }
+
+  //! Get dependency graph node for given segment.
+  DepGraphNode *getDepGraphNode(int segid) { return &m_dep_graph[segid]; }
+
+  //! Get dependency graph node for given segment.
+  const DepGraphNode *getDepGraphNode(int segid) const
+  {
+    return &m_dep_graph[segid];
+  }
+
 private:
   //! Vector of segment types:    seg_index -> seg_type
   RAJA::RAJAVec<Index_type> segment_types;
@@ -754,6 +834,9 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Dependency graph nodes:    seg_index -> node
+  std::vector<DepGraphNode> m_dep_graph;
 };
 
 
@@ -40,10 +40,13 @@ namespace RAJA
  * \brief Initialize index set with aligned Ranges and List segments from
  *        array of indices with given length.
  *
- *        Specifically, Range segments will be greater than RANGE_MIN_LENGTH
- *        and starting index and length of each range segment will be
- *        multiples of RANGE_ALIGN. These constants are defined in the
- *        RAJA config.hpp header file.
+ *        Each run of consecutive indices becomes a Range segment from its
+ *        first index that is a multiple of RANGE_ALIGN to its end, unless
+ *        that index ends the run; all other indices are gathered into List
+ *        segments. If this does not shrink the description of
+ *        the indices enough, or the array has no more than RANGE_MIN_LENGTH
+ *        entries, a single List segment is built. These constants are
+ *        defined in the RAJA config.hpp header file.
  *
  *        Routine does no error-checking on argements and assumes Index_type
  *        array contains valid indices.
@@ -52,9 +55,60 @@ namespace RAJA
  *
  ******************************************************************************
  */
-void buildTypedIndexSetAligned(IndexSet& hiset,
-                               const Index_type* const indices_in,
-                               Index_type length);
+void buildIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& hiset,
+    const Index_type* const indices_in,
+    Index_type length);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Initialize index set with aligned Ranges, List segments and Block
+ *        List segments from array of indices with given length.
+ *
+ *        Segments are first found as by the version above. Range segments
+ *        of at most 32 whole blocks of BlockSize indices starting at a
+ *        multiple of BlockSize, and such blocks within List segments,
+ *        then become Block List segments, merging neighbouring blocks into
+ *        one segment; a single run of consecutive indices stays a Range.
+ *        The indices are visited in the same order as in the array. If
+ *        this does not shrink the description of the indices enough, a
+ *        single List segment is built.
+ *
+ *        Defined for BlockSize 4, 8, 16 and 32.
+ *
+ * Note: Method assumes TypedIndexSet reference refers to an empty index set.
+ *
+ ******************************************************************************
+ */
+template <Index_type BlockSize>
+void buildIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::BlockListSegment<BlockSize>>& hiset,
+    const Index_type* const indices_in,
+    Index_type length);
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Parallel version of buildIndexSetAligned, building the same index
+ *        set.
+ *
+ *        The index array is split into one chunk per OpenMP thread. The
+ *        chunks are scanned in parallel for the Range segments they
+ *        contain, with a short serial pass in between to carry a Range
+ *        across chunk boundaries, and the List segments copy their indices
+ *        in parallel. Without OpenMP the same steps run on one thread.
+ *
+ * Note: Method assumes TypedIndexSet reference refers to an empty index set.
+ *
+ ******************************************************************************
+ */
+void buildIndexSetAlignedParallel(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& hiset,
+    const Index_type* const indices_in,
+    Index_type length);
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -75,7 +129,8 @@ void buildTypedIndexSetAligned(IndexSet& hiset,
  * Initialize lock-free "block" index set (planar division).
  *
  * The method chunks a fastDim x midDim x slowDim mesh into blocks that can
- * be dependency-scheduled, removing need for lock constructs.
+ * be dependency-scheduled, removing need for lock constructs. The index
+ * set's dependency graph is set up for use with omp_taskgraph_segit.
  *
  * Note: Method assumes TypedIndexSet reference refers to an empty index set.
  *
@@ -85,16 +140,18 @@ void buildLockFreeBlockIndexset(
     RAJA::TypedIndexSet<RAJA::RangeSegment,
                         RAJA::ListSegment,
                         RAJA::RangeStrideSegment>& iset,
-    int fastDim,
-    int midDim,
-    int slowDim);
+    Index_type fastDim,
+    Index_type midDim,
+    Index_type slowDim);
 
 /*
  ******************************************************************************
  *
  * Build Lock-free "color" index set. The domain-set is colored based on
  * connectivity to the range-set. All elements in each segment are
- * independent, and no two segments can be executed in parallel.
+ * independent. Segments sharing range entities must not be executed in
+ * parallel; the index set's dependency graph orders them for use with
+ * omp_taskgraph_segit.
  *
  * Note: Method assumes TypedIndexSet reference refers to an empty index set.
  *
@@ -111,6 +168,35 @@ void buildLockFreeColorIndexset(
     Index_type* elemPermutation = 0l,
     Index_type* ielemPermutation = 0l);
 
+/*
+ ******************************************************************************
+ *
+ * Parallel version of buildLockFreeColorIndexset, building an index set of
+ * the same form with its dependency graph.
+ *
+ * The domain-set is colored speculatively in parallel, a block of
+ * consecutive elements per thread with conflicts between blocks colored
+ * again, and elements are then moved from colors larger than the mean to
+ * smaller ones, so that the colors have similar sizes. The colors depend
+ * on the connectivity only, not on the number of threads. Unlike the
+ * serial builder, range entities may be shared by any number of domain
+ * elements.
+ *
+ * Note: Method assumes TypedIndexSet reference refers to an empty index set.
+ *
+ ******************************************************************************
+ */
+void buildLockFreeColorIndexsetParallel(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::RangeStrideSegment>& iset,
+    Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    Index_type* elemPermutation = 0l,
+    Index_type* ielemPermutation = 0l);
+
 }  // closing brace for RAJA namespace
 
 #endif  // closing endif for header file include guard
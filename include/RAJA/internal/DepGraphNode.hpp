@@ -32,9 +32,11 @@
 #include "RAJA/util/types.hpp"
 
 #include <atomic>
+#include <condition_variable>
 #include <cstdlib>
 #include <iosfwd>
-#include <thread>
+#include <mutex>
+#include <vector>
 
 namespace RAJA
 {
@@ -45,27 +47,41 @@ namespace RAJA
  * \brief  Class defining a simple semephore-based data structure for
  *         managing a node in a dependency graph.
  *
+ *         A node may have any number of forward dependencies. The task
+ *         that satisfies the last incoming dependency of a node is told so
+ *         by satisfyOne(), so a scheduler can launch the node directly
+ *         instead of having a thread wait for it.
+ *
  ******************************************************************************
  */
-class RAJA_ALIGNED_ATTR(256) DepGraphNode
+class DepGraphNode
 {
 public:
   ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
-  ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
+  /// Default ctor initializes node to default state.
   ///
-  static const int _MaxDepTasks_ = 8;
+  DepGraphNode()
+      : m_semaphore_value(0), m_semaphore_reload_value(0), m_has_waiter(false)
+  {
+  }
 
   ///
-  /// Default ctor initializes node to default state.
+  /// Copy ctor copies dependency information and current semaphore value.
   ///
-  DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
+  DepGraphNode(const DepGraphNode& other)
+      : m_semaphore_value(other.m_semaphore_value.load()),
+        m_semaphore_reload_value(other.m_semaphore_reload_value),
+        m_dep_task(other.m_dep_task),
+        m_has_waiter(false)
+  {
+  }
+
+  DepGraphNode& operator=(const DepGraphNode& other)
   {
+    m_semaphore_value.store(other.m_semaphore_value.load());
+    m_semaphore_reload_value = other.m_semaphore_reload_value;
+    m_dep_task = other.m_dep_task;
+    return *this;
   }
 
   ///
@@ -80,38 +96,62 @@ public:
   ///
   int& semaphoreReloadValue() { return m_semaphore_reload_value; }
 
+  int semaphoreReloadValue() const { return m_semaphore_reload_value; }
+
   ///
   /// Ready this task to be used again
   ///
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency. Returns true if this satisfied the
+  /// last one, i.e. the task has just become ready to execute.
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
+    int value = m_semaphore_value.load();
+    while (value > 0) {
+      if (m_semaphore_value.compare_exchange_weak(value, value - 1)) {
+        if (value == 1) {
+          if (m_has_waiter.load()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_ready.notify_all();
+          }
+          return true;
+        }
+        return false;
+      }
     }
+    return false;
   }
 
   ///
-  /// Wait for all dependencies to be satisfied
+  /// Wait for all dependencies to be satisfied. Polls briefly, then blocks
+  /// until the last dependency is satisfied.
   ///
   void wait()
   {
-    while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
-      std::this_thread::yield();
+    for (int spin = 0; spin < s_spin_count; ++spin) {
+      if (m_semaphore_value.load() <= 0) return;
     }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_has_waiter.store(true);
+    m_ready.wait(lock, [this] { return m_semaphore_value.load() <= 0; });
+    m_has_waiter.store(false);
   }
 
   ///
-  /// Get/set the number of "forward-dependencies" for this task; i.e., the
+  /// Get the number of "forward-dependencies" for this task; i.e., the
   /// number of external tasks that cannot execute until this task completes.
   ///
-  int& numDepTasks() { return m_num_dep_tasks; }
+  int numDepTasks() const { return static_cast<int>(m_dep_task.size()); }
+
+  ///
+  /// Add a forward dependency; task_num will not execute until this task
+  /// completes. Its semaphore reload value must count this dependency.
+  ///
+  void addDepTask(int task_num) { m_dep_task.push_back(task_num); }
 
   ///
   /// Get/set the forward dependency task number associated with the given
@@ -120,16 +160,27 @@ public:
   ///
   int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
 
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
+
   ///
   /// Print task graph object node data to given output stream.
   ///
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
-  int m_num_dep_tasks;
-  int m_semaphore_reload_value;
+  //! Number of polls of the semaphore before wait() blocks.
+  static const int s_spin_count = 4096;
+
   std::atomic<int> m_semaphore_value;
+  // keep semaphores of neighboring nodes in an array on separate cache lines
+  char m_pad[RAJA::DATA_ALIGN - sizeof(std::atomic<int>)];
+
+  int m_semaphore_reload_value;
+  std::vector<int> m_dep_task;
+
+  std::atomic<bool> m_has_waiter;
+  std::mutex m_mutex;
+  std::condition_variable m_ready;
 };
 
 }  // closing brace for RAJA namespace
@@ -29,6 +29,7 @@
 #include "RAJA/config.hpp"
 #include "RAJA/policy/atomic_auto.hpp"
 #include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/atomic_ordered.hpp"
 #include "RAJA/util/defines.hpp"
 
 namespace RAJA
@@ -66,6 +67,11 @@ namespace atomic
  *
  *   builtin_atomic    -- Use the (nonstandard) __sync_fetch_and_XXX functions
  *
+ *   ordered_atomic<Order> -- Use the __atomic_XXX functions with the given
+ *                        memory_order; relaxed_atomic, acquire_atomic,
+ *                        release_atomic, acq_rel_atomic and seq_cst_atomic
+ *                        name its instances
+ *
  *   seq_atomic        -- Non-atomic, does an unprotected (raw) operation
  *
  *
@@ -83,6 +89,7 @@ namespace atomic
  * The implementation code lives in:
  * RAJA/policy/atomic_auto.hpp     -- for auto_atomic
  * RAJA/policy/atomic_builtin.hpp  -- for builtin_atomic
+ * RAJA/policy/atomic_ordered.hpp  -- for ordered_atomic
  * RAJA/policy/XXX/atomic.hpp      -- for omp_atomic, cuda_atomic, etc.
  *
  */
@@ -282,6 +289,32 @@ RAJA_INLINE RAJA_HOST_DEVICE T atomicCAS(T volatile *acc, T compare, T value)
   return RAJA::atomic::atomicCAS(Policy{}, acc, compare, value);
 }
 
+
+/*!
+ * @brief Atomic load, provided by the ordered_atomic policies
+ * @param acc Pointer to location to load
+ * @return Returns value at *acc
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T atomicLoad(T volatile *acc)
+{
+  return RAJA::atomic::atomicLoad(Policy{}, acc);
+}
+
+
+/*!
+ * @brief Atomic store, provided by the ordered_atomic policies
+ * @param acc Pointer to location to store value
+ * @param value Value to store to *acc
+ */
+RAJA_SUPPRESS_HD_WARN
+template <typename Policy, typename T>
+RAJA_INLINE RAJA_HOST_DEVICE void atomicStore(T volatile *acc, T value)
+{
+  RAJA::atomic::atomicStore(Policy{}, acc, value);
+}
+
 /*!
  * \brief Atomic wrapper object
  *
@@ -0,0 +1,305 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the batched launch of many small
+ *          loops as one forall.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_batch_HPP
+#define RAJA_batch_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/types.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Type-erased loop of a LoopBatch.
+struct BatchLoopBase {
+  //! Copy of the loop body owned by one thread for one launch.
+  struct PrivateBody {
+    virtual ~PrivateBody() {}
+  };
+
+  virtual ~BatchLoopBase() {}
+
+  //! Execute local iterations [first, last) of the loop.
+  virtual void run(Index_type first, Index_type last) const = 0;
+
+  //! Copy the loop body, privatizing reducers it captured.
+  virtual std::unique_ptr<PrivateBody> privatize() const = 0;
+
+  //! Execute local iterations [first, last) with a copy from privatize().
+  virtual void run(const PrivateBody& priv,
+                   Index_type first,
+                   Index_type last) const = 0;
+};
+
+template <typename Segment, typename Body>
+struct BatchLoop : BatchLoopBase {
+  struct PrivateCopy : PrivateBody {
+    explicit PrivateCopy(const Body& body) : body(body) {}
+    Body body;
+  };
+
+  template <typename S, typename B>
+  BatchLoop(S&& segment, B&& body)
+      : segment(std::forward<S>(segment)), body(std::forward<B>(body))
+  {
+  }
+
+  void run(Index_type first, Index_type last) const override
+  {
+    // one copy per piece privatizes reducers captured by the body, the
+    // way forall does once per thread
+    const Body private_body = body;
+    runBody(private_body, first, last);
+  }
+
+  std::unique_ptr<PrivateBody> privatize() const override
+  {
+    return std::unique_ptr<PrivateBody>(new PrivateCopy(body));
+  }
+
+  void run(const PrivateBody& priv,
+           Index_type first,
+           Index_type last) const override
+  {
+    runBody(static_cast<const PrivateCopy&>(priv).body, first, last);
+  }
+
+  Segment segment;
+  Body body;
+
+private:
+  void runBody(const Body& private_body,
+               Index_type first,
+               Index_type last) const
+  {
+    auto begin_it = std::begin(segment);
+    for (Index_type i = first; i < last; ++i) {
+      private_body(begin_it[i]);
+    }
+  }
+};
+
+}  // end namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Collection of small, independent loops that are launched together
+ *         by RAJA::forall_batch.
+ *
+ *         Each add() stores a copy of a segment and a loop body. The batch
+ *         concatenates their iteration spaces and forall_batch cuts the
+ *         combined space into chunks of getChunkSize() iterations, so work
+ *         is balanced by iteration count rather than per loop and a chunk
+ *         may cover the end of one loop and the start of the next.
+ *
+ *         The loops must be independent of each other: they run
+ *         concurrently and in no particular order. A batch can be launched
+ *         any number of times, e.g. once per time step.
+ *
+ *         RAJA::LoopBatch batch;
+ *         for (auto& patch : boundary_patches) {
+ *           batch.add(patch.segment, [=](RAJA::Index_type i) { ... });
+ *         }
+ *         RAJA::forall_batch<RAJA::omp_parallel_for_exec>(batch);
+ *
+ ******************************************************************************
+ */
+class LoopBatch
+{
+public:
+  //! Default number of iterations per chunk of the combined space.
+  static constexpr Index_type default_chunk_size = 256;
+
+  explicit LoopBatch(Index_type chunk_size = default_chunk_size)
+      : m_chunk_size(chunk_size > 0 ? chunk_size : 1), m_offsets(1, 0)
+  {
+  }
+
+  LoopBatch(LoopBatch&&) = default;
+  LoopBatch& operator=(LoopBatch&&) = default;
+
+  //! Append loop_body over segment; empty segments are dropped.
+  template <typename Segment, typename LoopBody>
+  void add(Segment&& segment, LoopBody&& loop_body)
+  {
+    using std::begin;
+    using std::end;
+    const Index_type len = std::distance(begin(segment), end(segment));
+    if (len <= 0) return;
+
+    using loop_type =
+        detail::BatchLoop<camp::decay<Segment>, camp::decay<LoopBody>>;
+    m_loops.emplace_back(new loop_type(std::forward<Segment>(segment),
+                                       std::forward<LoopBody>(loop_body)));
+    m_offsets.push_back(m_offsets.back() + len);
+  }
+
+  //! Remove all loops.
+  void clear()
+  {
+    m_loops.clear();
+    m_offsets.assign(1, 0);
+  }
+
+  //! Number of (non-empty) loops in the batch.
+  size_t getNumLoops() const { return m_loops.size(); }
+
+  //! Combined iteration count of all loops.
+  Index_type getLength() const { return m_offsets.back(); }
+
+  Index_type getChunkSize() const { return m_chunk_size; }
+
+  Index_type getNumChunks() const
+  {
+    return (getLength() + m_chunk_size - 1) / m_chunk_size;
+  }
+
+  //! Execute combined iterations [first, last), crossing loops as needed.
+  void run(Index_type first, Index_type last) const
+  {
+    // last loop starting at or before first; empty loops are never stored
+    size_t loop = std::upper_bound(m_offsets.begin(), m_offsets.end(), first)
+                  - m_offsets.begin() - 1;
+    while (first < last) {
+      const Index_type loop_end = std::min(last, m_offsets[loop + 1]);
+      m_loops[loop]->run(first - m_offsets[loop], loop_end - m_offsets[loop]);
+      first = loop_end;
+      ++loop;
+    }
+  }
+
+  //! Execute chunk c of getNumChunks().
+  void runChunk(Index_type c) const
+  {
+    const Index_type first = c * m_chunk_size;
+    run(first, std::min(first + m_chunk_size, getLength()));
+  }
+
+  /*!
+   * Copies of the loop bodies for one thread, made when the thread first
+   * runs an iteration of each loop and released, combining any reducers
+   * they captured, when destroyed. Copying a PrivateBodies gives one with
+   * no copies yet, so a loop body holding it is privatized per thread by
+   * forall like any other. A PrivateBodies must not be shared by threads.
+   */
+  class PrivateBodies
+  {
+  public:
+    explicit PrivateBodies(const LoopBatch& batch) : m_batch(&batch) {}
+
+    PrivateBodies(const PrivateBodies& other) : m_batch(other.m_batch) {}
+
+    PrivateBodies& operator=(const PrivateBodies&) = delete;
+
+    const detail::BatchLoopBase::PrivateBody& get(size_t loop) const
+    {
+      if (m_bodies.empty()) {
+        m_bodies.resize(m_batch->getNumLoops());
+      }
+      if (!m_bodies[loop]) {
+        m_bodies[loop] = m_batch->m_loops[loop]->privatize();
+      }
+      return *m_bodies[loop];
+    }
+
+  private:
+    const LoopBatch* m_batch;
+    mutable std::vector<std::unique_ptr<detail::BatchLoopBase::PrivateBody>>
+        m_bodies;
+  };
+
+  //! Execute combined iterations [first, last) with the copies in bodies.
+  void run(Index_type first,
+           Index_type last,
+           const PrivateBodies& bodies) const
+  {
+    size_t loop = std::upper_bound(m_offsets.begin(), m_offsets.end(), first)
+                  - m_offsets.begin() - 1;
+    while (first < last) {
+      const Index_type loop_end = std::min(last, m_offsets[loop + 1]);
+      m_loops[loop]->run(bodies.get(loop),
+                         first - m_offsets[loop],
+                         loop_end - m_offsets[loop]);
+      first = loop_end;
+      ++loop;
+    }
+  }
+
+  //! Execute chunk c of getNumChunks() with the copies in bodies.
+  void runChunk(Index_type c, const PrivateBodies& bodies) const
+  {
+    const Index_type first = c * m_chunk_size;
+    run(first, std::min(first + m_chunk_size, getLength()), bodies);
+  }
+
+private:
+  Index_type m_chunk_size;
+  std::vector<std::unique_ptr<detail::BatchLoopBase>> m_loops;
+  std::vector<Index_type> m_offsets;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Execute every loop of batch in a single RAJA::forall launch over
+ *         its chunks.
+ *
+ *         All chunks but the last have the same iteration count, so a
+ *         static policy already splits the work evenly; thread_pool_exec
+ *         additionally steals chunks when loop bodies differ in cost.
+ *         Inside an omp_persistent_region, omp_persistent_exec avoids the
+ *         fork/join as well.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy>
+RAJA_INLINE void forall_batch(const LoopBatch& batch)
+{
+  const LoopBatch* loops = &batch;
+  // each copy of the chunk body made by forall (once per thread for the
+  // parallel back-ends) copies a loop body at most once per launch, so
+  // captured reducers are combined once per thread rather than per chunk
+  const LoopBatch::PrivateBodies bodies(batch);
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, batch.getNumChunks()),
+                           [=](Index_type c) { loops->runChunk(c, bodies); });
+}
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
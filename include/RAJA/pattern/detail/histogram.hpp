@@ -0,0 +1,139 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the strategy selection and private bin
+*          storage shared by the host histogram back-ends.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_HISTOGRAM_HPP
+#define RAJA_PATTERN_DETAIL_HISTOGRAM_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+//! How a parallel back-end accumulates into the bins.
+enum class Strategy {
+  //! plain adds into the output, only used on a single thread
+  direct,
+  //! one copy of the bins per thread, merged into the output afterwards
+  privatized,
+  //! atomic adds into the output
+  atomic
+};
+
+//! Largest per-thread copy of the bins, in bytes, that is privatized.
+constexpr std::size_t max_private_bytes = 256 * 1024;
+
+/*!
+ * Pick the strategy for num_bins bins of type T filled from len iterations
+ * on num_threads threads.
+ *
+ * Private copies remove all contention but cost num_threads * num_bins
+ * adds to merge, so they are used while each copy stays cache resident and
+ * the merge is no more work than the loop itself. Beyond that the bins are
+ * many and updates rarely collide, and atomics are cheaper.
+ */
+template <typename T>
+Strategy select_strategy(Index_type num_bins,
+                         Index_type len,
+                         int num_threads)
+{
+  if (num_threads <= 1) {
+    return Strategy::direct;
+  }
+  const bool fits =
+      static_cast<std::size_t>(num_bins) * sizeof(T) <= max_private_bytes;
+  const bool cheap_merge = num_bins * num_threads <= len;
+  return (fits && cheap_merge) ? Strategy::privatized : Strategy::atomic;
+}
+
+/*!
+ * Per-thread copies of the bins in one allocation. Rows are padded to a
+ * multiple of DATA_ALIGN bytes so that neighbouring threads do not share a
+ * cache line. The storage is left uninitialized; each thread clears its own
+ * row so that the pages are first touched by the thread using them.
+ */
+template <typename T>
+class PrivateBins
+{
+public:
+  PrivateBins(int num_threads, Index_type num_bins)
+      : m_pitch(paddedLength(num_bins)),
+        m_data(new T[static_cast<std::size_t>(m_pitch) * num_threads])
+  {
+  }
+
+  T* row(int thread) const { return m_data.get() + m_pitch * thread; }
+
+  //! Set every bin of thread's copy to zero.
+  void clear(int thread, Index_type num_bins) const
+  {
+    std::fill(row(thread), row(thread) + num_bins, T());
+  }
+
+  /*!
+   * Add bins [first, last) of the first num_threads copies into out,
+   * accumulating in the order of the threads.
+   */
+  void mergeInto(T* out,
+                 int num_threads,
+                 Index_type first,
+                 Index_type last) const
+  {
+    for (Index_type b = first; b < last; ++b) {
+      T sum = out[b];
+      for (int t = 0; t < num_threads; ++t) {
+        sum += row(t)[b];
+      }
+      out[b] = sum;
+    }
+  }
+
+private:
+  static Index_type paddedLength(Index_type num_bins)
+  {
+    const Index_type per_line = std::max<Index_type>(
+        1, RAJA::DATA_ALIGN / static_cast<Index_type>(sizeof(T)));
+    return (num_bins + per_line - 1) / per_line * per_line;
+  }
+
+  Index_type m_pitch;
+  std::unique_ptr<T[]> m_data;
+};
+
+}  // namespace histogram
+}  // namespace impl
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_HISTOGRAM_HPP */
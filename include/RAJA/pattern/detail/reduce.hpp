@@ -27,8 +27,14 @@
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/instrument.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "camp/camp.hpp"
+#include "camp/tuple.hpp"
+
+#include <tuple>
+
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
   template <typename T>                                       \
   class Reduce##OP<POL, T>                                    \
@@ -39,12 +45,23 @@
     using Base::Base;                                         \
   };
 
+#define RAJA_DECLARE_TUPLE_REDUCER(POL, COMBINER)                   \
+  template <typename... Ops>                                        \
+  class ReduceTuple<POL, Ops...>                                    \
+      : public reduce::detail::BaseReduceTuple<COMBINER, Ops...>    \
+  {                                                                 \
+  public:                                                           \
+    using Base = reduce::detail::BaseReduceTuple<COMBINER, Ops...>; \
+    using Base::Base;                                               \
+  };
+
 #define RAJA_DECLARE_ALL_REDUCERS(POL, COMBINER) \
   RAJA_DECLARE_REDUCER(Sum, POL, COMBINER)       \
   RAJA_DECLARE_REDUCER(Min, POL, COMBINER)       \
   RAJA_DECLARE_REDUCER(Max, POL, COMBINER)       \
   RAJA_DECLARE_REDUCER(MinLoc, POL, COMBINER)    \
-  RAJA_DECLARE_REDUCER(MaxLoc, POL, COMBINER)
+  RAJA_DECLARE_REDUCER(MaxLoc, POL, COMBINER)    \
+  RAJA_DECLARE_TUPLE_REDUCER(POL, COMBINER)
 
 namespace RAJA
 {
@@ -61,6 +78,7 @@ namespace detail
 
 template <typename T, template <typename...> class Op>
 struct op_adapter : private Op<T, T, T> {
+  using value_type = T;
   using operator_type = Op<T, T, T>;
   RAJA_HOST_DEVICE static constexpr T identity()
   {
@@ -123,8 +141,31 @@ public:
   }
 };
 
+/*!
+ * \brief Value padded out to a multiple of RAJA::DATA_ALIGN bytes.
+ *
+ * Used for per-thread partial results that are stored next to each other,
+ * so that threads updating neighboring slots do not share a cache line.
+ */
+template <typename T>
+struct PaddedValue {
+  T value;
+  char pad[RAJA::DATA_ALIGN - (sizeof(T) % RAJA::DATA_ALIGN)];
+
+  PaddedValue() : value{}, pad{} {}
+  PaddedValue(T const &v) : value{v}, pad{} {}
+};
+
 }  // end detail
 
+//! Operator of a ReduceTuple entry tracking the location of the minimum.
+template <typename T>
+using minloc = min<detail::ValueLoc<T>>;
+
+//! Operator of a ReduceTuple entry tracking the location of the maximum.
+template <typename T>
+using maxloc = max<detail::ValueLoc<T, false>>;
+
 }  // end reduce
 
 namespace operators
@@ -196,10 +237,14 @@ public:
   T &local() const { return c.local(); }
 
   //! Get the calculated reduced value
-  operator T() const { return c.get(); }
+  operator T() const { return get(); }
 
   //! Get the calculated reduced value
-  T get() const { return c.get(); }
+  T get() const
+  {
+    RAJA_INSTRUMENT_LAUNCH(reduce, Combiner_t, 0);
+    return c.get();
+  }
 };
 
 template <typename T, typename Reduce, typename Derived>
@@ -417,6 +462,170 @@ public:
   operator T() const { return Base::get(); }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Values of a tuple reducer, compared element by element.
+ *
+ **************************************************************************
+ */
+template <typename... Ts>
+struct ValueTuple {
+  camp::tuple<Ts...> values;
+
+  ValueTuple() = default;
+
+  RAJA_HOST_DEVICE explicit ValueTuple(Ts const &... vals) : values(vals...)
+  {
+  }
+
+  RAJA_HOST_DEVICE bool operator==(ValueTuple const &rhs) const
+  {
+    return equal(rhs, camp::make_idx_seq_t<sizeof...(Ts)>{});
+  }
+
+  RAJA_HOST_DEVICE bool operator!=(ValueTuple const &rhs) const
+  {
+    return !(*this == rhs);
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE bool equal(ValueTuple const &rhs,
+                              camp::idx_seq<Is...>) const
+  {
+    // ValueLoc entries compare by value, like the single-value reducers
+    bool same[] = {true,
+                   !(camp::get<Is>(values) != camp::get<Is>(rhs.values))...};
+    for (bool s : same) {
+      if (!s) return false;
+    }
+    return true;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Reduction operator applying Ops element-wise to a ValueTuple.
+ *
+ **************************************************************************
+ */
+template <typename... Ops>
+struct TupleReduce {
+  using value_type = ValueTuple<typename Ops::value_type...>;
+
+  //! BaseReduce takes the operator as a template of the value type
+  template <typename>
+  using rebind = TupleReduce;
+
+  //! Binary form of the operator, as used by tbb::combinable.
+  struct operator_type {
+    RAJA_HOST_DEVICE value_type operator()(value_type lhs,
+                                           value_type const &rhs) const
+    {
+      TupleReduce{}(lhs, rhs);
+      return lhs;
+    }
+  };
+
+  RAJA_HOST_DEVICE static value_type identity()
+  {
+    return value_type(Ops::identity()...);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(value_type &val,
+                                               const value_type v) const
+  {
+    apply(val, v, camp::make_idx_seq_t<sizeof...(Ops)>{});
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE void apply(value_type &val,
+                                          value_type const &v,
+                                          camp::idx_seq<Is...>) const
+  {
+    int order[] = {0,
+                   (Ops{}(camp::get<Is>(val.values), camp::get<Is>(v.values)),
+                    0)...};
+    (void)order;
+  }
+};
+
+/*!
+ **************************************************************************
+ *
+ * \brief  Reducer holding one value per operator in Ops, e.g.
+ *         reduce::sum<double>, reduce::min<int> or reduce::maxloc<double>.
+ *
+ *         All values live in a single combiner, so each thread's partial
+ *         results are combined with one synchronization rather than one
+ *         per value.
+ *
+ **************************************************************************
+ */
+template <template <typename, typename> class Combiner, typename... Ops>
+class BaseReduceTuple
+    : public BaseReduce<ValueTuple<typename Ops::value_type...>,
+                        TupleReduce<Ops...>::template rebind,
+                        Combiner>
+{
+  static_assert(sizeof...(Ops) > 0, "ReduceTuple needs at least one op");
+
+  using Base = BaseReduce<ValueTuple<typename Ops::value_type...>,
+                          TupleReduce<Ops...>::template rebind,
+                          Combiner>;
+
+  template <camp::idx_t I>
+  using op_type = typename std::tuple_element<I, std::tuple<Ops...>>::type;
+
+public:
+  using value_type = typename Base::value_type;
+
+  template <camp::idx_t I>
+  using element_type = typename op_type<I>::value_type;
+
+  using Base::combine;
+  using Base::get;
+
+  //! Every value starts at the identity of its operator.
+  BaseReduceTuple() : Base(TupleReduce<Ops...>::identity()) {}
+
+  explicit BaseReduceTuple(typename Ops::value_type const &... init_vals)
+      : Base(value_type(init_vals...))
+  {
+  }
+
+  void reset(typename Ops::value_type const &... init_vals)
+  {
+    Base::reset(value_type(init_vals...));
+  }
+
+  //! reducer function; combines element_type<I>(args...) into value I
+  template <camp::idx_t I, typename... Args>
+  RAJA_HOST_DEVICE const BaseReduceTuple &combine(Args const &... args) const
+  {
+    op_type<I>{}(camp::get<I>(this->local().values),
+                 element_type<I>(args...));
+    return *this;
+  }
+
+  //! Get reduced value I
+  template <camp::idx_t I>
+  element_type<I> get() const
+  {
+    return camp::get<I>(Base::get().values);
+  }
+
+  //! Get the location of reduced value I, for minloc and maxloc entries
+  template <camp::idx_t I>
+  Index_type getLoc() const
+  {
+    return get<I>().getLoc();
+  }
+};
+
 } /* detail */
 
 } /* reduce */
@@ -0,0 +1,562 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing the parallel sort building blocks shared by
+*          the host back-ends.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_SORT_HPP
+#define RAJA_PATTERN_DETAIL_SORT_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+namespace detail
+{
+
+/*!
+ * The parallel sorts split the input into one contiguous block per thread.
+ * Blocks shorter than this are not worth a thread; inputs shorter than this
+ * are sorted serially.
+ */
+constexpr Index_type min_block_length = 4096;
+
+//! Bits of the key consumed by each radix sort pass.
+constexpr int radix_digit_bits = 8;
+constexpr int radix_size = 1 << radix_digit_bits;
+
+inline int block_count(Index_type len, int max_blocks)
+{
+  const Index_type blocks =
+      std::min(static_cast<Index_type>(max_blocks), len / min_block_length);
+  return blocks > 1 ? static_cast<int>(blocks) : 1;
+}
+
+inline Index_type block_begin(Index_type len, int nblocks, Index_type b)
+{
+  return (len * b) / nblocks;
+}
+
+/*!
+ * Integral keys sorted in ascending order are sorted by an LSD radix sort,
+ * everything else by a merge sort.
+ */
+template <typename Key, typename Compare>
+struct is_radix_sortable
+    : std::integral_constant<bool,
+                             std::is_integral<Key>::value
+                                 && !std::is_same<Key, bool>::value
+                                 && (std::is_same<Compare,
+                                                  operators::less<Key>>::value
+                                     || std::is_same<Compare,
+                                                     std::less<Key>>::value)> {
+};
+
+//! Map a key to an unsigned integer with the same ordering.
+template <typename Key>
+typename std::make_unsigned<Key>::type radix_bits(Key key)
+{
+  using Bits = typename std::make_unsigned<Key>::type;
+  const Bits sign =
+      std::is_signed<Key>::value
+          ? static_cast<Bits>(Bits(1) << (sizeof(Key) * CHAR_BIT - 1))
+          : Bits(0);
+  return static_cast<Bits>(static_cast<Bits>(key) ^ sign);
+}
+
+/*!
+ * Stand-in for the value range when sorting keys only; reads and writes of
+ * its elements compile away.
+ */
+struct discard_values {
+  struct element {
+  };
+  element operator[](Index_type) const { return element{}; }
+};
+
+//! Compare (key, value) pairs by key only.
+template <typename Compare>
+struct pair_key_compare {
+  Compare comp;
+
+  template <typename Pair>
+  bool operator()(const Pair& lhs, const Pair& rhs) const
+  {
+    return comp(lhs.first, rhs.first);
+  }
+};
+
+/*!
+ * \brief One stable counting pass of the radix sort, moving keys (and
+ *        values) from the in ranges to the out ranges ordered by the digit
+ *        at shift. Returns false, without moving anything, if every key has
+ *        the same digit.
+ *
+ * Each block counts its digits into counts[digit * nblocks + block]; an
+ * exclusive scan of counts then gives every block the output position of
+ * its first key of each digit.
+ */
+template <typename ExecPolicy,
+          typename KeyIn,
+          typename KeyOut,
+          typename ValIn,
+          typename ValOut,
+          typename ScanFn>
+bool radix_pass(KeyIn keys_in,
+                KeyOut keys_out,
+                ValIn vals_in,
+                ValOut vals_out,
+                Index_type len,
+                int nblocks,
+                int shift,
+                std::vector<Index_type>& counts,
+                ScanFn scan)
+{
+  auto digit = [=](Index_type i) {
+    return static_cast<int>((radix_bits(keys_in[i]) >> shift)
+                            & (radix_size - 1));
+  };
+
+  Index_type* count_data = counts.data();
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+    Index_type local[radix_size] = {0};
+    const Index_type last = block_begin(len, nblocks, b + 1);
+    for (Index_type i = block_begin(len, nblocks, b); i < last; ++i) {
+      ++local[digit(i)];
+    }
+    for (int d = 0; d < radix_size; ++d) {
+      count_data[d * nblocks + b] = local[d];
+    }
+  });
+
+  for (int d = 0; d < radix_size; ++d) {
+    Index_type total = 0;
+    for (int b = 0; b < nblocks; ++b) {
+      total += count_data[d * nblocks + b];
+    }
+    if (total == len) return false;
+    if (total != 0) break;
+  }
+
+  scan(count_data, count_data + counts.size());
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+    Index_type offset[radix_size];
+    for (int d = 0; d < radix_size; ++d) {
+      offset[d] = count_data[d * nblocks + b];
+    }
+    const Index_type last = block_begin(len, nblocks, b + 1);
+    for (Index_type i = block_begin(len, nblocks, b); i < last; ++i) {
+      const Index_type pos = offset[digit(i)]++;
+      keys_out[pos] = std::move(keys_in[i]);
+      vals_out[pos] = std::move(vals_in[i]);
+    }
+  });
+
+  return true;
+}
+
+/*!
+ * \brief LSD radix sort of integral keys, carrying values along. Stable.
+ *
+ * Passes alternate between the caller's ranges and scratch copies; passes
+ * whose digit is the same for every key are skipped.
+ */
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename ValScratch,
+          typename ScanFn>
+void radix_sort(KeyIter keys,
+                ValIter vals,
+                ValScratch vals_scratch,
+                Index_type len,
+                int nblocks,
+                ScanFn scan)
+{
+  using Key = camp::decay<decltype(*keys)>;
+
+  std::vector<Key> keys_scratch(len);
+  std::vector<Index_type> counts(radix_size * nblocks);
+
+  bool in_scratch = false;
+  for (int shift = 0; shift < static_cast<int>(sizeof(Key) * CHAR_BIT);
+       shift += radix_digit_bits) {
+    const bool moved =
+        in_scratch ? radix_pass<ExecPolicy>(keys_scratch.data(),
+                                            keys,
+                                            vals_scratch,
+                                            vals,
+                                            len,
+                                            nblocks,
+                                            shift,
+                                            counts,
+                                            scan)
+                   : radix_pass<ExecPolicy>(keys,
+                                            keys_scratch.data(),
+                                            vals,
+                                            vals_scratch,
+                                            len,
+                                            nblocks,
+                                            shift,
+                                            counts,
+                                            scan);
+    if (moved) in_scratch = !in_scratch;
+  }
+
+  if (in_scratch) {
+    Key* scratch = keys_scratch.data();
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, nblocks),
+                             [=](Index_type b) {
+                               const Index_type last =
+                                   block_begin(len, nblocks, b + 1);
+                               for (Index_type i =
+                                        block_begin(len, nblocks, b);
+                                    i < last;
+                                    ++i) {
+                                 keys[i] = std::move(scratch[i]);
+                                 vals[i] = std::move(vals_scratch[i]);
+                               }
+                             });
+  }
+}
+
+/*!
+ * \brief Number of elements of a that precede output position d when
+ *        sorted ranges a and b are merged, with a taken first on ties.
+ */
+template <typename Iter, typename Compare>
+Index_type merge_corank(Index_type d,
+                        Iter a,
+                        Index_type a_len,
+                        Iter b,
+                        Index_type b_len,
+                        Compare comp)
+{
+  Index_type lo = std::max(Index_type(0), d - b_len);
+  Index_type hi = std::min(d, a_len);
+  while (lo < hi) {
+    const Index_type i = lo + (hi - lo) / 2;
+    if (!comp(b[d - i - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+ * \brief Merge runs of width sorted blocks pairwise from src into dst.
+ *
+ * Every output run is split into as many equal pieces as it has blocks,
+ * using merge_corank to find where each piece starts in the two inputs, so
+ * all rounds keep every thread busy.
+ */
+template <typename ExecPolicy,
+          typename SrcIter,
+          typename DstIter,
+          typename Compare>
+void merge_round(SrcIter src,
+                 DstIter dst,
+                 Index_type len,
+                 int nblocks,
+                 int width,
+                 Compare comp)
+{
+  const int group = 2 * width;
+  const int ngroups = (nblocks + group - 1) / group;
+
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, ngroups * group), [=](Index_type q) {
+        const Index_type g = q / group;
+        const Index_type piece = q % group;
+        const Index_type lo = block_begin(len, nblocks, g * group);
+        const Index_type mid = block_begin(
+            len, nblocks, std::min<Index_type>(g * group + width, nblocks));
+        const Index_type hi = block_begin(
+            len, nblocks, std::min<Index_type>((g + 1) * group, nblocks));
+
+        const Index_type run = hi - lo;
+        const Index_type d0 = (run * piece) / group;
+        const Index_type d1 = (run * (piece + 1)) / group;
+        const Index_type i0 =
+            merge_corank(d0, src + lo, mid - lo, src + mid, hi - mid, comp);
+        const Index_type i1 =
+            merge_corank(d1, src + lo, mid - lo, src + mid, hi - mid, comp);
+
+        std::merge(std::make_move_iterator(src + lo + i0),
+                   std::make_move_iterator(src + lo + i1),
+                   std::make_move_iterator(src + mid + (d0 - i0)),
+                   std::make_move_iterator(src + mid + (d1 - i1)),
+                   dst + lo + d0,
+                   comp);
+      });
+}
+
+/*!
+ * \brief Merge sort: every block is sorted in place by one thread, then
+ *        sorted runs are merged pairwise until one is left.
+ */
+template <typename ExecPolicy, typename Iter, typename Compare>
+void merge_sort(Iter begin,
+                Index_type len,
+                int nblocks,
+                Compare comp,
+                bool stable)
+{
+  using T = camp::decay<decltype(*begin)>;
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, nblocks), [=](Index_type b) {
+    Iter first = begin + block_begin(len, nblocks, b);
+    Iter last = begin + block_begin(len, nblocks, b + 1);
+    if (stable) {
+      std::stable_sort(first, last, comp);
+    } else {
+      std::sort(first, last, comp);
+    }
+  });
+
+  if (nblocks == 1) return;
+
+  std::vector<T> scratch(len);
+  bool in_scratch = false;
+  for (int width = 1; width < nblocks; width *= 2) {
+    if (in_scratch) {
+      merge_round<ExecPolicy>(scratch.data(), begin, len, nblocks, width, comp);
+    } else {
+      merge_round<ExecPolicy>(begin, scratch.data(), len, nblocks, width, comp);
+    }
+    in_scratch = !in_scratch;
+  }
+
+  if (in_scratch) {
+    T* data = scratch.data();
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, nblocks),
+                             [=](Index_type b) {
+                               const Index_type first =
+                                   block_begin(len, nblocks, b);
+                               const Index_type last =
+                                   block_begin(len, nblocks, b + 1);
+                               std::move(data + first,
+                                         data + last,
+                                         begin + first);
+                             });
+  }
+}
+
+template <typename ExecPolicy, typename Iter, typename Compare, typename ScanFn>
+void parallel_sort(std::true_type,
+                   Iter begin,
+                   Index_type len,
+                   int nblocks,
+                   Compare,
+                   bool,
+                   ScanFn scan)
+{
+  radix_sort<ExecPolicy>(
+      begin, discard_values{}, discard_values{}, len, nblocks, scan);
+}
+
+template <typename ExecPolicy, typename Iter, typename Compare, typename ScanFn>
+void parallel_sort(std::false_type,
+                   Iter begin,
+                   Index_type len,
+                   int nblocks,
+                   Compare comp,
+                   bool stable,
+                   ScanFn)
+{
+  merge_sort<ExecPolicy>(begin, len, nblocks, comp, stable);
+}
+
+/*!
+ * \brief Sort [begin, end) with ExecPolicy running one block per thread,
+ *        using at most max_blocks blocks. scan must perform an exclusive
+ *        in-place plus scan of an Index_type range.
+ */
+template <typename ExecPolicy, typename Iter, typename Compare, typename ScanFn>
+void parallel_sort(Iter begin,
+                   Iter end,
+                   Compare comp,
+                   bool stable,
+                   int max_blocks,
+                   ScanFn scan)
+{
+  using Key = camp::decay<decltype(*begin)>;
+
+  const Index_type len = std::distance(begin, end);
+  if (len < min_block_length) {
+    if (stable) {
+      std::stable_sort(begin, end, comp);
+    } else {
+      std::sort(begin, end, comp);
+    }
+    return;
+  }
+
+  parallel_sort<ExecPolicy>(is_radix_sortable<Key, Compare>{},
+                            begin,
+                            len,
+                            block_count(len, max_blocks),
+                            comp,
+                            stable,
+                            scan);
+}
+
+/*!
+ * \brief Serial stable sort of keys and values by key.
+ */
+template <typename KeyIter, typename ValIter, typename Compare>
+void serial_sort_pairs(KeyIter keys_begin,
+                       KeyIter keys_end,
+                       ValIter vals_begin,
+                       Compare comp)
+{
+  using Pair = std::pair<camp::decay<decltype(*keys_begin)>,
+                         camp::decay<decltype(*vals_begin)>>;
+
+  const Index_type len = std::distance(keys_begin, keys_end);
+  std::vector<Pair> pairs;
+  pairs.reserve(len);
+  for (Index_type i = 0; i < len; ++i) {
+    pairs.emplace_back(std::move(keys_begin[i]), std::move(vals_begin[i]));
+  }
+
+  std::stable_sort(pairs.begin(), pairs.end(), pair_key_compare<Compare>{comp});
+
+  for (Index_type i = 0; i < len; ++i) {
+    keys_begin[i] = std::move(pairs[i].first);
+    vals_begin[i] = std::move(pairs[i].second);
+  }
+}
+
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare,
+          typename ScanFn>
+void parallel_sort_pairs(std::true_type,
+                         KeyIter keys,
+                         ValIter vals,
+                         Index_type len,
+                         int nblocks,
+                         Compare,
+                         ScanFn scan)
+{
+  using Val = camp::decay<decltype(*vals)>;
+
+  std::vector<Val> vals_scratch(len);
+  radix_sort<ExecPolicy>(keys, vals, vals_scratch.data(), len, nblocks, scan);
+}
+
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare,
+          typename ScanFn>
+void parallel_sort_pairs(std::false_type,
+                         KeyIter keys,
+                         ValIter vals,
+                         Index_type len,
+                         int nblocks,
+                         Compare comp,
+                         ScanFn)
+{
+  using Pair = std::pair<camp::decay<decltype(*keys)>,
+                         camp::decay<decltype(*vals)>>;
+
+  std::vector<Pair> pairs(len);
+  Pair* data = pairs.data();
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, len), [=](Index_type i) {
+    data[i] = Pair(std::move(keys[i]), std::move(vals[i]));
+  });
+
+  merge_sort<ExecPolicy>(
+      data, len, nblocks, pair_key_compare<Compare>{comp}, true);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, len), [=](Index_type i) {
+    keys[i] = std::move(data[i].first);
+    vals[i] = std::move(data[i].second);
+  });
+}
+
+/*!
+ * \brief Stable sort of the keys in [keys_begin, keys_end) and the values
+ *        starting at vals_begin by key; see parallel_sort.
+ */
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare,
+          typename ScanFn>
+void parallel_sort_pairs(KeyIter keys_begin,
+                         KeyIter keys_end,
+                         ValIter vals_begin,
+                         Compare comp,
+                         int max_blocks,
+                         ScanFn scan)
+{
+  using Key = camp::decay<decltype(*keys_begin)>;
+
+  const Index_type len = std::distance(keys_begin, keys_end);
+  if (len < min_block_length) {
+    serial_sort_pairs(keys_begin, keys_end, vals_begin, comp);
+    return;
+  }
+
+  parallel_sort_pairs<ExecPolicy>(is_radix_sortable<Key, Compare>{},
+                                  keys_begin,
+                                  vals_begin,
+                                  len,
+                                  block_count(len, max_blocks),
+                                  comp,
+                                  scan);
+}
+
+}  // closing brace for detail namespace
+}  // closing brace for sort namespace
+}  // closing brace for impl namespace
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for header file include guard
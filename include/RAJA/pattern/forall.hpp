@@ -76,6 +76,7 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/instrument.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/sequential/forall.hpp"
@@ -314,6 +315,7 @@ RAJA_INLINE void forall_Icount(ExecutionPolicy&& p,
                 "TypedIndexSet policy by mistake?");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall, ExecutionPolicy, c.getLength());
 
   wrap::forall_Icount(std::forward<ExecutionPolicy>(p),
                       std::forward<IdxSet>(c),
@@ -340,6 +342,7 @@ RAJA_INLINE concepts::
                 "TypedIndexSet policy by mistake?");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall, ExecutionPolicy, c.getLength());
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                std::forward<IdxSet>(c),
@@ -370,6 +373,9 @@ forall_Icount(ExecutionPolicy&& p,
                 "Container does not model RandomAccessIterator");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall,
+                         ExecutionPolicy,
+                         std::distance(std::begin(c), std::end(c)));
 
   wrap::forall_Icount(std::forward<ExecutionPolicy>(p),
                       std::forward<Container>(c),
@@ -391,6 +397,7 @@ template <typename ExecutionPolicy, typename Container, typename LoopBody>
 RAJA_INLINE concepts::
     enable_if<concepts::
                   negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+              concepts::negate<type_traits::is_async_policy<ExecutionPolicy>>,
               type_traits::is_range<Container>>
     forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
 {
@@ -398,6 +405,9 @@ RAJA_INLINE concepts::
                 "Container does not model RandomAccessIterator");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall,
+                         ExecutionPolicy,
+                         std::distance(std::begin(c), std::end(c)));
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                std::forward<Container>(c),
@@ -406,6 +416,36 @@ RAJA_INLINE concepts::
   detail::clearChaiExecutionSpace();
 }
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with an asynchronous policy
+ *
+ *        Returns the handle produced by the policy, e.g. an AsyncEvent.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody>
+RAJA_INLINE auto forall(ExecutionPolicy&& p, Container&& c, LoopBody&& loop_body)
+    -> typename std::enable_if<
+        type_traits::is_async_policy<ExecutionPolicy>::value
+            && type_traits::is_range<Container>::value,
+        decltype(forall_impl(std::forward<ExecutionPolicy>(p),
+                             std::forward<Container>(c),
+                             std::forward<LoopBody>(loop_body)))>::type
+{
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  RAJA_INSTRUMENT_LAUNCH(forall,
+                         ExecutionPolicy,
+                         std::distance(std::begin(c), std::end(c)));
+
+  return forall_impl(std::forward<ExecutionPolicy>(p),
+                     std::forward<Container>(c),
+                     std::forward<LoopBody>(loop_body));
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -442,6 +482,7 @@ RAJA_INLINE
                 "RandomAccessIterator");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall, ExecutionPolicy, std::distance(begin, end));
 
   auto len = std::distance(begin, end);
   using SpanType = impl::Span<Iterator, decltype(len)>;
@@ -476,6 +517,7 @@ RAJA_INLINE
                 "RandomAccessIterator");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall, ExecutionPolicy, std::distance(begin, end));
 
   auto len = std::distance(begin, end);
   using SpanType = impl::Span<Iterator, decltype(len)>;
@@ -521,6 +563,7 @@ forall(ExecutionPolicy&& p,
       "Cannot deduce a common type between begin and end for Range creation");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall, ExecutionPolicy, end - begin);
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                make_range(begin, end),
@@ -559,6 +602,7 @@ forall_Icount(ExecutionPolicy&& p,
       "Cannot deduce a common type between begin and end for Range creation");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall, ExecutionPolicy, end - begin);
 
   wrap::forall_Icount(std::forward<ExecutionPolicy>(p),
                       make_range(begin, end),
@@ -606,6 +650,9 @@ forall(ExecutionPolicy&& p,
                 "creation");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall,
+                         ExecutionPolicy,
+                         make_strided_range(begin, end, stride).size());
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                make_strided_range(begin, end, stride),
@@ -656,6 +703,9 @@ forall_Icount(ExecutionPolicy&& p,
                 "creation");
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall,
+                         ExecutionPolicy,
+                         make_strided_range(begin, end, stride).size());
 
   wrap::forall_Icount(std::forward<ExecutionPolicy>(p),
                       make_strided_range(begin, end, stride),
@@ -693,6 +743,7 @@ RAJA_INLINE concepts::
            LoopBody&& loop_body)
 {
   detail::setChaiExecutionSpace<ExecutionPolicy>();
+  RAJA_INSTRUMENT_LAUNCH(forall, ExecutionPolicy, len);
 
   wrap::forall(std::forward<ExecutionPolicy>(p),
                TypedListSegment<ArrayIdxType>(idx, len, Unowned),
@@ -746,7 +797,9 @@ RAJA_INLINE concepts::
  * this reduces implementation overhead and perfectly forwards all arguments
  */
 template <typename ExecutionPolicy, typename... Args>
-RAJA_INLINE void forall(Args&&... args)
+RAJA_INLINE concepts::enable_if<
+    concepts::negate<type_traits::is_async_policy<ExecutionPolicy>>>
+forall(Args&&... args)
 {
 
   detail::setChaiExecutionSpace<ExecutionPolicy>();
@@ -756,6 +809,18 @@ RAJA_INLINE void forall(Args&&... args)
   detail::clearChaiExecutionSpace();
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * asynchronous forall, returning the launch handle
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE auto forall(Args&&... args) -> typename std::enable_if<
+    type_traits::is_async_policy<ExecutionPolicy>::value,
+    decltype(forall(ExecutionPolicy(), std::forward<Args>(args)...))>::type
+{
+  return forall(ExecutionPolicy(), std::forward<Args>(args)...);
+}
+
 /*!
  * \brief Conversion from template-based policy to value-based policy for
  * forall_Icount
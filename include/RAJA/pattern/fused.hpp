@@ -0,0 +1,192 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing fused forall methods that run several
+ *          loop bodies in one traversal of an iteration space.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_fused_HPP
+#define RAJA_fused_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/defines.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "camp/camp.hpp"
+#include "camp/concepts.hpp"
+#include "camp/tuple.hpp"
+
+#include <iterator>
+#include <utility>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Loop body calling each of Bodies, in order, for the same index.
+template <typename... Bodies>
+struct FusedBody {
+  camp::tuple<Bodies...> bodies;
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Args&&... args) const
+  {
+    call(camp::make_idx_seq_t<sizeof...(Bodies)>{}, args...);
+  }
+
+private:
+  template <camp::idx_t... Is, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(camp::idx_seq<Is...>,
+                                         Args&... args) const
+  {
+    // braced initializers are evaluated left to right
+    int order[] = {0, (camp::get<Is>(bodies)(args...), 0)...};
+    (void)order;
+  }
+};
+
+/*!
+ * Loop body over chunk ids; chunk k runs each of Bodies, in order, over
+ * iterations [k*chunk_size, (k+1)*chunk_size) of the container.
+ */
+template <typename Iterator, typename... Bodies>
+struct FusedChunkBody {
+  Iterator begin_it;
+  Index_type len;
+  Index_type chunk_size;
+  camp::tuple<Bodies...> bodies;
+
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type chunk) const
+  {
+    const Index_type first = chunk * chunk_size;
+    const Index_type last =
+        first + chunk_size < len ? first + chunk_size : len;
+    call(camp::make_idx_seq_t<sizeof...(Bodies)>{}, first, last);
+  }
+
+private:
+  template <camp::idx_t... Is>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(camp::idx_seq<Is...>,
+                                         Index_type first,
+                                         Index_type last) const
+  {
+    int order[] = {0, (run(camp::get<Is>(bodies), first, last), 0)...};
+    (void)order;
+  }
+
+  template <typename Body>
+  RAJA_HOST_DEVICE RAJA_INLINE void run(const Body& body,
+                                        Index_type first,
+                                        Index_type last) const
+  {
+    for (Index_type i = first; i < last; ++i) {
+      body(begin_it[i]);
+    }
+  }
+};
+
+}  // end namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Execute several loop bodies in one traversal of c.
+ *
+ *         For each index, the bodies are called in the order given, so
+ *         RAJA::forall_fused<pol>(c, b0, b1) computes the same as
+ *         RAJA::forall<pol>(c, b0) followed by RAJA::forall<pol>(c, b1)
+ *         provided b1 only uses results of b0 at the same index. Bodies are
+ *         invoked through a single loop body, so every forall policy,
+ *         including index set policies, can run the fused loop.
+ *
+ *         Returns whatever RAJA::forall returns for the policy.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Container, typename... Bodies>
+RAJA_INLINE auto forall_fused(Container&& c, Bodies&&... bodies)
+    -> decltype(RAJA::forall<ExecPolicy>(
+        std::forward<Container>(c),
+        std::declval<detail::FusedBody<camp::decay<Bodies>...>>()))
+{
+  static_assert(sizeof...(Bodies) > 0, "forall_fused needs a loop body");
+
+  using fused_type = detail::FusedBody<camp::decay<Bodies>...>;
+  return RAJA::forall<ExecPolicy>(
+      std::forward<Container>(c),
+      fused_type{camp::tuple<camp::decay<Bodies>...>(bodies...)});
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Execute several loop bodies chunk by chunk in one traversal of c.
+ *
+ *         The iterations of c are cut into chunks of chunk_size and the
+ *         execution policy schedules the chunks. Within a chunk each body
+ *         runs over all of its iterations before the next body starts, so
+ *         each body keeps a simple inner loop while the data it shares with
+ *         the other bodies is still in cache. Choose chunk_size so that a
+ *         chunk of every array the bodies touch fits in cache.
+ *
+ *         As with forall_fused, a body may only use results of earlier
+ *         bodies at the same index. c must be random access. The launch
+ *         completes before this function returns, for any policy.
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename Container, typename... Bodies>
+RAJA_INLINE void forall_fused_chunked(Index_type chunk_size,
+                                      Container&& c,
+                                      Bodies&&... bodies)
+{
+  static_assert(sizeof...(Bodies) > 0,
+                "forall_fused_chunked needs a loop body");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container does not model RandomAccessIterator");
+
+  using std::begin;
+  using std::end;
+  using std::distance;
+  auto begin_it = begin(c);
+  const Index_type len = distance(begin_it, end(c));
+  if (len <= 0) return;
+  if (chunk_size < 1) chunk_size = 1;
+
+  using fused_type =
+      detail::FusedChunkBody<decltype(begin_it), camp::decay<Bodies>...>;
+  RAJA::forall<ExecPolicy>(
+      RAJA::RangeSegment(0, (len + chunk_size - 1) / chunk_size),
+      fused_type{begin_it,
+                 len,
+                 chunk_size,
+                 camp::tuple<camp::decay<Bodies>...>(bodies...)});
+}
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
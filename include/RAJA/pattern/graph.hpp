@@ -0,0 +1,343 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing LoopGraph, a recorded sequence of
+ *          forall and kernel launches that can be replayed.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_graph_HPP
+#define RAJA_graph_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/internal/DepGraphNode.hpp"
+#include "RAJA/util/camp_aliases.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/util/types.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include "RAJA/policy/openmp/policy.hpp"
+#endif
+
+#include <iosfwd>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Type-erased launch recorded in a LoopGraph.
+struct LoopGraphNodeBase {
+  virtual ~LoopGraphNodeBase() {}
+
+  //! Run the launch with its recorded policy.
+  virtual void execute() const = 0;
+
+  //! Number of iterations that may be split across threads; 0 if the
+  //! launch must be executed whole.
+  virtual Index_type length() const = 0;
+
+  //! Run iterations [first, last) on the calling thread.
+  virtual void executeRange(Index_type first, Index_type last) const = 0;
+};
+
+//! Policies whose forall fixes its own iteration blocks, independent of
+//! the thread count, so a range of iterations cannot be run on its own.
+std::false_type has_fixed_blocks(const void*);
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <unsigned int BlockSize>
+std::true_type has_fixed_blocks(
+    const policy::omp::omp_for_reproducible<BlockSize>*);
+
+template <unsigned int BlockSize>
+std::true_type has_fixed_blocks(const policy::omp::omp_parallel_exec<
+                                policy::omp::omp_for_reproducible<BlockSize>>*);
+#endif
+
+template <typename ExecPolicy, typename Segment, typename Body>
+struct ForallGraphNode : LoopGraphNodeBase {
+  //! Only launches recorded with a parallel policy are split; sequential
+  //! ones may carry dependences between iterations, index set launches
+  //! dispatch segments themselves, and reproducible launches need their
+  //! own blocks for omp_reduce_reproducible reducers.
+  using splittable = std::integral_constant<
+      bool,
+      !type_traits::is_indexset_policy<ExecPolicy>::value
+          && !decltype(has_fixed_blocks(
+                 static_cast<const ExecPolicy*>(nullptr)))::value
+          && (type_traits::is_openmp_policy<ExecPolicy>::value
+              || type_traits::is_tbb_policy<ExecPolicy>::value
+              || type_traits::is_threads_policy<ExecPolicy>::value)>;
+
+  template <typename S, typename B>
+  ForallGraphNode(S&& segment, B&& body)
+      : segment(std::forward<S>(segment)), body(std::forward<B>(body))
+  {
+  }
+
+  void execute() const override
+  {
+    // skips the forall front end (instrumentation, CHAI space changes)
+    wrap::forall(ExecPolicy{}, segment, body);
+  }
+
+  Index_type length() const override { return length(splittable{}); }
+
+  void executeRange(Index_type first, Index_type last) const override
+  {
+    executeRange(first, last, splittable{});
+  }
+
+  Segment segment;
+  Body body;
+
+private:
+  Index_type length(std::true_type) const
+  {
+    return std::distance(std::begin(segment), std::end(segment));
+  }
+
+  Index_type length(std::false_type) const { return 0; }
+
+  void executeRange(Index_type first, Index_type last, std::true_type) const
+  {
+    // privatize reducers captured by the body, as forall does per thread
+    const Body private_body = body;
+    auto begin_it = std::begin(segment);
+    for (Index_type i = first; i < last; ++i) {
+      private_body(begin_it[i]);
+    }
+  }
+
+  void executeRange(Index_type, Index_type, std::false_type) const {}
+};
+
+template <typename KernelPolicy, typename SegmentTuple, typename... Bodies>
+struct KernelGraphNode : LoopGraphNodeBase {
+  template <typename S, typename... B>
+  KernelGraphNode(S&& segments, B&&... bodies)
+      : segments(std::forward<S>(segments)),
+        bodies(std::forward<B>(bodies)...)
+  {
+  }
+
+  void execute() const override
+  {
+    execute(camp::make_idx_seq_t<sizeof...(Bodies)>{});
+  }
+
+  Index_type length() const override { return 0; }
+
+  void executeRange(Index_type, Index_type) const override {}
+
+  SegmentTuple segments;
+  std::tuple<Bodies...> bodies;
+
+private:
+  template <camp::idx_t... Is>
+  void execute(camp::idx_seq<Is...>) const
+  {
+    RAJA::kernel<KernelPolicy>(segments, std::get<Is>(bodies)...);
+  }
+};
+
+}  // end namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Recorded sequence of forall and kernel launches with declared
+ *         data dependencies, for codes that run the same loops every time
+ *         step.
+ *
+ *         Recording stores copies of the policies' segments and loop bodies
+ *         without executing anything. Each recorded launch may declare the
+ *         arrays it reads and writes; a launch declaring nothing is ordered
+ *         after all earlier launches and before all later ones.
+ *
+ *         LoopGraph graph;
+ *         graph.forall<RAJA::omp_parallel_for_exec>(range, update)
+ *             .reads(u).writes(unew);
+ *         graph.forall<RAJA::omp_parallel_for_exec>(range, flux)
+ *             .reads(u).writes(f);
+ *         graph.forall<RAJA::omp_parallel_for_exec>(range, swap)
+ *             .reads(unew, f).writes(u);
+ *
+ *         for (int step = 0; step < num_steps; ++step) {
+ *           graph.replay<RAJA::omp_persistent_exec>();
+ *         }
+ *
+ *         replay() runs every launch, in order, with its recorded policy
+ *         but without the forall front end. replay<Policy>() hands the
+ *         graph to a backend; e.g. with omp_persistent_exec the whole graph
+ *         runs in one team launch, forall launches recorded with a
+ *         parallel policy are split statically across the team, other
+ *         launches run whole on one thread, and barriers are placed only
+ *         between launches that depend on each other (see getPhase()).
+ *
+ *         Dependencies are computed by finalize(), which replay calls when
+ *         the graph has changed. Edges are kept in DepGraphNode objects.
+ *
+ ******************************************************************************
+ */
+class LoopGraph
+{
+public:
+  //! Handle to a recorded launch, used to declare the data it accesses.
+  class NodeRef
+  {
+  public:
+    NodeRef(LoopGraph* graph, int node) : m_graph(graph), m_node(node) {}
+
+    //! Declare arrays (or any objects) the launch reads.
+    template <typename... Ptrs>
+    NodeRef& reads(const Ptrs*... ptrs)
+    {
+      addAccess(false, ptrs...);
+      return *this;
+    }
+
+    //! Declare arrays the launch writes, or reads and writes.
+    template <typename... Ptrs>
+    NodeRef& writes(const Ptrs*... ptrs)
+    {
+      addAccess(true, ptrs...);
+      return *this;
+    }
+
+    int getNodeId() const { return m_node; }
+
+  private:
+    void addAccess(bool) {}
+
+    template <typename Ptr, typename... Ptrs>
+    void addAccess(bool write, const Ptr* ptr, const Ptrs*... ptrs)
+    {
+      m_graph->addAccess(m_node, static_cast<const void*>(ptr), write);
+      addAccess(write, ptrs...);
+    }
+
+    LoopGraph* m_graph;
+    int m_node;
+  };
+
+  LoopGraph() : m_num_phases(0), m_finalized(true) {}
+
+  LoopGraph(LoopGraph&&) = default;
+  LoopGraph& operator=(LoopGraph&&) = default;
+
+  //! Record RAJA::forall<ExecPolicy>(segment, loop_body).
+  template <typename ExecPolicy, typename Segment, typename LoopBody>
+  NodeRef forall(Segment&& segment, LoopBody&& loop_body)
+  {
+    using node_type = detail::ForallGraphNode<camp::decay<ExecPolicy>,
+                                              camp::decay<Segment>,
+                                              camp::decay<LoopBody>>;
+    return addNode(new node_type(std::forward<Segment>(segment),
+                                 std::forward<LoopBody>(loop_body)));
+  }
+
+  //! Record RAJA::kernel<KernelPolicy>(segments, bodies...).
+  template <typename KernelPolicy, typename SegmentTuple, typename... Bodies>
+  NodeRef kernel(SegmentTuple&& segments, Bodies&&... bodies)
+  {
+    using node_type = detail::KernelGraphNode<KernelPolicy,
+                                              camp::decay<SegmentTuple>,
+                                              camp::decay<Bodies>...>;
+    return addNode(new node_type(std::forward<SegmentTuple>(segments),
+                                 std::forward<Bodies>(bodies)...));
+  }
+
+  //! Compute dependencies and phases if the graph has changed.
+  void finalize();
+
+  //! Run every launch in recorded order with its recorded policy.
+  void replay() const;
+
+  //! Run the graph with the given replay policy, e.g. omp_persistent_exec.
+  template <typename ReplayPolicy>
+  void replay()
+  {
+    finalize();
+    graph_replay_impl(ReplayPolicy{}, static_cast<const LoopGraph&>(*this));
+  }
+
+  //! Remove all launches.
+  void clear();
+
+  int getNumNodes() const { return static_cast<int>(m_nodes.size()); }
+
+  const detail::LoopGraphNodeBase& getNode(int node) const
+  {
+    return *m_nodes[node];
+  }
+
+  //! Outgoing dependencies of node, valid after finalize().
+  const DepGraphNode& getDepGraphNode(int node) const
+  {
+    return m_dep_nodes[node];
+  }
+
+  /*!
+   * Phase of node, valid after finalize(). Consecutive launches share a
+   * phase unless a later one depends on an earlier one, so a barrier is
+   * only needed where the phase changes.
+   */
+  int getPhase(int node) const { return m_phase[node]; }
+
+  int getNumPhases() const { return m_num_phases; }
+
+  //! Print the launches, their dependencies and phases.
+  void print(std::ostream& os) const;
+
+private:
+  NodeRef addNode(detail::LoopGraphNodeBase* node);
+
+  void addAccess(int node, const void* ptr, bool write);
+
+  void addEdge(int from, int to);
+
+  struct Access {
+    const void* ptr;
+    bool write;
+  };
+
+  std::vector<std::unique_ptr<detail::LoopGraphNodeBase>> m_nodes;
+  std::vector<std::vector<Access>> m_accesses;
+  std::vector<DepGraphNode> m_dep_nodes;
+  std::vector<int> m_phase;
+  int m_num_phases;
+  bool m_finalized;
+};
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,152 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the histogram and scatter-add
+ *          patterns.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_HPP
+#define RAJA_histogram_HPP
+
+#include "RAJA/config.hpp"
+#include "camp/concepts.hpp"
+
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/histogram.hpp"
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/instrument.hpp"
+#include "RAJA/util/types.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Value function of histogram(): every index counts once.
+template <typename T>
+struct HistogramCount {
+  template <typename Index>
+  T operator()(Index&&) const
+  {
+    return T(1);
+  }
+};
+
+}  // end namespace detail
+
+/*!
+******************************************************************************
+*
+* \brief  scatter-add execution pattern
+*
+*         For every index i of the iteration space,
+*
+*           out[index_of(i)] += value_of(i);
+*
+*         without races between iterations that hit the same entry. The
+*         back-end accumulates into per-thread copies of out that are merged
+*         in parallel afterwards when out is small relative to the iteration
+*         space, and uses atomic adds when it is not (see
+*         impl::histogram::select_strategy). The entries of out keep their
+*         previous values and are added to.
+*
+* \param[in] c iteration space, e.g. a range or list segment
+* \param[in,out] out array of num_bins entries to add into
+* \param[in] num_bins number of entries of out
+* \param[in] index_of function of the index returning the entry to add to,
+*in [0, num_bins)
+* \param[in] value_of function of the index returning the value to add
+*
+* \note{Floating point sums may be accumulated in any order.}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Container,
+          typename T,
+          typename IndexFn,
+          typename ValueFn>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>>
+scatter_add(Container&& c,
+            T* out,
+            Index_type num_bins,
+            IndexFn index_of,
+            ValueFn value_of)
+{
+  RAJA_EXTRACT_BED_IT(c);
+  static_assert(type_traits::is_random_access_iterator<
+                    decltype(begin_it)>::value,
+                "Iterator must model RandomAccessIterator");
+  RAJA_INSTRUMENT_LAUNCH(histogram, ExecPolicy, distance_it);
+  impl::histogram::scatter_add(ExecPolicy{},
+                               begin_it,
+                               static_cast<Index_type>(distance_it),
+                               out,
+                               num_bins,
+                               index_of,
+                               value_of);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  histogram execution pattern
+*
+*         Counts, into bins, how many indices of the iteration space fall in
+*         each bin; bin_of(i) returns the bin of index i. This replaces
+*
+*           RAJA::forall<ExecPolicy>(c, [=](Index_type i) {
+*             RAJA::atomic::atomicAdd<AtomicPolicy>(&bins[bin_of(i)], 1);
+*           });
+*
+*         with RAJA::histogram<ExecPolicy>(c, bins, num_bins, bin_of) and
+*         avoids contended atomics on small numbers of bins; see
+*         scatter_add.
+*
+* \param[in] c iteration space, e.g. a range or list segment
+* \param[in,out] bins array of num_bins counters to add into
+* \param[in] num_bins number of bins
+* \param[in] bin_of function of the index returning its bin
+*
+******************************************************************************
+*/
+template <typename ExecPolicy, typename Container, typename T, typename BinFn>
+concepts::enable_if<type_traits::is_execution_policy<ExecPolicy>,
+                    type_traits::is_range<Container>>
+histogram(Container&& c, T* bins, Index_type num_bins, BinFn bin_of)
+{
+  scatter_add<ExecPolicy>(std::forward<Container>(c),
+                          bins,
+                          num_bins,
+                          bin_of,
+                          detail::HistogramCount<T>{});
+}
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
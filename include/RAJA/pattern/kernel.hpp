@@ -35,6 +35,7 @@
 #include "RAJA/pattern/kernel/internal.hpp"
 
 #include "RAJA/util/chai_support.hpp"
+#include "RAJA/util/instrument.hpp"
 
 #include "RAJA/pattern/shared_memory.hpp"
 
@@ -43,6 +44,7 @@
 #include "camp/tuple.hpp"
 
 #include <iostream>
+#include <iterator>
 #include <type_traits>
 
 namespace RAJA
@@ -64,6 +66,26 @@ template <camp::idx_t... ArgumentId>
 using ArgList = camp::idx_seq<ArgumentId...>;
 
 
+namespace internal
+{
+
+//! Number of points in the iteration space spanned by a tuple of segments
+template <typename SegmentTuple, camp::idx_t... Idx>
+RAJA_INLINE Index_type count_iterations(SegmentTuple const &segments,
+                                        camp::idx_seq<Idx...> const &)
+{
+  Index_type num_iterations = 1;
+  int expand[] = {0,
+                  (num_iterations *= static_cast<Index_type>(
+                       std::distance(camp::get<Idx>(segments).begin(),
+                                     camp::get<Idx>(segments).end())),
+                   0)...};
+  (void)expand;
+  return num_iterations;
+}
+
+}  // end namespace internal
+
 template <typename PolicyType,
           typename SegmentTuple,
           typename ParamTuple,
@@ -82,6 +104,13 @@ RAJA_INLINE void kernel_param(SegmentTuple &&segments,
   using segment_tuple_t = camp::decay<SegmentTuple>;
   using param_tuple_t = camp::decay<ParamTuple>;
 
+  RAJA_INSTRUMENT_LAUNCH(
+      kernel,
+      PolicyType,
+      internal::count_iterations(
+          segments,
+          camp::make_idx_seq_t<camp::tuple_size<segment_tuple_t>::value>{}));
+
   using loop_data_t = internal::LoopData<PolicyType,
                                          segment_tuple_t,
                                          param_tuple_t,
@@ -187,6 +187,41 @@ class ReduceMaxLoc;
  */
 template <typename REDUCE_POLICY_T, typename T>
 class ReduceSum;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reducer class template for several reductions at once.
+ *
+ * Each template argument after the policy is the operator of one value:
+ * RAJA::reduce::sum, min, max, minloc or maxloc of a type. The values
+ * are combined across threads together, in one step per thread.
+ *
+ * Usage example:
+ *
+ * \verbatim
+
+   Real_ptr data = ...;
+   ReduceTuple<reduce_policy,
+               reduce::sum<Real_type>,
+               reduce::min<Real_type>,
+               reduce::maxloc<Real_type>> my_vals(0.0, init_min, init_max);
+
+   forall<exec_policy>( ..., [=] (Index_type i) {
+      my_vals.combine<0>(data[i]);
+      my_vals.combine<1>(data[i]);
+      my_vals.combine<2>(data[i], i);
+   }
+
+   Real_type sum = my_vals.get<0>();
+   Index_type maxloc = my_vals.getLoc<2>();
+
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename REDUCE_POLICY_T, typename... Ops>
+class ReduceTuple;
 }  // closing brace for RAJA namespace
 
 #endif  // closing endif for header file include guard
@@ -32,6 +32,7 @@
 
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/instrument.hpp"
 
 #include <iterator>
 #include <type_traits>
@@ -80,6 +81,7 @@ inclusive_scan_inplace(const ExecPolicy &p,
                 "Function must model BinaryFunction");
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
+  RAJA_INSTRUMENT_LAUNCH(scan, ExecPolicy, std::distance(begin, end));
   impl::scan::inclusive_inplace(p, begin, end, binop);
 }
 
@@ -114,6 +116,7 @@ exclusive_scan_inplace(const ExecPolicy &p,
                 "Function must model BinaryFunction");
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
+  RAJA_INSTRUMENT_LAUNCH(scan, ExecPolicy, std::distance(begin, end));
   impl::scan::exclusive_inplace(p, begin, end, binop, value);
 }
 
@@ -156,6 +159,7 @@ inclusive_scan(const ExecPolicy &p,
                 "Iterator must model RandomAccessIterator");
   static_assert(type_traits::is_random_access_iterator<IterOut>::value,
                 "Output Iterator must model RandomAccessIterator");
+  RAJA_INSTRUMENT_LAUNCH(scan, ExecPolicy, std::distance(begin, end));
   impl::scan::inclusive(p, begin, end, out, binop);
 }
 
@@ -200,6 +204,7 @@ exclusive_scan(const ExecPolicy &p,
                 "Iterator must model RandomAccessIterator");
   static_assert(type_traits::is_random_access_iterator<IterOut>::value,
                 "Output Iterator must model RandomAccessIterator");
+  RAJA_INSTRUMENT_LAUNCH(scan, ExecPolicy, std::distance(begin, end));
   impl::scan::exclusive(p, begin, end, out, binop, value);
 }
 
@@ -231,6 +236,9 @@ inclusive_scan_inplace(const ExecPolicy &p,
                 "Function must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container must model RandomAccessRange");
+  RAJA_INSTRUMENT_LAUNCH(scan,
+                         ExecPolicy,
+                         std::distance(std::begin(c), std::end(c)));
   impl::scan::inclusive_inplace(p, std::begin(c), std::end(c), binop);
 }
 
@@ -262,6 +270,9 @@ exclusive_scan_inplace(const ExecPolicy &p,
                 "Function must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container must model RandomAccessRange");
+  RAJA_INSTRUMENT_LAUNCH(scan,
+                         ExecPolicy,
+                         std::distance(std::begin(c), std::end(c)));
   impl::scan::exclusive_inplace(p, std::begin(c), std::end(c), binop, value);
 }
 
@@ -303,6 +314,9 @@ inclusive_scan(const ExecPolicy &p,
                 "Container must model RandomAccessRange");
   static_assert(type_traits::is_random_access_iterator<IterOut>::value,
                 "Output Iterator must model RandomAccessIterator");
+  RAJA_INSTRUMENT_LAUNCH(scan,
+                         ExecPolicy,
+                         std::distance(std::begin(c), std::end(c)));
   impl::scan::inclusive(p, std::begin(c), std::end(c), out, binop);
 }
 
@@ -346,6 +360,9 @@ exclusive_scan(const ExecPolicy &p,
                 "Container must model RandomAccessRange");
   static_assert(type_traits::is_random_access_iterator<IterOut>::value,
                 "Output Iterator must model RandomAccessIterator");
+  RAJA_INSTRUMENT_LAUNCH(scan,
+                         ExecPolicy,
+                         std::distance(std::begin(c), std::end(c)));
   impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
 }
 
@@ -41,6 +41,26 @@ void synchronize()
 {
   synchronize_impl(Policy{});
 }
+
+/*!
+ * \brief Synchronize with the launches that returned the given events.
+ *
+ * \code
+ *
+ * auto event = RAJA::forall<RAJA::async_exec<>>(range, body);
+ * RAJA::synchronize<RAJA::async_synchronize>(event);
+ *
+ * \endcode
+ *
+ * \tparam Policy synchronization policy
+ *
+ * \see RAJA::policy::threads::synchronize_impl
+ */
+template <typename Policy, typename Event, typename... Events>
+void synchronize(Event& event, Events&... events)
+{
+  synchronize_impl(Policy{}, event, events...);
+}
 }
 
 #endif  // RAJA_synchronize_HPP
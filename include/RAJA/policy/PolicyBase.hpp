@@ -40,7 +40,8 @@ enum class Policy {
   openmp,
   target_openmp,
   cuda,
-  tbb
+  tbb,
+  threads
 };
 
 enum class Pattern { undefined, forall, region, reduce, taskgraph, synchronize };
@@ -168,6 +169,9 @@ template <typename Pol>
 struct is_tbb_policy : RAJA::policy_is<Pol, RAJA::Policy::tbb> {
 };
 template <typename Pol>
+struct is_threads_policy : RAJA::policy_is<Pol, RAJA::Policy::threads> {
+};
+template <typename Pol>
 struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
@@ -175,6 +179,15 @@ template <typename Pol>
 struct is_cuda_policy : RAJA::policy_is<Pol, RAJA::Policy::cuda> {
 };
 
+//! True for policies whose launches return before the work has completed.
+template <typename Pol, typename = void>
+struct is_async_policy : camp::false_type {
+};
+template <typename Pol>
+struct is_async_policy<Pol, decltype(void(camp::decay<Pol>::launch))>
+    : RAJA::launch_is<Pol, RAJA::Launch::async> {
+};
+
 DefineTypeTraitFromConcept(is_execution_policy,
                            RAJA::concepts::ExecutionPolicy);
 
@@ -0,0 +1,388 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining atomic operations with an explicit
+ *          memory ordering.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_atomic_ordered_HPP
+#define RAJA_policy_atomic_ordered_HPP
+
+#include "RAJA/config.hpp"
+#include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/util/TypeConvert.hpp"
+#include "RAJA/util/defines.hpp"
+
+#include <type_traits>
+
+
+namespace RAJA
+{
+namespace atomic
+{
+
+//! Memory ordering of the ordered_atomic policies, as for std::atomic.
+enum class memory_order { relaxed, acquire, release, acq_rel, seq_cst };
+
+
+#ifdef RAJA_COMPILER_MSVC
+
+
+/*!
+ * MS Visual C has no __atomic builtins; every ordering uses the
+ * builtin_atomic operations, which are sequentially consistent.
+ */
+template <memory_order Order>
+struct ordered_atomic : builtin_atomic {
+};
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicLoad(ordered_atomic<Order>, T volatile *acc)
+{
+  return atomicOr(builtin_atomic{}, acc, T(0));
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE void atomicStore(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  atomicExchange(builtin_atomic{}, acc, value);
+}
+
+
+#else  // not defined RAJA_COMPILER_MSVC
+
+
+/*!
+ * Atomic policy family using the compiler's __atomic builtins with the
+ * given memory ordering.
+ *
+ * Integral add, sub, and, or, xor, inc, dec and exchange map to native
+ * fetch-and-op instructions. Floating point add and sub, min, max and the
+ * wrapping inc and dec use a compare-and-swap loop that backs off for a
+ * bounded number of spins after each failed attempt. Operations that
+ * leave the value unchanged (e.g. a min that is already smaller) only load
+ * it, with the acquire part of the ordering.
+ *
+ * In addition to the usual operations these policies provide atomicLoad
+ * and atomicStore, e.g. for flags:
+ *
+ *   RAJA::atomic::atomicStore<RAJA::atomic::release_atomic>(&ready, 1);
+ *   while (!RAJA::atomic::atomicLoad<RAJA::atomic::acquire_atomic>(&ready)) {
+ *   }
+ */
+template <memory_order Order>
+struct ordered_atomic {
+};
+
+namespace detail
+{
+
+//! __ATOMIC_XXX constant of Order.
+constexpr int builtin_order(memory_order order)
+{
+  return order == memory_order::relaxed
+             ? __ATOMIC_RELAXED
+             : order == memory_order::acquire
+                   ? __ATOMIC_ACQUIRE
+                   : order == memory_order::release
+                         ? __ATOMIC_RELEASE
+                         : order == memory_order::acq_rel ? __ATOMIC_ACQ_REL
+                                                          : __ATOMIC_SEQ_CST;
+}
+
+/*!
+ * Ordering of loads done on behalf of Order, and of failed compare and
+ * swaps, which may not have release semantics.
+ */
+constexpr int builtin_load_order(memory_order order)
+{
+  return order == memory_order::release
+             ? __ATOMIC_RELAXED
+             : order == memory_order::acq_rel ? __ATOMIC_ACQUIRE
+                                              : builtin_order(order);
+}
+
+//! Ordering of stores done on behalf of Order.
+constexpr int builtin_store_order(memory_order order)
+{
+  return order == memory_order::acquire
+             ? __ATOMIC_RELAXED
+             : order == memory_order::acq_rel ? __ATOMIC_RELEASE
+                                              : builtin_order(order);
+}
+
+//! Order's __ATOMIC_XXX constants, as constant expressions.
+template <memory_order Order>
+struct BuiltinOrders {
+  enum : int {
+    rmw = builtin_order(Order),
+    load = builtin_load_order(Order),
+    store = builtin_store_order(Order)
+  };
+};
+
+//! Most spins between two attempts of a contended compare-and-swap loop.
+constexpr unsigned ordered_max_backoff = 64;
+
+RAJA_INLINE void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+template <size_t BYTES>
+struct OrderedCASType {
+  static_assert(BYTES == 4 || BYTES == 8,
+                "ordered atomic cas assumes 4 or 8 byte targets");
+};
+
+template <>
+struct OrderedCASType<4> {
+  using type = unsigned;
+};
+
+template <>
+struct OrderedCASType<8> {
+  using type = unsigned long long;
+};
+
+/*!
+ * Replace *acc by oper(*acc) unless done(*acc), using a compare-and-swap
+ * loop with bounded exponential backoff. Returns the OLD value.
+ */
+template <memory_order Order, typename T, typename OPER, typename Done>
+RAJA_INLINE T ordered_CAS_oper(T volatile *acc,
+                               OPER const &oper,
+                               Done const &done)
+{
+  using U = typename OrderedCASType<sizeof(T)>::type;
+  U volatile *uacc = reinterpret_cast<U volatile *>(acc);
+
+  U oldval = __atomic_load_n(uacc, BuiltinOrders<Order>::load);
+  unsigned backoff = 1;
+  while (true) {
+    const T old = RAJA::util::reinterp_A_as_B<U, T>(oldval);
+    if (done(old)) {
+      return old;
+    }
+    const U newval = RAJA::util::reinterp_A_as_B<T, U>(oper(old));
+    if (__atomic_compare_exchange_n(uacc,
+                                    &oldval,
+                                    newval,
+                                    true,
+                                    BuiltinOrders<Order>::rmw,
+                                    BuiltinOrders<Order>::load)) {
+      return old;
+    }
+    // oldval now holds the current value
+    for (unsigned i = 0; i < backoff; ++i) {
+      cpu_relax();
+    }
+    backoff = backoff < ordered_max_backoff ? 2 * backoff : backoff;
+  }
+}
+
+template <memory_order Order, typename T, typename OPER>
+RAJA_INLINE T ordered_CAS_oper(T volatile *acc, OPER const &oper)
+{
+  return ordered_CAS_oper<Order>(acc, oper, [](T const &) { return false; });
+}
+
+template <typename T>
+using is_fetch_op_type =
+    std::integral_constant<bool,
+                           std::is_integral<T>::value
+                               && !std::is_same<T, bool>::value>;
+
+template <memory_order Order, typename T>
+RAJA_INLINE T ordered_add(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_add(acc, value, BuiltinOrders<Order>::rmw);
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T ordered_add(T volatile *acc, T value, std::false_type)
+{
+  return ordered_CAS_oper<Order>(acc, [=](T a) { return a + value; });
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T ordered_sub(T volatile *acc, T value, std::true_type)
+{
+  return __atomic_fetch_sub(acc, value, BuiltinOrders<Order>::rmw);
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T ordered_sub(T volatile *acc, T value, std::false_type)
+{
+  return ordered_CAS_oper<Order>(acc, [=](T a) { return a - value; });
+}
+
+}  // namespace detail
+
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicLoad(ordered_atomic<Order>, T volatile *acc)
+{
+  return __atomic_load_n(acc, detail::BuiltinOrders<Order>::load);
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE void atomicStore(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  __atomic_store_n(acc, value, detail::BuiltinOrders<Order>::store);
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicAdd(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  return detail::ordered_add<Order>(acc,
+                                    value,
+                                    detail::is_fetch_op_type<T>{});
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicSub(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  return detail::ordered_sub<Order>(acc,
+                                    value,
+                                    detail::is_fetch_op_type<T>{});
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicMin(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  return detail::ordered_CAS_oper<Order>(acc,
+                                         [=](T) { return value; },
+                                         [=](T current) {
+                                           return !(value < current);
+                                         });
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicMax(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  return detail::ordered_CAS_oper<Order>(acc,
+                                         [=](T) { return value; },
+                                         [=](T current) {
+                                           return !(current < value);
+                                         });
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicInc(ordered_atomic<Order> pol, T volatile *acc)
+{
+  return atomicAdd(pol, acc, T(1));
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicInc(ordered_atomic<Order>, T volatile *acc, T val)
+{
+  return detail::ordered_CAS_oper<Order>(acc, [=](T old) {
+    return ((old >= val) ? 0 : (old + 1));
+  });
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicDec(ordered_atomic<Order> pol, T volatile *acc)
+{
+  return atomicSub(pol, acc, T(1));
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicDec(ordered_atomic<Order>, T volatile *acc, T val)
+{
+  return detail::ordered_CAS_oper<Order>(acc, [=](T old) {
+    return (((old == 0) | (old > val)) ? val : (old - 1));
+  });
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicAnd(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  return __atomic_fetch_and(acc, value, detail::BuiltinOrders<Order>::rmw);
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicOr(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  return __atomic_fetch_or(acc, value, detail::BuiltinOrders<Order>::rmw);
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicXor(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  return __atomic_fetch_xor(acc, value, detail::BuiltinOrders<Order>::rmw);
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicExchange(ordered_atomic<Order>, T volatile *acc, T value)
+{
+  using U = typename detail::OrderedCASType<sizeof(T)>::type;
+  return RAJA::util::reinterp_A_as_B<U, T>(
+      __atomic_exchange_n(reinterpret_cast<U volatile *>(acc),
+                          RAJA::util::reinterp_A_as_B<T, U>(value),
+                          detail::BuiltinOrders<Order>::rmw));
+}
+
+template <memory_order Order, typename T>
+RAJA_INLINE T atomicCAS(ordered_atomic<Order>,
+                        T volatile *acc,
+                        T compare,
+                        T value)
+{
+  using U = typename detail::OrderedCASType<sizeof(T)>::type;
+  U ucompare = RAJA::util::reinterp_A_as_B<T, U>(compare);
+  __atomic_compare_exchange_n(reinterpret_cast<U volatile *>(acc),
+                              &ucompare,
+                              RAJA::util::reinterp_A_as_B<T, U>(value),
+                              false,
+                              detail::BuiltinOrders<Order>::rmw,
+                              detail::BuiltinOrders<Order>::load);
+  return RAJA::util::reinterp_A_as_B<U, T>(ucompare);
+}
+
+
+#endif  // RAJA_COMPILER_MSVC
+
+
+//! Counters that only need atomicity, no ordering of other memory accesses.
+using relaxed_atomic = ordered_atomic<memory_order::relaxed>;
+
+//! Later accesses are not moved before the atomic, e.g. reading a flag.
+using acquire_atomic = ordered_atomic<memory_order::acquire>;
+
+//! Earlier accesses are not moved after the atomic, e.g. setting a flag.
+using release_atomic = ordered_atomic<memory_order::release>;
+
+using acq_rel_atomic = ordered_atomic<memory_order::acq_rel>;
+
+using seq_cst_atomic = ordered_atomic<memory_order::seq_cst>;
+
+
+}  // namespace atomic
+}  // namespace RAJA
+
+#endif
@@ -35,6 +35,9 @@
 
 #include "RAJA/policy/loop/policy.hpp"
 
+#include "RAJA/index/BitmapSegment.hpp"
+#include "RAJA/index/BlockListSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
@@ -69,6 +72,61 @@ RAJA_INLINE void forall_impl(const loop_exec &, Iterable &&iter, Func &&body)
   }
 }
 
+//! Compressed list segments are decoded a block at a time, see the
+//! seq_exec version.
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const loop_exec &,
+                             TypedCompressedListSegment<T> seg,
+                             Func &&body)
+{
+  T indices[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.num_blocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type n = seg.decodeBlock(b, indices);
+    for (Index_type k = 0; k < n; ++k) {
+      body(indices[k]);
+    }
+  }
+}
+
+//! Bitmap segments are traversed a word at a time, see the seq_exec
+//! version.
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const loop_exec &,
+                             TypedBitmapSegment<T> seg,
+                             Func &&body)
+{
+  const std::uint64_t* words = seg.words();
+  const Index_type num_words = seg.num_words();
+  for (Index_type w = 0; w < num_words; ++w) {
+    const T base = seg.wordBase(w);
+    if (words[w] == ~std::uint64_t(0)) {
+      for (Index_type j = 0; j < RAJA::detail::bitmap_word_bits; ++j) {
+        body(static_cast<T>(base + j));
+      }
+    } else {
+      RAJA::detail::bitmapWordForEach(words[w], base, body);
+    }
+  }
+}
+
+//! Block list segments run an inner loop over each block in turn, which the
+//! compiler is free to vectorize.
+template <typename T, Index_type BlockSize, typename Func>
+RAJA_INLINE void forall_impl(const loop_exec &,
+                             TypedBlockListSegment<T, BlockSize> seg,
+                             Func &&body)
+{
+  const T* starts = seg.blockStarts();
+  const Index_type num_blocks = seg.num_blocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const T start = starts[b];
+    for (Index_type j = 0; j < BlockSize; ++j) {
+      body(static_cast<T>(start + j));
+    }
+  }
+}
+
 }  // closing brace for loop namespace
 
 }  // closing brace for policy namespace
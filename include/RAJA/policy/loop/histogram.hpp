@@ -0,0 +1,76 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_loop_HPP
+#define RAJA_histogram_loop_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/defines.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/loop/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+/*!
+        \brief explicit scatter-add given iteration range, output bins, and
+   index and value functions
+
+   A single thread adds straight into the output.
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename T,
+          typename IndexFn,
+          typename ValueFn>
+concepts::enable_if<type_traits::is_loop_policy<ExecPolicy>> scatter_add(
+    const ExecPolicy &,
+    Iter begin,
+    Index_type len,
+    T *out,
+    Index_type,
+    IndexFn index_of,
+    ValueFn value_of)
+{
+  for (Index_type i = 0; i < len; ++i) {
+    const auto idx = begin[i];
+    out[index_of(idx)] += value_of(idx);
+  }
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
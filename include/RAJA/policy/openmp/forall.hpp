@@ -37,17 +37,23 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/index/BitmapSegment.hpp"
+#include "RAJA/index/BlockListSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/reproducible.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
 
+#include <atomic>
 #include <iostream>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
@@ -110,11 +116,120 @@ RAJA_INLINE void forall_impl(const omp_for_exec&,
   }
 }
 
+
+/*!
+ * Compressed list segments are shared out a block at a time and each
+ * thread decodes its blocks into a buffer on its stack. The segment is
+ * taken by value, which only copies a shared pointer, so that these
+ * overloads are preferred to the ones above for segments of any value
+ * category.
+ */
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_nowait_exec&,
+                             TypedCompressedListSegment<T> seg,
+                             Func&& loop_body)
+{
+  T indices[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.num_blocks();
+#pragma omp for nowait
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type n = seg.decodeBlock(b, indices);
+    for (Index_type k = 0; k < n; ++k) {
+      loop_body(indices[k]);
+    }
+  }
+}
+
+
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_exec&,
+                             TypedCompressedListSegment<T> seg,
+                             Func&& loop_body)
+{
+  T indices[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.num_blocks();
+#pragma omp for
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type n = seg.decodeBlock(b, indices);
+    for (Index_type k = 0; k < n; ++k) {
+      loop_body(indices[k]);
+    }
+  }
+}
+
+
+/*!
+ * Bitmap segments are shared out a 64 bit word at a time, each thread
+ * running full words as a contiguous loop and scanning the set bits of
+ * the others. Taken by value for the same reason as compressed lists.
+ */
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_nowait_exec&,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  const Index_type num_words = seg.num_words();
+#pragma omp for nowait
+  for (Index_type w = 0; w < num_words; ++w) {
+    RAJA::detail::bitmapForEachInWord(seg, w, loop_body);
+  }
+}
+
+
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_exec&,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  const Index_type num_words = seg.num_words();
+#pragma omp for
+  for (Index_type w = 0; w < num_words; ++w) {
+    RAJA::detail::bitmapForEachInWord(seg, w, loop_body);
+  }
+}
+
+
+//! Block list segments are shared out a block at a time, each thread
+//! running an inner loop over its blocks.
+template <typename T, Index_type BlockSize, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_nowait_exec&,
+                             TypedBlockListSegment<T, BlockSize> seg,
+                             Func&& loop_body)
+{
+  const T* starts = seg.blockStarts();
+  const Index_type num_blocks = seg.num_blocks();
+#pragma omp for nowait
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const T start = starts[b];
+    for (Index_type j = 0; j < BlockSize; ++j) {
+      loop_body(static_cast<T>(start + j));
+    }
+  }
+}
+
+
+template <typename T, Index_type BlockSize, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_exec&,
+                             TypedBlockListSegment<T, BlockSize> seg,
+                             Func&& loop_body)
+{
+  const T* starts = seg.blockStarts();
+  const Index_type num_blocks = seg.num_blocks();
+#pragma omp for
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const T start = starts[b];
+    for (Index_type j = 0; j < BlockSize; ++j) {
+      loop_body(static_cast<T>(start + j));
+    }
+  }
+}
+
+
 ///
 /// OpenMP parallel for static policy implementation
 ///
 
-template <typename Iterable, typename Func, size_t ChunkSize>
+template <typename Iterable, typename Func, unsigned int ChunkSize>
 RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
                              Iterable&& iter,
                              Func&& loop_body)
@@ -126,6 +241,142 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
   }
 }
 
+
+//! Compressed list segments are scheduled in chunks of whole blocks of
+//! about ChunkSize indices, see the omp_for_exec version.
+template <typename T, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
+                             TypedCompressedListSegment<T> seg,
+                             Func&& loop_body)
+{
+  const Index_type block_size = TypedCompressedListSegment<T>::block_size;
+  const Index_type chunk_blocks =
+      ChunkSize > block_size ? ChunkSize / block_size : 1;
+  T indices[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.num_blocks();
+#pragma omp for schedule(static, chunk_blocks)
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type n = seg.decodeBlock(b, indices);
+    for (Index_type k = 0; k < n; ++k) {
+      loop_body(indices[k]);
+    }
+  }
+}
+
+
+//! Bitmap segments are scheduled in chunks of whole words of about
+//! ChunkSize indices, see the omp_for_exec version.
+template <typename T, typename Func, unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  const Index_type num_words = seg.num_words();
+  const Index_type chunk_words =
+      ChunkSize > RAJA::detail::bitmap_word_bits
+          ? ChunkSize / RAJA::detail::bitmap_word_bits
+          : 1;
+#pragma omp for schedule(static, chunk_words)
+  for (Index_type w = 0; w < num_words; ++w) {
+    RAJA::detail::bitmapForEachInWord(seg, w, loop_body);
+  }
+}
+
+
+//! Block list segments are scheduled in chunks of whole blocks of about
+//! ChunkSize indices, see the omp_for_exec version.
+template <typename T,
+          Index_type BlockSize,
+          typename Func,
+          unsigned int ChunkSize>
+RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
+                             TypedBlockListSegment<T, BlockSize> seg,
+                             Func&& loop_body)
+{
+  const T* starts = seg.blockStarts();
+  const Index_type num_blocks = seg.num_blocks();
+  const Index_type chunk_blocks =
+      ChunkSize > BlockSize ? ChunkSize / BlockSize : 1;
+#pragma omp for schedule(static, chunk_blocks)
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const T start = starts[b];
+    for (Index_type j = 0; j < BlockSize; ++j) {
+      loop_body(static_cast<T>(start + j));
+    }
+  }
+}
+
+
+///
+/// OpenMP static block policy implementation
+///
+
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_static_block&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_t = decltype(distance_it);
+  const diff_t num_threads = omp_get_num_threads();
+  const diff_t tid = omp_get_thread_num();
+  // the first len % T threads take one extra iteration; no intermediate
+  // product, so any length representable in diff_t is safe
+  const diff_t chunk = distance_it / num_threads;
+  const diff_t rem = distance_it % num_threads;
+  const diff_t block_begin = tid * chunk + (tid < rem ? tid : rem);
+  const diff_t block_end = block_begin + chunk + (tid < rem ? 1 : 0);
+  for (diff_t i = block_begin; i < block_end; ++i) {
+    loop_body(begin_it[i]);
+  }
+#pragma omp barrier
+}
+
+//! Bitmap segments are split into blocks of whole words.
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const omp_for_static_block& p,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  forall_impl(p,
+              TypedRangeSegment<Index_type>(0, seg.num_words()),
+              RAJA::detail::BitmapWordBody<T, camp::decay<Func>>{seg,
+                                                                 loop_body});
+}
+
+///
+/// OpenMP reproducible policy implementation
+///
+/// Blocks are fixed by BlockSize and the loop length only; the thread that
+/// runs a block does not matter. Reproducible loops must not be nested in
+/// each other.
+///
+
+template <typename Iterable, typename Func, unsigned int BlockSize>
+RAJA_INLINE void forall_impl(const omp_for_reproducible<BlockSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  static_assert(BlockSize > 0, "BlockSize must be positive");
+
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_t = decltype(distance_it);
+  const diff_t block_size = BlockSize;
+  const diff_t num_blocks = (distance_it + block_size - 1) / block_size;
+#pragma omp for schedule(static)
+  for (diff_t b = 0; b < num_blocks; ++b) {
+    RAJA::detail::ReproducibleBlock block(b);
+    // reducers copied with the body collect the partial result of block b
+    camp::decay<Func> body(loop_body);
+    const diff_t block_end =
+        (b + 1) * block_size < distance_it ? (b + 1) * block_size
+                                           : distance_it;
+    for (diff_t i = b * block_size; i < block_end; ++i) {
+      body(begin_it[i]);
+    }
+  }
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -136,30 +387,89 @@ RAJA_INLINE void forall_impl(const omp_for_static<ChunkSize>&,
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace detail
+{
+
 /*!
- ******************************************************************************
- *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
- *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
- *
- ******************************************************************************
+ * Shared state of one traversal of an index set dependency graph. Every
+ * thread in the team registers its private copy of the loop body in
+ * bodies[thread_num].
  */
+template <typename Body, typename... SegmentTypes>
+struct TaskGraphTraversal {
+  TypedIndexSet<SegmentTypes...>& iset;
+  Body** bodies;
+  std::atomic<int> num_executed;
+
+  TaskGraphTraversal(TypedIndexSet<SegmentTypes...>& iset_, Body** bodies_)
+      : iset(iset_), bodies(bodies_), num_executed(0)
+  {
+  }
 
-/*
- * TODO: Fix this!!!
- */
+  //! Execute one segment on the calling thread and re-arm its semaphore.
+  void run(int segid)
+  {
+    (*bodies[omp_get_thread_num()])(segid);
+    iset.getDepGraphNode(segid)->reset();
+    ++num_executed;
+  }
+
+  //! Execute a ready segment as a task, then launch every dependent for
+  //! which it satisfied the last dependency.
+  static void runTask(TaskGraphTraversal* traversal, int segid)
+  {
+    traversal->run(segid);
+
+    DepGraphNode* task = traversal->iset.getDepGraphNode(segid);
+    for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+      int dep = task->depTaskNum(ii);
+      if (traversal->iset.getDepGraphNode(dep)->satisfyOne()) {
+#pragma omp task firstprivate(traversal, dep)
+        runTask(traversal, dep);
+      }
+    }
+  }
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+  //! Launch all segments without incoming dependencies; the rest are
+  //! launched by runTask as they become ready.
+  void launchRoots()
+  {
+    const int num_seg = iset.getNumSegments();
+    for (int isi = 0; isi < num_seg; ++isi) {
+      if (iset.getDepGraphNode(isi)->semaphoreReloadValue() == 0) {
+        TaskGraphTraversal* traversal = this;
+#pragma omp task firstprivate(traversal, isi)
+        runTask(traversal, isi);
+      }
+    }
+  }
+
+  //! Execute the segments of an interval in order on the calling thread,
+  //! blocking on each until its dependencies are satisfied.
+  void runInterval(int interval)
+  {
+    const int first = iset.getSegmentIntervalBegin(interval);
+    const int last = iset.getSegmentIntervalEnd(interval);
+    for (int isi = first; isi < last; ++isi) {
+      DepGraphNode* task = iset.getDepGraphNode(isi);
+      task->wait();
+      run(isi);
+      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+        iset.getDepGraphNode(task->depTaskNum(ii))->satisfyOne();
+      }
+    }
+  }
+};
+
+/*!
+ * Traverse the dependency graph of iset. With by_interval, thread t
+ * executes segment interval t; if the team is too small for that the
+ * segments are scheduled as tasks instead.
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_taskgraph(const TypedIndexSet<SegmentTypes...>& iset,
+                                  Func&& loop_body,
+                                  bool by_interval)
 {
   if (!iset.dependencyGraphSet()) {
     std::cerr << "\n RAJA IndexSet dependency graph not set , "
@@ -167,36 +477,86 @@ RAJA_INLINE void forall(
     RAJA_ABORT_OR_THROW("IndexSet dependency graph");
   }
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
-
-  int num_seg = ncis.getNumSegments();
-
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
-
-    task->wait();
+  // The semaphores are execution state, updated during const traversal.
+  auto& ncis = const_cast<TypedIndexSet<SegmentTypes...>&>(iset);
+
+  const int num_intervals = static_cast<int>(iset.getNumSegmentIntervals());
+  const int num_threads =
+      by_interval ? num_intervals : omp_get_max_threads();
+
+  using RAJA::internal::thread_privatize;
+  using body_type =
+      camp::decay<decltype(thread_privatize(loop_body).get_priv())>;
+  std::vector<body_type*> bodies(num_threads > 0 ? num_threads : 1);
+  TaskGraphTraversal<body_type, SegmentTypes...> traversal(ncis,
+                                                           bodies.data());
+
+#pragma omp parallel num_threads(bodies.size())
+  {
+    auto privatizer = thread_privatize(loop_body);
+    bodies[omp_get_thread_num()] = &privatizer.get_priv();
+#pragma omp barrier
+
+    if (by_interval && omp_get_num_threads() == num_intervals) {
+      traversal.runInterval(omp_get_thread_num());
+    } else {
+#pragma omp single
+      traversal.launchRoots();
+    }
+  }  // implicit barrier completes all tasks
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+  if (!by_interval && traversal.num_executed
+                          != static_cast<int>(iset.getNumSegments())) {
+    std::cerr << "\n RAJA IndexSet dependency graph has a cycle , "
+              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
+    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+  }
+}
 
-    task->reset();
+}  // closing brace for detail namespace
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
-    }
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using the segment dependency
+ *         graph. Individual segment execution will use execution policy
+ *         template parameter.
+ *
+ *         Each segment runs as an OpenMP task as soon as all segments it
+ *         depends on have completed; idle threads pick up ready segments.
+ *         The index set must have an acyclic dependency graph (see
+ *         TypedIndexSet::initDependencyGraph).
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  detail::forall_taskgraph(iset, loop_body, false);
+}
 
-  }  // iterate over segments of index set
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using the segment dependency
+ *         graph, with thread t executing the segments of interval t (see
+ *         TypedIndexSet::setSegmentInterval) in order. Individual segment
+ *         execution will use execution policy template parameter.
+ *
+ *         A thread whose next segment is not ready waits for it, so the
+ *         intervals must be ordered consistently with the graph.
+ *
+ ******************************************************************************
+ */
+template <typename Func, typename... SegmentTypes>
+RAJA_INLINE void forall_impl(const omp_taskgraph_interval_segit&,
+                             const TypedIndexSet<SegmentTypes...>& iset,
+                             Func&& loop_body)
+{
+  detail::forall_taskgraph(iset, loop_body, true);
 }
-*/
 
 }  // closing brace for omp namespace
 
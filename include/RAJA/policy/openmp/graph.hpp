@@ -0,0 +1,117 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the OpenMP team replay of a LoopGraph.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_graph_openmp_HPP
+#define RAJA_graph_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/policy/openmp/persistent.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/pattern/graph.hpp"
+
+#include <omp.h>
+
+namespace RAJA
+{
+
+namespace policy
+{
+
+namespace omp
+{
+
+namespace detail
+{
+
+/*!
+ * Share of graph executed by thread tid of a team of num_threads. Forall
+ * launches recorded with a parallel policy are split into contiguous
+ * blocks, other launches run whole with their recorded policy on one
+ * thread each, round-robin within a phase. Threads only synchronize where
+ * the phase changes.
+ */
+inline void replayGraphOnTeam(const void* data, int tid, int num_threads)
+{
+  const LoopGraph& graph = *static_cast<const LoopGraph*>(data);
+
+  int whole_count = 0;
+  for (int j = 0; j < graph.getNumNodes(); ++j) {
+    if (j > 0 && graph.getPhase(j) != graph.getPhase(j - 1)) {
+#pragma omp barrier
+      whole_count = 0;
+    }
+
+    const RAJA::detail::LoopGraphNodeBase& node = graph.getNode(j);
+    const Index_type len = node.length();
+    if (len > 0) {
+      const Index_type chunk = len / num_threads;
+      const Index_type rem = len % num_threads;
+      const Index_type first = tid * chunk + (tid < rem ? tid : rem);
+      node.executeRange(first, first + chunk + (tid < rem ? 1 : 0));
+    } else if (whole_count++ % num_threads == tid) {
+      node.execute();
+    }
+  }
+}
+
+}  // closing brace for detail namespace
+
+/*!
+ * \brief LoopGraph replay on an OpenMP team.
+ *
+ * The whole graph is one team launch: the persistent team when called from
+ * the thread that entered an omp_persistent_region, otherwise a single
+ * parallel region. Forall launches recorded with a parallel policy are
+ * split across the team instead of using that policy; sequential launches
+ * keep their recorded policy and run on a single thread.
+ */
+RAJA_INLINE void graph_replay_impl(const omp_persistent_exec&,
+                                   const LoopGraph& graph)
+{
+  const void* data = static_cast<const void*>(&graph);
+
+  detail::PersistentTeam* team = detail::PersistentTeam::current();
+  if (team != nullptr && !team->inLaunch()) {
+    team->launch(&detail::replayGraphOnTeam, data);
+    return;
+  }
+
+#pragma omp parallel
+  detail::replayGraphOnTeam(data, omp_get_thread_num(), omp_get_num_threads());
+}
+
+}  // closing brace for omp namespace
+
+}  // closing brace for policy namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
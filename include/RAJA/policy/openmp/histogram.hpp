@@ -0,0 +1,174 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+
+#ifndef RAJA_histogram_openmp_HPP
+#define RAJA_histogram_openmp_HPP
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/atomic.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/pattern/detail/histogram.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+namespace detail
+{
+
+//! Policies that open their own parallel region for each loop.
+template <typename InnerPolicy>
+std::true_type opens_region(const omp_parallel_exec<InnerPolicy>*);
+std::true_type opens_region(const omp_persistent_exec*);
+std::false_type opens_region(const void*);
+
+/*!
+ * Scatter-add run by every thread of the innermost enclosing team, using
+ * orphaned worksharing constructs. Each thread adds its static block of
+ * iterations into its own copy of the bins, then the team merges the
+ * copies, each thread summing a block of bins. Atomics into the output are
+ * used instead when the copies would not stay in cache or the merge would
+ * cost more than the loop; see select_strategy. The team synchronizes
+ * before returning, so out is complete on every thread.
+ */
+template <typename Iter, typename T, typename IndexFn, typename ValueFn>
+void scatter_add_team(Iter begin,
+                      Index_type len,
+                      T* out,
+                      Index_type num_bins,
+                      IndexFn index_of,
+                      ValueFn value_of)
+{
+  const int num_threads = omp_get_num_threads();
+
+  switch (select_strategy<T>(num_bins, len, num_threads)) {
+    case Strategy::direct:
+      for (Index_type i = 0; i < len; ++i) {
+        const auto idx = begin[i];
+        out[index_of(idx)] += value_of(idx);
+      }
+      break;
+
+    case Strategy::atomic:
+#pragma omp for schedule(static)
+      for (Index_type i = 0; i < len; ++i) {
+        const auto idx = begin[i];
+        RAJA::atomic::atomicAdd(RAJA::atomic::omp_atomic{},
+                                &out[index_of(idx)],
+                                static_cast<T>(value_of(idx)));
+      }
+      break;
+
+    case Strategy::privatized: {
+      std::shared_ptr<PrivateBins<T>> bins;
+#pragma omp single copyprivate(bins)
+      bins = std::make_shared<PrivateBins<T>>(num_threads, num_bins);
+
+      const int tid = omp_get_thread_num();
+      T* mine = bins->row(tid);
+      bins->clear(tid, num_bins);
+
+#pragma omp for schedule(static) nowait
+      for (Index_type i = 0; i < len; ++i) {
+        const auto idx = begin[i];
+        mine[index_of(idx)] += value_of(idx);
+      }
+
+#pragma omp barrier
+
+      const Index_type chunk = (num_bins + num_threads - 1) / num_threads;
+      const Index_type first = std::min(num_bins, tid * chunk);
+      const Index_type last = std::min(num_bins, first + chunk);
+      bins->mergeInto(out, num_threads, first, last);
+
+#pragma omp barrier
+      break;
+    }
+  }
+}
+
+}  // namespace detail
+
+/*!
+        \brief explicit scatter-add given iteration range, output bins, and
+   index and value functions
+
+   Parallel policies (omp_parallel_exec and omp_persistent_exec) open a
+   region for the scatter-add. Worksharing policies such as omp_for_exec
+   share the work among the team of an enclosing region, and must then be
+   called by every thread of the team, as forall would be; outside a region
+   they open one as well.
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename T,
+          typename IndexFn,
+          typename ValueFn>
+concepts::enable_if<type_traits::is_openmp_policy<ExecPolicy>> scatter_add(
+    const ExecPolicy&,
+    Iter begin,
+    Index_type len,
+    T* out,
+    Index_type num_bins,
+    IndexFn index_of,
+    ValueFn value_of)
+{
+  using opens_region =
+      decltype(detail::opens_region(static_cast<const ExecPolicy*>(nullptr)));
+
+  if (!opens_region::value && omp_in_parallel()) {
+    detail::scatter_add_team(begin, len, out, num_bins, index_of, value_of);
+  } else if (omp_get_max_threads() <= 1) {
+    for (Index_type i = 0; i < len; ++i) {
+      const auto idx = begin[i];
+      out[index_of(idx)] += value_of(idx);
+    }
+  } else {
+#pragma omp parallel
+    detail::scatter_add_team(begin, len, out, num_bins, index_of, value_of);
+  }
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,320 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the OpenMP persistent team region and the
+ *          forall that launches onto it.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_persistent_openmp_HPP
+#define RAJA_persistent_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <omp.h>
+
+namespace RAJA
+{
+
+namespace policy
+{
+
+namespace omp
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Thread team kept alive by an omp_persistent_region.
+ *
+ *         The thread that entered the region launches work by publishing a
+ *         task and bumping the generation counter (release); every other
+ *         team thread runs its share and decrements the pending counter
+ *         (arrive), which the launching thread spins on. Idle threads spin
+ *         for a while and then sleep until the next launch.
+ *
+ ******************************************************************************
+ */
+class PersistentTeam
+{
+public:
+  using task_fn = void (*)(const void* data, int tid, int num_threads);
+
+  //! Number of polls before a waiting thread yields or sleeps.
+  static constexpr int spin_count = 4096;
+
+  explicit PersistentTeam(int num_threads)
+      : m_num_threads(num_threads),
+        m_generation(0),
+        m_pending(0),
+        m_sleepers(0),
+        m_shutdown(false),
+        m_in_launch(false),
+        m_task(nullptr),
+        m_data(nullptr)
+  {
+  }
+
+  PersistentTeam(const PersistentTeam&) = delete;
+  PersistentTeam& operator=(const PersistentTeam&) = delete;
+
+  //! Team of the innermost persistent region entered by the caller.
+  static PersistentTeam*& current()
+  {
+    static thread_local PersistentTeam* team = nullptr;
+    return team;
+  }
+
+  int getNumThreads() const { return m_num_threads; }
+
+  //! True while the launching thread is executing its share of a launch.
+  bool inLaunch() const { return m_in_launch; }
+
+  //! Run fn(data, tid, num_threads) on every team thread and wait.
+  void launch(task_fn fn, const void* data)
+  {
+    m_task = fn;
+    m_data = data;
+    m_pending.store(m_num_threads - 1, std::memory_order_relaxed);
+    release();
+
+    m_in_launch = true;
+    fn(data, 0, m_num_threads);
+    m_in_launch = false;
+
+    for (int spin = 0; m_pending.load(std::memory_order_acquire) != 0;
+         ++spin) {
+      if (spin >= spin_count) std::this_thread::yield();
+    }
+  }
+
+  //! Release the waiting threads from the region.
+  void stop()
+  {
+    m_shutdown = true;
+    release();
+  }
+
+  //! Loop of the team threads other than the launching one.
+  void work(int tid)
+  {
+    unsigned long seen = 0;
+    while (true) {
+      seen = waitForLaunch(seen);
+      if (m_shutdown) return;
+
+      m_task(m_data, tid, m_num_threads);
+      m_pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+  }
+
+private:
+  void release()
+  {
+    // seq_cst pairs with the sleeper registration in waitForLaunch: either
+    // the launcher sees the sleeper, or the sleeper sees the new generation
+    m_generation.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleepers.load(std::memory_order_seq_cst) > 0) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_wake.notify_all();
+    }
+  }
+
+  unsigned long waitForLaunch(unsigned long seen)
+  {
+    for (int spin = 0; spin < spin_count; ++spin) {
+      const unsigned long gen = m_generation.load(std::memory_order_acquire);
+      if (gen != seen) return gen;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+    m_wake.wait(lock, [this, seen] {
+      return m_generation.load(std::memory_order_seq_cst) != seen;
+    });
+    m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+    return m_generation.load(std::memory_order_acquire);
+  }
+
+  const int m_num_threads;
+
+  std::atomic<unsigned long> m_generation;
+  std::atomic<int> m_pending;
+  std::atomic<int> m_sleepers;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+
+  // written by the launching thread before the release, read after it
+  bool m_shutdown;
+  bool m_in_launch;
+  task_fn m_task;
+  const void* m_data;
+};
+
+/*!
+ * Launch data for a persistent team loop; thread t of T executes the t-th
+ * contiguous block of n/T iterations, the first n%T blocks holding one
+ * extra iteration, as omp_for_static_block does.
+ */
+template <typename Iter, typename IndexT, typename Func>
+struct PersistentLoop {
+  Iter begin_it;
+  IndexT len;
+  const Func& body;
+
+  static void execute(const void* data, int tid, int num_threads)
+  {
+    const PersistentLoop& loop = *static_cast<const PersistentLoop*>(data);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop.body);
+    auto& body = privatizer.get_priv();
+
+    // same partition as omp_for_static_block
+    const IndexT chunk = loop.len / num_threads;
+    const IndexT rem = loop.len % num_threads;
+    const IndexT first = tid * chunk + (tid < rem ? tid : rem);
+    const IndexT last = first + chunk + (tid < rem ? 1 : 0);
+    for (IndexT i = first; i < last; ++i) {
+      body(loop.begin_it[i]);
+    }
+  }
+};
+
+}  // closing brace for detail namespace
+
+/*!
+ * \brief RAJA::region implementation for a persistent OpenMP team.
+ *
+ * Opens one parallel region for the whole body. The body runs once, on the
+ * calling thread; omp_persistent_exec loops (including kernel For
+ * statements) launched from it run on the team without a fork/join.
+ *
+ * \code
+ *
+ * RAJA::region<RAJA::omp_persistent_region>([&]() {
+ *   for (int step = 0; step < num_steps; ++step) {
+ *     RAJA::forall<RAJA::omp_persistent_exec>(range, update);
+ *     RAJA::forall<RAJA::omp_persistent_exec>(range, flux);
+ *   }
+ * });
+ *
+ * \endcode
+ */
+template <typename Func>
+RAJA_INLINE void region_impl(const omp_persistent_region&, Func&& body)
+{
+  detail::PersistentTeam* team = nullptr;
+
+#pragma omp parallel shared(team)
+  {
+#pragma omp single
+    team = new detail::PersistentTeam(omp_get_num_threads());
+
+    if (omp_get_thread_num() == 0) {
+      detail::PersistentTeam*& current = detail::PersistentTeam::current();
+      detail::PersistentTeam* enclosing = current;
+      current = team;
+      body();
+      current = enclosing;
+      team->stop();
+    } else {
+      team->work(omp_get_thread_num());
+    }
+  }
+
+  delete team;
+}
+
+/*!
+ * \brief omp_persistent_exec implementation.
+ *
+ * Inside an omp_persistent_region, called from the thread that entered it,
+ * the loop is handed to the team. Anywhere else, including from inside a
+ * loop already running on the team, it runs as
+ * omp_parallel_for_static_block.
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const omp_persistent_exec&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  detail::PersistentTeam* team = detail::PersistentTeam::current();
+  if (team == nullptr || team->inLaunch()) {
+    forall_impl(omp_parallel_for_static_block{},
+                std::forward<Iterable>(iter),
+                std::forward<Func>(loop_body));
+    return;
+  }
+
+  RAJA_EXTRACT_BED_IT(iter);
+  using IndexT = decltype(distance_it);
+
+  if (team->getNumThreads() == 1 || distance_it <= 1) {
+    for (IndexT i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+    return;
+  }
+
+  using loop_type =
+      detail::PersistentLoop<decltype(begin_it), IndexT, camp::decay<Func>>;
+  loop_type loop{begin_it, distance_it, loop_body};
+  team->launch(&loop_type::execute, static_cast<const void*>(&loop));
+}
+
+//! Bitmap segments are split into blocks of whole words.
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const omp_persistent_exec& p,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  forall_impl(p,
+              TypedRangeSegment<Index_type>(0, seg.num_words()),
+              RAJA::detail::BitmapWordBody<T, camp::decay<Func>>{seg,
+                                                                 loop_body});
+}
+
+}  // closing brace for omp namespace
+
+}  // closing brace for policy namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
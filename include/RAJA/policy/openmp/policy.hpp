@@ -83,6 +83,18 @@ struct omp_parallel_region
                                             Platform::host> {
 };
   
+///
+/// Keeps one thread team alive for the duration of the region; the
+/// thread that entered the region runs its body while the other threads
+/// wait for omp_persistent_exec launches.
+///
+struct omp_persistent_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 struct omp_for_exec
     : make_policy_pattern_t<Policy::openmp, Pattern::forall, omp::For> {
 };
@@ -105,6 +117,35 @@ struct omp_for_static : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               omp::Static<N>> {
 };
 
+///
+/// Contiguous block partition: thread t of T always runs the t-th of T
+/// contiguous blocks of n/T iterations, the first n%T blocks holding one
+/// extra iteration, so loops of the same length map each iteration to
+/// the same thread on every launch, e.g. for NUMA first-touch.
+///
+struct omp_for_static_block
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For> {
+};
+
+
+///
+/// Cuts the iteration space into blocks of BlockSize iterations, whatever
+/// the number of threads, and runs each block with its own copy of the
+/// loop body; omp_reduce_reproducible reducers in the body then give
+/// bitwise identical results for any thread count.
+///
+template <unsigned int BlockSize>
+struct omp_for_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For> {
+};
 
 template <typename InnerPolicy>
 struct omp_parallel_exec
@@ -123,6 +164,28 @@ template <unsigned int N>
 struct omp_parallel_for_static : omp_parallel_exec<omp_for_static<N>> {
 };
 
+struct omp_parallel_for_static_block
+    : omp_parallel_exec<omp_for_static_block> {
+};
+
+template <unsigned int BlockSize>
+struct omp_parallel_for_reproducible
+    : omp_parallel_exec<omp_for_reproducible<BlockSize>> {
+};
+
+///
+/// Runs on the team of the enclosing omp_persistent_region, with the
+/// iteration partition of omp_for_static_block; outside such a region it
+/// behaves like omp_parallel_for_static_block.
+///
+struct omp_persistent_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::For> {
+};
+
 ///
 /// Policies for applying OpenMP clauses in forallN loop nests.
 ///
@@ -190,6 +253,17 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+struct omp_reduce_slots : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
+///
+/// Partial results are kept per iteration block of omp_for_reproducible
+/// loops and combined in a fixed order, independent of the thread count.
+///
+struct omp_reduce_reproducible
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
+};
+
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
                                                       Launch::sync> {
@@ -201,14 +275,24 @@ struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
 using policy::omp::omp_for_exec;
 using policy::omp::omp_for_nowait_exec;
 using policy::omp::omp_for_static;
+using policy::omp::omp_for_static_block;
+using policy::omp::omp_for_reproducible;
 using policy::omp::omp_parallel_exec;
 using policy::omp::omp_parallel_region;
+using policy::omp::omp_persistent_region;
+using policy::omp::omp_persistent_exec;
 using policy::omp::omp_parallel_for_exec;
+using policy::omp::omp_parallel_for_static_block;
+using policy::omp::omp_parallel_for_reproducible;
 using policy::omp::omp_parallel_segit;
 using policy::omp::omp_parallel_for_segit;
+using policy::omp::omp_taskgraph_segit;
+using policy::omp::omp_taskgraph_interval_segit;
 using policy::omp::omp_collapse_nowait_exec;
 using policy::omp::omp_reduce;
 using policy::omp::omp_reduce_ordered;
+using policy::omp::omp_reduce_slots;
+using policy::omp::omp_reduce_reproducible;
 using policy::omp::omp_synchronize;
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -38,6 +38,7 @@
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/reproducible.hpp"
 #include "RAJA/policy/openmp/target_reduce.hpp"
 
 #include <omp.h>
@@ -89,7 +90,8 @@ class ReduceOMPOrdered
           BaseCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPOrdered>;
-  std::shared_ptr<std::vector<T>> data;
+  using Slot = reduce::detail::PaddedValue<T>;
+  std::shared_ptr<std::vector<Slot>> data;
 
 public:
   ReduceOMPOrdered() { reset(T(), T()); }
@@ -103,26 +105,26 @@ public:
   void reset(T init_val, T identity_)
   {
     Base::reset(init_val, identity_);
-    data = std::shared_ptr<std::vector<T>>(
-        std::make_shared<std::vector<T>>(omp_get_max_threads(), identity_));
+    data = std::make_shared<std::vector<Slot>>(omp_get_max_threads(),
+                                               Slot(identity_));
   }
 
   ~ReduceOMPOrdered()
   {
-    Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
+    Reduce{}((*data)[omp_get_thread_num()].value, Base::my_data);
     Base::my_data = Base::identity;
   }
 
   T get_combined() const
   {
     if (Base::my_data != Base::identity) {
-      Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
+      Reduce{}((*data)[omp_get_thread_num()].value, Base::my_data);
       Base::my_data = Base::identity;
     }
 
     T res = Base::identity;
     for (size_t i = 0; i < data->size(); ++i) {
-      Reduce{}(res, (*data)[i]);
+      Reduce{}(res, (*data)[i].value);
     }
     return res;
   }
@@ -132,6 +134,142 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Per-thread slot reductions.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+/*!
+ * Each thread's copy folds its partial into that thread's cache-line padded
+ * slot when destroyed, without taking a lock; the slots are combined once
+ * in get(). Only copies destroyed directly in a single active parallel
+ * region, where thread numbers are unique, use the slots. Copies destroyed
+ * in nested regions (active or not), outside parallel regions, on threads
+ * not started by OpenMP, or by threads beyond the team size seen at
+ * construction fall back to the critical section used by omp_reduce.
+ */
+template <typename T, typename Reduce>
+class ReduceOMPSlots
+    : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMPSlots<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPSlots>;
+  using Slot = reduce::detail::PaddedValue<T>;
+  std::shared_ptr<std::vector<Slot>> data;
+
+public:
+  ReduceOMPSlots() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPSlots(T init_val, T identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    data = std::make_shared<std::vector<Slot>>(omp_get_max_threads(),
+                                               Slot(identity_));
+  }
+
+  ~ReduceOMPSlots()
+  {
+    if (Base::parent) {
+      const size_t tid = omp_get_thread_num();
+      if (omp_in_parallel() && omp_get_active_level() == 1
+          && omp_get_level() == 1 && tid < data->size()) {
+        Reduce{}((*data)[tid].value, Base::my_data);
+      } else {
+#pragma omp critical(ompReduceCritical)
+        Reduce{}(Base::parent->local(), Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    T res = Base::my_data;
+    for (size_t i = 0; i < data->size(); ++i) {
+      Reduce{}(res, (*data)[i].value);
+    }
+    return res;
+  }
+};
+
+} /* detail */
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_slots, detail::ReduceOMPSlots)
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reproducible reductions.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+/*!
+ * A copy destroyed while its thread runs a block of an omp_for_reproducible
+ * loop folds its partial into that block's slot; get() combines the slots
+ * in a fixed pairwise order. Copies destroyed outside such loops combine
+ * like omp_reduce, so only contributions from reproducible loops are
+ * independent of the thread count.
+ */
+template <typename T, typename Reduce>
+class ReduceOMPReproducible
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPReproducible<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPReproducible>;
+  using Partials = BlockPartials<T, Reduce>;
+  std::shared_ptr<Partials> partials;
+
+public:
+  ReduceOMPReproducible() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPReproducible(T init_val, T identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    partials = std::make_shared<Partials>(identity_);
+  }
+
+  ~ReduceOMPReproducible()
+  {
+    if (Base::parent && Base::my_data != Base::identity) {
+      const Index_type block = ReproducibleBlock::current();
+      if (block >= 0) {
+        partials->deposit(block, Base::my_data);
+      } else {
+#pragma omp critical(ompReduceCritical)
+        Reduce{}(Base::parent->local(), Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    T res = Base::my_data;
+    Reduce{}(res, partials->combine());
+    return res;
+  }
+};
+
+} /* detail */
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_reproducible,
+                          detail::ReduceOMPReproducible)
+
 }  // closing brace for RAJA namespace
 
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
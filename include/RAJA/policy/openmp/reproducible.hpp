@@ -0,0 +1,202 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the iteration-block bookkeeping shared by
+ *          the reproducible OpenMP loop and reduction policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_reproducible_openmp_HPP
+#define RAJA_reproducible_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/util/types.hpp"
+
+#include <atomic>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Iteration block of a reproducible loop that the calling thread is
+ * executing, or -1 outside such a loop. Set for the lifetime of the loop
+ * body copy made for the block, so that reducers destroyed with it know
+ * where their partial result belongs.
+ */
+class ReproducibleBlock
+{
+public:
+  explicit ReproducibleBlock(Index_type block) : m_enclosing(current())
+  {
+    current() = block;
+  }
+
+  ~ReproducibleBlock() { current() = m_enclosing; }
+
+  ReproducibleBlock(const ReproducibleBlock&) = delete;
+  ReproducibleBlock& operator=(const ReproducibleBlock&) = delete;
+
+  static Index_type& current()
+  {
+    static thread_local Index_type block = -1;
+    return block;
+  }
+
+private:
+  Index_type m_enclosing;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Partial results of a reproducible reduction, one per iteration
+ *         block.
+ *
+ *         Storage grows without locks as blocks arrive: page k holds
+ *         first_page << k blocks and is allocated by whichever thread needs
+ *         it first. A block is written by one thread per launch, and
+ *         launches are ordered by the barrier that ends them, so repeated
+ *         launches fold into each block's slot in launch order.
+ *
+ *         combine() reduces the slots with a pairwise tree whose shape only
+ *         depends on the highest block used, never on the thread count or
+ *         schedule.
+ *
+ ******************************************************************************
+ */
+template <typename T, typename Reduce>
+class BlockPartials
+{
+public:
+  static constexpr Index_type first_page = 256;
+  static constexpr int max_pages = 40;
+
+  explicit BlockPartials(T identity) : m_identity(identity), m_num_blocks(0)
+  {
+    for (int k = 0; k < max_pages; ++k) {
+      m_pages[k].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  BlockPartials(const BlockPartials&) = delete;
+  BlockPartials& operator=(const BlockPartials&) = delete;
+
+  ~BlockPartials()
+  {
+    for (int k = 0; k < max_pages; ++k) {
+      delete[] m_pages[k].load(std::memory_order_relaxed);
+    }
+  }
+
+  //! Fold value into the slot of block.
+  void deposit(Index_type block, const T& value)
+  {
+    Reduce{}(slot(block), value);
+
+    Index_type num = m_num_blocks.load(std::memory_order_relaxed);
+    while (num <= block && !m_num_blocks.compare_exchange_weak(
+                               num, block + 1, std::memory_order_relaxed)) {
+    }
+  }
+
+  //! Pairwise combination of the slots of all blocks used so far.
+  T combine() const
+  {
+    const Index_type num = m_num_blocks.load(std::memory_order_relaxed);
+    return num > 0 ? combine(0, num) : m_identity;
+  }
+
+private:
+  T combine(Index_type first, Index_type last) const
+  {
+    if (last - first == 1) {
+      return get(first);
+    }
+    const Index_type mid = first + (last - first) / 2;
+    T res = combine(first, mid);
+    Reduce{}(res, combine(mid, last));
+    return res;
+  }
+
+  static void locate(Index_type block, int& page, Index_type& offset)
+  {
+    page = 0;
+    Index_type page_size = first_page;
+    while (block >= page_size) {
+      block -= page_size;
+      page_size *= 2;
+      ++page;
+    }
+    offset = block;
+  }
+
+  T& slot(Index_type block)
+  {
+    int page;
+    Index_type offset;
+    locate(block, page, offset);
+
+    T* data = m_pages[page].load(std::memory_order_acquire);
+    if (data == nullptr) {
+      const Index_type page_size = first_page << page;
+      T* fresh = new T[page_size];
+      for (Index_type i = 0; i < page_size; ++i) {
+        fresh[i] = m_identity;
+      }
+      if (m_pages[page].compare_exchange_strong(data,
+                                                fresh,
+                                                std::memory_order_acq_rel)) {
+        data = fresh;
+      } else {
+        delete[] fresh;
+      }
+    }
+    return data[offset];
+  }
+
+  T get(Index_type block) const
+  {
+    int page;
+    Index_type offset;
+    locate(block, page, offset);
+
+    const T* data = m_pages[page].load(std::memory_order_acquire);
+    return data ? data[offset] : m_identity;
+  }
+
+  const T m_identity;
+  std::atomic<T*> m_pages[max_pages];
+  std::atomic<Index_type> m_num_blocks;
+};
+
+}  // closing brace for detail namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -34,10 +34,12 @@
 #include <omp.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <thread>
 #include <type_traits>
-#include <vector>
 
 namespace RAJA
 {
@@ -46,12 +48,130 @@ namespace impl
 namespace scan
 {
 
-RAJA_INLINE
-int firstIndex(int n, int p, int pid)
+namespace detail
 {
-  return (static_cast<size_t>(n) * pid) / p;
+
+/*!
+ * Per-tile descriptor for the decoupled look-back scan. A tile first
+ * publishes the aggregate of its own elements (status aggregate), then the
+ * aggregate of everything up to and including itself (status prefix).
+ * Padded so neighboring tiles do not share a cache line.
+ */
+template <typename Value>
+struct TileStatus {
+  enum : int { invalid = 0, aggregate = 1, prefix = 2 };
+
+  std::atomic<int> status;
+  Value aggregate_value;
+  Value prefix_value;
+  char pad[RAJA::DATA_ALIGN
+           - ((sizeof(std::atomic<int>) + 2 * sizeof(Value))
+              % RAJA::DATA_ALIGN)];
+
+  TileStatus() : status(invalid) {}
+};
+
+//! Elements per tile; chosen so one tile of input stays in cache between
+//! the aggregate and the scan sweeps.
+template <typename Value>
+constexpr std::ptrdiff_t tile_size()
+{
+  return (64 * 1024) / sizeof(Value) > 1024
+             ? static_cast<std::ptrdiff_t>((64 * 1024) / sizeof(Value))
+             : 1024;
+}
+
+/*!
+ * \brief Single-pass tiled scan with decoupled look-back.
+ *
+ * Threads claim tiles in order from a shared counter. For each tile a
+ * thread reduces the tile, publishes the aggregate, and walks back over the
+ * predecessor descriptors, folding aggregates until it finds a published
+ * prefix. It then publishes its own prefix and scans the tile, reading the
+ * input (still in cache) and writing the output once. Input and output
+ * may be the same range.
+ */
+template <bool Exclusive,
+          typename Value,
+          typename Iter,
+          typename OutIter,
+          typename BinFn>
+void tiled_scan(Iter begin, Iter end, OutIter out, BinFn f, Value init)
+{
+  const std::ptrdiff_t n = end - begin;
+  if (n <= 0) return;
+
+  const std::ptrdiff_t tile = tile_size<Value>();
+  const std::ptrdiff_t num_tiles = (n + tile - 1) / tile;
+  const int nthreads = static_cast<int>(
+      std::min<std::ptrdiff_t>(num_tiles, omp_get_max_threads()));
+
+  std::unique_ptr<TileStatus<Value>[]> tiles(new TileStatus<Value>[num_tiles]);
+  std::atomic<std::ptrdiff_t> next_tile(0);
+
+#pragma omp parallel num_threads(nthreads)
+  {
+    for (std::ptrdiff_t t = next_tile.fetch_add(1); t < num_tiles;
+         t = next_tile.fetch_add(1)) {
+      const std::ptrdiff_t i0 = t * tile;
+      const std::ptrdiff_t i1 = std::min(i0 + tile, n);
+
+      Value agg = *(begin + i0);
+      for (std::ptrdiff_t i = i0 + 1; i < i1; ++i) {
+        agg = f(agg, *(begin + i));
+      }
+
+      // prefix of everything before this tile
+      Value exclusive = BinFn::identity();
+      if (t == 0) {
+        tiles[t].prefix_value = agg;
+        tiles[t].status.store(TileStatus<Value>::prefix,
+                              std::memory_order_release);
+      } else {
+        tiles[t].aggregate_value = agg;
+        tiles[t].status.store(TileStatus<Value>::aggregate,
+                              std::memory_order_release);
+
+        for (std::ptrdiff_t k = t - 1; k >= 0; --k) {
+          int status;
+          int spins = 0;
+          while ((status = tiles[k].status.load(std::memory_order_acquire))
+                 == TileStatus<Value>::invalid) {
+            // predecessor is claimed but not reduced yet
+            if (++spins > 1024) std::this_thread::yield();
+          }
+          if (status == TileStatus<Value>::prefix) {
+            exclusive = f(tiles[k].prefix_value, exclusive);
+            break;
+          }
+          exclusive = f(tiles[k].aggregate_value, exclusive);
+        }
+
+        tiles[t].prefix_value = f(exclusive, agg);
+        tiles[t].status.store(TileStatus<Value>::prefix,
+                              std::memory_order_release);
+      }
+
+      if (Exclusive) {
+        Value run = (t == 0) ? init : f(init, exclusive);
+        for (std::ptrdiff_t i = i0; i < i1; ++i) {
+          Value x = *(begin + i);
+          *(out + i) = run;
+          run = f(run, x);
+        }
+      } else {
+        Value run = exclusive;
+        for (std::ptrdiff_t i = i0; i < i1; ++i) {
+          run = f(run, *(begin + i));
+          *(out + i) = run;
+        }
+      }
+    }
+  }
 }
 
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -64,25 +184,7 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive_inplace(
     BinFn f)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, Value());
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    inclusive_inplace(::RAJA::seq_exec{}, begin + i0, begin + i1, f);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        ::RAJA::seq_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  detail::tiled_scan<false>(begin, end, begin, f, Value(BinFn::identity()));
 }
 
 /*!
@@ -98,27 +200,7 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
     ValueT v)
 {
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const int n = end - begin;
-  const int p0 = std::min(n, omp_get_max_threads());
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const int i0 = firstIndex(n, p, pid);
-    const int i1 = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + i0 - 1));
-#pragma omp barrier
-    exclusive_inplace(seq_exec{}, begin + i0, begin + i1, f, init);
-    sums[pid] = *(begin + i1 - 1);
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(
-        seq_exec{}, sums.data(), sums.data() + p, f, BinFn::identity());
-    for (int i = i0; i < i1; ++i) {
-      *(begin + i) = f(*(begin + i), sums[pid]);
-    }
-  }
+  detail::tiled_scan<true>(begin, end, begin, f, Value(v));
 }
 
 /*!
@@ -127,14 +209,14 @@ concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive_inplace(
 */
 template <typename Policy, typename Iter, typename OutIter, typename BinFn>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> inclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  ::std::copy(begin, end, out);
-  inclusive_inplace(exec, out, out + (end - begin), f);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::tiled_scan<false>(begin, end, out, f, Value(BinFn::identity()));
 }
 
 /*!
@@ -147,15 +229,15 @@ template <typename Policy,
           typename BinFn,
           typename ValueT>
 concepts::enable_if<type_traits::is_openmp_policy<Policy>> exclusive(
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f,
     ValueT v)
 {
-  ::std::copy(begin, end, out);
-  exclusive_inplace(exec, out, out + (end - begin), f, v);
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  detail::tiled_scan<true>(begin, end, out, f, Value(v));
 }
 
 }  // namespace scan
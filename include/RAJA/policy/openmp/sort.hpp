@@ -0,0 +1,124 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#include "RAJA/config.hpp"
+
+#ifndef RAJA_sort_openmp_HPP
+#define RAJA_sort_openmp_HPP
+
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/scan.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include <omp.h>
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! Histogram offsets for the radix sort come from the OpenMP scan.
+struct omp_count_scan {
+  void operator()(Index_type* begin, Index_type* end) const
+  {
+    scan::exclusive_inplace(omp_parallel_for_exec{},
+                            begin,
+                            end,
+                            operators::plus<Index_type>{},
+                            Index_type(0));
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief explicit sort given range and comparison function
+
+   Integral keys in ascending order use a parallel LSD radix sort, anything
+   else a parallel merge sort.
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> unstable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::parallel_sort<omp_parallel_for_exec>(
+      begin, end, comp, false, omp_get_max_threads(), detail::omp_count_scan{});
+}
+
+/*!
+        \brief explicit stable sort given range and comparison function
+*/
+template <typename Policy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> stable(
+    const Policy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::parallel_sort<omp_parallel_for_exec>(
+      begin, end, comp, true, omp_get_max_threads(), detail::omp_count_scan{});
+}
+
+/*!
+        \brief explicit stable sort of keys and values given key range, value
+   range, and comparison function
+*/
+template <typename Policy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_openmp_policy<Policy>> stable_pairs(
+    const Policy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::parallel_sort_pairs<omp_parallel_for_exec>(keys_begin,
+                                                     keys_end,
+                                                     vals_begin,
+                                                     comp,
+                                                     omp_get_max_threads(),
+                                                     detail::omp_count_scan{});
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
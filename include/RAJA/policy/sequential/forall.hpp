@@ -37,6 +37,10 @@
 
 #include "RAJA/policy/sequential/policy.hpp"
 
+#include "RAJA/index/BitmapSegment.hpp"
+#include "RAJA/index/BlockListSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
@@ -70,6 +74,69 @@ RAJA_INLINE void forall_impl(const seq_exec &, Iterable &&iter, Func &&body)
   }
 }
 
+/*!
+ * Compressed list segments are decoded a block at a time into a buffer on
+ * the stack. The segment is taken by value, which only copies a shared
+ * pointer, so that this overload is preferred to the one above for
+ * segments of any value category.
+ */
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const seq_exec &,
+                             TypedCompressedListSegment<T> seg,
+                             Func &&body)
+{
+  T indices[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.num_blocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type n = seg.decodeBlock(b, indices);
+    RAJA_NO_SIMD
+    for (Index_type k = 0; k < n; ++k) {
+      body(indices[k]);
+    }
+  }
+}
+
+/*!
+ * Bitmap segments are traversed a 64 bit word at a time: full words as a
+ * contiguous loop and other words by scanning their set bits.
+ */
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const seq_exec &,
+                             TypedBitmapSegment<T> seg,
+                             Func &&body)
+{
+  const std::uint64_t* words = seg.words();
+  const Index_type num_words = seg.num_words();
+  for (Index_type w = 0; w < num_words; ++w) {
+    const T base = seg.wordBase(w);
+    if (words[w] == ~std::uint64_t(0)) {
+      RAJA_NO_SIMD
+      for (Index_type j = 0; j < RAJA::detail::bitmap_word_bits; ++j) {
+        body(static_cast<T>(base + j));
+      }
+    } else {
+      RAJA::detail::bitmapWordForEach(words[w], base, body);
+    }
+  }
+}
+
+//! Block list segments run an inner loop over each block in turn.
+template <typename T, Index_type BlockSize, typename Func>
+RAJA_INLINE void forall_impl(const seq_exec &,
+                             TypedBlockListSegment<T, BlockSize> seg,
+                             Func &&body)
+{
+  const T* starts = seg.blockStarts();
+  const Index_type num_blocks = seg.num_blocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const T start = starts[b];
+    RAJA_NO_SIMD
+    for (Index_type j = 0; j < BlockSize; ++j) {
+      body(static_cast<T>(start + j));
+    }
+  }
+}
+
 }  // closing brace for sequential namespace
 
 }  // closing brace for policy namespace
@@ -39,8 +39,14 @@
 
 #include "RAJA/config.hpp"
 
+#include "RAJA/util/simd_register.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/BitmapSegment.hpp"
+#include "RAJA/index/BlockListSegment.hpp"
+#include "RAJA/index/CompressedListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/policy/simd/policy.hpp"
@@ -67,6 +73,117 @@ RAJA_INLINE void forall_impl(const simd_exec &,
   }
 }
 
+//! Compressed list segments are decoded a block at a time, see the
+//! seq_exec version, and each block is a vectorized loop.
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const simd_exec &,
+                             TypedCompressedListSegment<T> seg,
+                             Func &&loop_body)
+{
+  T indices[TypedCompressedListSegment<T>::block_size];
+  const Index_type num_blocks = seg.num_blocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const Index_type n = seg.decodeBlock(b, indices);
+    RAJA_SIMD
+    for (Index_type k = 0; k < n; ++k) {
+      loop_body(indices[k]);
+    }
+  }
+}
+
+//! Bitmap segments are traversed a word at a time, see the seq_exec
+//! version, and full words are a vectorized loop.
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const simd_exec &,
+                             TypedBitmapSegment<T> seg,
+                             Func &&loop_body)
+{
+  const std::uint64_t* words = seg.words();
+  const Index_type num_words = seg.num_words();
+  for (Index_type w = 0; w < num_words; ++w) {
+    const T base = seg.wordBase(w);
+    if (words[w] == ~std::uint64_t(0)) {
+      RAJA_SIMD
+      for (Index_type j = 0; j < RAJA::detail::bitmap_word_bits; ++j) {
+        loop_body(static_cast<T>(base + j));
+      }
+    } else {
+      RAJA::detail::bitmapWordForEach(words[w], base, loop_body);
+    }
+  }
+}
+
+//! Block list segments run a vectorized inner loop over each block in turn.
+template <typename T, Index_type BlockSize, typename Func>
+RAJA_INLINE void forall_impl(const simd_exec &,
+                             TypedBlockListSegment<T, BlockSize> seg,
+                             Func &&loop_body)
+{
+  const T* starts = seg.blockStarts();
+  const Index_type num_blocks = seg.num_blocks();
+  for (Index_type b = 0; b < num_blocks; ++b) {
+    const T start = starts[b];
+    RAJA_SIMD
+    for (Index_type j = 0; j < BlockSize; ++j) {
+      loop_body(static_cast<T>(start + j));
+    }
+  }
+}
+
+namespace detail
+{
+
+/*!
+ * Vector loop over a range segment: the body is called with indices of
+ * Width consecutive values, then once with the masked remainder.
+ */
+template <size_t Width, typename Type, typename DifferenceType, typename Func>
+RAJA_INLINE void simd_vector_forall(
+    const TypedRangeSegment<Type, DifferenceType> &iter,
+    Func &&loop_body)
+{
+  using index_type = simd_vector_index<Type, Width>;
+
+  auto begin = std::begin(iter);
+  auto distance = std::distance(begin, std::end(iter));
+  const decltype(distance) width = Width;
+
+  decltype(distance) i = 0;
+  for (; i + width <= distance; i += width) {
+    loop_body(index_type(*(begin + i)));
+  }
+  if (i < distance) {
+    loop_body(index_type(*(begin + i), static_cast<size_t>(distance - i)));
+  }
+}
+
+/*!
+ * Other iterables are not known to be contiguous, so every iteration is
+ * passed as a vector index with one active lane.
+ */
+template <size_t Width, typename Iterable, typename Func>
+RAJA_INLINE void simd_vector_forall(const Iterable &iter, Func &&loop_body)
+{
+  using value_type = typename std::decay<decltype(*std::begin(iter))>::type;
+  using index_type = simd_vector_index<value_type, Width>;
+
+  auto begin = std::begin(iter);
+  auto distance = std::distance(begin, std::end(iter));
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(index_type(*(begin + i), 1));
+  }
+}
+
+}  // closing brace for detail namespace
+
+template <size_t Width, typename Iterable, typename Func>
+RAJA_INLINE void forall_impl(const simd_vector_exec<Width> &,
+                             Iterable &&iter,
+                             Func &&loop_body)
+{
+  detail::simd_vector_forall<Width>(iter, std::forward<Func>(loop_body));
+}
+
 }  // closing brace for simd namespace
 
 }  // closing brace for policy namespace
@@ -52,11 +52,26 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+/*!
+ * Passes the loop body a simd_vector_index covering Width consecutive
+ * iterations; the last call of a range whose length is not a multiple of
+ * Width has its remaining lanes masked off.
+ */
+template <size_t Width>
+struct simd_vector_exec
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  static_assert(Width > 0, "simd_vector_exec needs at least one lane");
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::simd_vector_exec;
 
 }  // end of namespace RAJA
 
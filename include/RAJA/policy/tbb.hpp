@@ -32,9 +32,11 @@
 
 #include "RAJA/policy/tbb/forall.hpp"
 #include "RAJA/policy/tbb/forallN.hpp"
+#include "RAJA/policy/tbb/histogram.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/tbb/reduce.hpp"
 #include "RAJA/policy/tbb/scan.hpp"
+#include "RAJA/policy/tbb/sort.hpp"
 
 #endif
 
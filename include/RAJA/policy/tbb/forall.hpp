@@ -37,6 +37,7 @@
 
 #include "RAJA/policy/tbb/policy.hpp"
 
+#include "RAJA/index/BitmapSegment.hpp"
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
@@ -136,6 +137,35 @@ RAJA_INLINE void forall_impl(const tbb_for_static<ChunkSize>&,
                       tbb_static_partitioner{});
 }
 
+/*!
+ * Bitmap segments are split into whole 64 bit words: TBB runs the word
+ * numbers with the same policy, the grain size converted to words, and
+ * each task scans the set bits of the words in its range. Taken by value
+ * so that these overloads are preferred to the ones above.
+ */
+template <typename T, typename Func>
+RAJA_INLINE void forall_impl(const tbb_for_dynamic& p,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  forall_impl(tbb_for_dynamic(RAJA::detail::bitmapWordGrain(p.grain_size)),
+              TypedRangeSegment<Index_type>(0, seg.num_words()),
+              RAJA::detail::BitmapWordBody<T, camp::decay<Func>>{seg,
+                                                                 loop_body});
+}
+
+template <typename T, typename Func, size_t ChunkSize>
+RAJA_INLINE void forall_impl(const tbb_for_static<ChunkSize>&,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  using word_policy = tbb_for_static<RAJA::detail::bitmapWordGrain(ChunkSize)>;
+  forall_impl(word_policy{},
+              TypedRangeSegment<Index_type>(0, seg.num_words()),
+              RAJA::detail::BitmapWordBody<T, camp::decay<Func>>{seg,
+                                                                 loop_body});
+}
+
 }  // closing brace for tbb namespace
 }  // closing brace for policy namespace
 
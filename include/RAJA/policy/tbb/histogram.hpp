@@ -0,0 +1,124 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA histogram declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_histogram_tbb_HPP
+#define RAJA_histogram_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/atomic_builtin.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+#include "RAJA/pattern/detail/histogram.hpp"
+
+#include <tbb/tbb.h>
+
+#include <vector>
+
+namespace RAJA
+{
+namespace impl
+{
+namespace histogram
+{
+
+/*!
+        \brief explicit scatter-add given iteration range, output bins, and
+   index and value functions
+
+   Each worker taking part in the loop adds into its own copy of the bins,
+   created on first use, and the copies are merged by a second parallel
+   loop over the bins. Atomics into the output are used instead when the
+   copies would not stay in cache or the merge would cost more than the
+   loop; see select_strategy.
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename T,
+          typename IndexFn,
+          typename ValueFn>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> scatter_add(
+    const ExecPolicy&,
+    Iter begin,
+    Index_type len,
+    T* out,
+    Index_type num_bins,
+    IndexFn index_of,
+    ValueFn value_of)
+{
+  using brange = ::tbb::blocked_range<Index_type>;
+  const int max_threads = ::tbb::this_task_arena::max_concurrency();
+
+  switch (select_strategy<T>(num_bins, len, max_threads)) {
+    case Strategy::direct:
+      for (Index_type i = 0; i < len; ++i) {
+        const auto idx = begin[i];
+        out[index_of(idx)] += value_of(idx);
+      }
+      break;
+
+    case Strategy::atomic:
+      ::tbb::parallel_for(brange(0, len), [=](const brange& r) {
+        for (Index_type i = r.begin(); i != r.end(); ++i) {
+          const auto idx = begin[i];
+          RAJA::atomic::atomicAdd(RAJA::atomic::builtin_atomic{},
+                                  &out[index_of(idx)],
+                                  static_cast<T>(value_of(idx)));
+        }
+      });
+      break;
+
+    case Strategy::privatized: {
+      ::tbb::enumerable_thread_specific<std::vector<T>> bins(
+          static_cast<std::size_t>(num_bins), T());
+      ::tbb::parallel_for(brange(0, len), [&](const brange& r) {
+        T* mine = bins.local().data();
+        for (Index_type i = r.begin(); i != r.end(); ++i) {
+          const auto idx = begin[i];
+          mine[index_of(idx)] += value_of(idx);
+        }
+      });
+      ::tbb::parallel_for(brange(0, num_bins), [&](const brange& r) {
+        for (const std::vector<T>& copy : bins) {
+          for (Index_type b = r.begin(); b != r.end(); ++b) {
+            out[b] += copy[b];
+          }
+        }
+      });
+      break;
+    }
+  }
+}
+
+}  // namespace histogram
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,143 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+
+#ifndef RAJA_sort_tbb_HPP
+#define RAJA_sort_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/defines.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+#include "RAJA/policy/tbb/scan.hpp"
+
+#include "RAJA/pattern/detail/sort.hpp"
+
+#include <tbb/tbb.h>
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+
+//! Histogram offsets for the radix sort come from the TBB scan.
+struct tbb_count_scan {
+  void operator()(Index_type* begin, Index_type* end) const
+  {
+    scan::exclusive_inplace(tbb_for_exec{},
+                            begin,
+                            end,
+                            operators::plus<Index_type>{},
+                            Index_type(0));
+  }
+};
+
+}  // namespace detail
+
+/*!
+        \brief explicit sort given range and comparison function
+
+   Integral keys in ascending order use a parallel LSD radix sort, anything
+   else tbb::parallel_sort.
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> unstable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  using Key = camp::decay<decltype(*begin)>;
+  if (detail::is_radix_sortable<Key, Compare>::value) {
+    detail::parallel_sort<tbb_for_exec>(begin,
+                                        end,
+                                        comp,
+                                        false,
+                                        tbb::this_task_arena::max_concurrency(),
+                                        detail::tbb_count_scan{});
+  } else {
+    tbb::parallel_sort(begin, end, comp);
+  }
+}
+
+/*!
+        \brief explicit stable sort given range and comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> stable(
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::parallel_sort<tbb_for_exec>(begin,
+                                      end,
+                                      comp,
+                                      true,
+                                      tbb::this_task_arena::max_concurrency(),
+                                      detail::tbb_count_scan{});
+}
+
+/*!
+        \brief explicit stable sort of keys and values given key range, value
+   range, and comparison function
+*/
+template <typename ExecPolicy,
+          typename KeyIter,
+          typename ValIter,
+          typename Compare>
+concepts::enable_if<type_traits::is_tbb_policy<ExecPolicy>> stable_pairs(
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  detail::parallel_sort_pairs<tbb_for_exec>(
+      keys_begin,
+      keys_end,
+      vals_begin,
+      comp,
+      tbb::this_task_arena::max_concurrency(),
+      detail::tbb_count_scan{});
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,43 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for std::thread pool
+ *          execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_HPP
+#define RAJA_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/AsyncQueue.hpp"
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/forall.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+#include "RAJA/policy/threads/reduce.hpp"
+#include "RAJA/policy/threads/synchronize.hpp"
+
+#endif
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,207 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the persistent queue that runs
+ *          asynchronous host launches, and their completion events.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AsyncQueue_HPP
+#define RAJA_AsyncQueue_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace RAJA
+{
+
+namespace threads
+{
+
+namespace detail
+{
+
+//! Completion state shared between a queued task and its events.
+class AsyncState
+{
+public:
+  AsyncState() : m_done(false) {}
+
+  //! Mark the task finished, storing the exception it threw, if any.
+  void complete(std::exception_ptr error);
+
+  bool ready();
+
+  //! Block until complete(); rethrows the task's exception once.
+  void wait();
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_done;
+  std::exception_ptr m_error;
+};
+
+//! Type-erased unit of work for the AsyncQueue.
+struct AsyncTask {
+  virtual ~AsyncTask() {}
+
+  virtual void execute() = 0;
+
+  std::shared_ptr<AsyncState> state;
+};
+
+}  // closing brace for detail namespace
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Handle to an asynchronous launch.
+ *
+ *         Returned by RAJA::forall for async_exec policies. wait() blocks
+ *         until the loop has finished and rethrows an exception thrown by
+ *         the loop body. Like std::future from std::async, an event that is
+ *         destroyed (or assigned to) while its launch is still running
+ *         waits for it first, so discarding the event makes the launch
+ *         synchronous.
+ *
+ *         A default constructed event refers to no launch and is ready.
+ *
+ ******************************************************************************
+ */
+class AsyncEvent
+{
+public:
+  AsyncEvent() = default;
+
+  explicit AsyncEvent(std::shared_ptr<detail::AsyncState> state)
+      : m_state(std::move(state))
+  {
+  }
+
+  AsyncEvent(AsyncEvent&&) = default;
+
+  AsyncEvent& operator=(AsyncEvent&& other)
+  {
+    if (this != &other) {
+      release();
+      m_state = std::move(other.m_state);
+    }
+    return *this;
+  }
+
+  AsyncEvent(const AsyncEvent&) = delete;
+  AsyncEvent& operator=(const AsyncEvent&) = delete;
+
+  ~AsyncEvent() { release(); }
+
+  //! True if the event refers to a launch that has not been waited on.
+  bool valid() const { return static_cast<bool>(m_state); }
+
+  //! True if the launch has finished; does not block.
+  bool ready() const { return !m_state || m_state->ready(); }
+
+  //! Block until the launch has finished.
+  void wait()
+  {
+    if (!m_state) return;
+    std::shared_ptr<detail::AsyncState> state = std::move(m_state);
+    state->wait();
+  }
+
+private:
+  void release()
+  {
+    if (!m_state) return;
+    try {
+      wait();
+    } catch (...) {
+      // nowhere to report it from a destructor
+    }
+  }
+
+  std::shared_ptr<detail::AsyncState> m_state;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent queue thread for asynchronous host launches.
+ *
+ *         Tasks run one at a time on a dedicated thread, in the order they
+ *         were enqueued, so async launches behave like a single in-order
+ *         stream: each sees the results of the ones before it, and the
+ *         calling thread is free until it waits. Parallelism comes from the
+ *         inner policy each task runs with.
+ *
+ *         Tasks enqueued from the queue thread itself run immediately.
+ *
+ ******************************************************************************
+ */
+class AsyncQueue
+{
+public:
+  static AsyncQueue& getInstance();
+
+  ~AsyncQueue();
+
+  AsyncQueue(const AsyncQueue&) = delete;
+  AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+  //! Take ownership of task and run it after those already queued.
+  AsyncEvent enqueue(std::unique_ptr<detail::AsyncTask> task);
+
+  //! Block until every task enqueued so far has finished.
+  void synchronize();
+
+  //! True if the caller is the queue thread.
+  static bool onQueueThread();
+
+private:
+  AsyncQueue();
+
+  void workerLoop();
+
+  std::thread m_worker;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_idle;
+  std::deque<std::unique_ptr<detail::AsyncTask>> m_tasks;
+  bool m_busy;
+  bool m_shutdown;
+};
+
+}  // closing brace for threads namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
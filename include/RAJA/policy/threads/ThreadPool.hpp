@@ -0,0 +1,173 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the persistent std::thread pool used by the
+ *          RAJA threads back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ThreadPool_HPP
+#define RAJA_ThreadPool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/util/types.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace threads
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Chase-Lev work-stealing deque of chunk ids.
+ *
+ *         The owning thread takes work from the bottom, other threads steal
+ *         from the top. The deque is filled by fill() while the pool is
+ *         quiescent (between launches), so it never has to grow while
+ *         thieves are active.
+ *
+ ******************************************************************************
+ */
+class WorkStealingDeque
+{
+public:
+  enum class StealResult { success, empty, abort };
+
+  WorkStealingDeque() : m_top(0), m_bottom(0), m_capacity(0) {}
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  //! Replace contents with chunk ids [first, last); owner takes first first.
+  void fill(Index_type first, Index_type last);
+
+  //! Owner-side take from the bottom of the deque.
+  bool pop(Index_type& chunk);
+
+  //! Thief-side take from the top of the deque.
+  StealResult steal(Index_type& chunk);
+
+private:
+  std::atomic<Index_type> m_top;
+  char m_pad0[RAJA::DATA_ALIGN - sizeof(std::atomic<Index_type>)];
+  std::atomic<Index_type> m_bottom;
+  char m_pad1[RAJA::DATA_ALIGN - sizeof(std::atomic<Index_type>)];
+  std::unique_ptr<std::atomic<Index_type>[]> m_buffer;
+  Index_type m_capacity;
+  char m_pad2[RAJA::DATA_ALIGN - sizeof(Index_type)
+              - sizeof(std::unique_ptr<std::atomic<Index_type>[]>)];
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent pool of std::threads.
+ *
+ *         The calling thread participates in every launch as thread 0, the
+ *         remaining getNumThreads()-1 threads are created once and sleep
+ *         between launches. The pool size is taken from the RAJA_NUM_THREADS
+ *         environment variable, or std::thread::hardware_concurrency().
+ *
+ *         Launches are not re-entrant: code already running inside a launch
+ *         (see inParallelRegion()) must execute nested loops itself.
+ *
+ ******************************************************************************
+ */
+class ThreadPool
+{
+public:
+  using task_fn = void (*)(void* data, int thread_id);
+
+  static ThreadPool& getInstance();
+
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  int getNumThreads() const { return m_num_threads; }
+
+  //! Pool thread id of the caller during a launch, 0 otherwise.
+  static int getThreadId();
+
+  //! True if the caller is executing inside a pool launch.
+  static bool inParallelRegion();
+
+  /*!
+   * \brief Run fn(data, tid) once on every pool thread and wait for all of
+   *        them. If num_chunks > 0, chunk ids [0, num_chunks) are dealt to
+   *        the per-thread deques first; fn retrieves them with nextChunk().
+   *
+   *        The workers are waited for even if fn throws. An exception thrown
+   *        on the calling thread is propagated, otherwise the first one
+   *        thrown on a worker is rethrown here.
+   */
+  void launch(task_fn fn, void* data, Index_type num_chunks = 0);
+
+  //! Get the next chunk for thread tid, stealing if its own deque is empty.
+  bool nextChunk(int tid, Index_type& chunk);
+
+private:
+  ThreadPool();
+
+  void workerLoop(int tid);
+
+  //! Block until every worker has finished the current launch.
+  void waitForWorkers();
+
+  int m_num_threads;
+  std::vector<std::thread> m_workers;
+  std::unique_ptr<WorkStealingDeque[]> m_deques;
+
+  std::mutex m_launch_mutex;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  std::atomic<unsigned long> m_generation;
+  std::atomic<int> m_pending;
+  bool m_shutdown;
+
+  task_fn m_task;
+  void* m_data;
+  std::exception_ptr m_exception;
+};
+
+}  // closing brace for threads namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,326 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the std::thread pool back-end.
+ *
+ *          These methods should work on any platform that supports
+ *          std::thread.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_threads_HPP
+#define RAJA_forall_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/threads/AsyncQueue.hpp"
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+#include "RAJA/index/BitmapSegment.hpp"
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace RAJA
+{
+
+namespace policy
+{
+namespace threads
+{
+
+namespace detail
+{
+
+//! Number of chunks per pool thread when the policy grain size is 0.
+constexpr Index_type auto_chunks_per_thread = 8;
+
+/*!
+ * Launch data for a work-stealing loop; execute() runs on every pool
+ * thread, privatizes the body once and drains chunks until none are left.
+ */
+template <typename Iter, typename IndexT, typename Func>
+struct DynamicLoop {
+  Iter begin_it;
+  IndexT len;
+  IndexT grain;
+  const Func& body;
+
+  static void execute(void* data, int tid)
+  {
+    const DynamicLoop& loop = *static_cast<const DynamicLoop*>(data);
+    auto& pool = ::RAJA::threads::ThreadPool::getInstance();
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop.body);
+    auto& body = privatizer.get_priv();
+
+    Index_type chunk;
+    while (pool.nextChunk(tid, chunk)) {
+      const IndexT first = static_cast<IndexT>(chunk) * loop.grain;
+      const IndexT last = std::min(first + loop.grain, loop.len);
+      for (IndexT i = first; i < last; ++i) {
+        body(loop.begin_it[i]);
+      }
+    }
+  }
+};
+
+/*!
+ * Launch data for a statically scheduled loop; thread t always executes
+ * the same iterations for a given length and pool size.
+ */
+template <typename Iter, typename IndexT, typename Func>
+struct StaticLoop {
+  Iter begin_it;
+  IndexT len;
+  IndexT chunk_size;
+  int num_threads;
+  const Func& body;
+
+  static void execute(void* data, int tid)
+  {
+    const StaticLoop& loop = *static_cast<const StaticLoop*>(data);
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(loop.body);
+    auto& body = privatizer.get_priv();
+
+    if (loop.chunk_size == 0) {
+      const IndexT chunk = loop.len / loop.num_threads;
+      const IndexT rem = loop.len % loop.num_threads;
+      const IndexT first = tid * chunk + (tid < rem ? tid : rem);
+      const IndexT last = first + chunk + (tid < rem ? 1 : 0);
+      for (IndexT i = first; i < last; ++i) {
+        body(loop.begin_it[i]);
+      }
+    } else {
+      const IndexT stride = loop.chunk_size * loop.num_threads;
+      for (IndexT first = loop.chunk_size * tid; first < loop.len;
+           first += stride) {
+        const IndexT last = std::min(first + loop.chunk_size, loop.len);
+        for (IndexT i = first; i < last; ++i) {
+          body(loop.begin_it[i]);
+        }
+      }
+    }
+  }
+};
+
+/*!
+ * Queued asynchronous loop; owns copies of the iterable and the body so
+ * that the launching scope may exit before the loop runs.
+ */
+template <typename InnerPolicy, typename Iterable, typename Func>
+struct AsyncLoop : ::RAJA::threads::detail::AsyncTask {
+  template <typename I, typename F>
+  AsyncLoop(I&& iter, F&& body)
+      : iter(std::forward<I>(iter)), body(std::forward<F>(body))
+  {
+  }
+
+  void execute() override { ::RAJA::wrap::forall(InnerPolicy{}, iter, body); }
+
+  Iterable iter;
+  Func body;
+};
+
+}  // closing brace for detail namespace
+
+/**
+ * @brief std::thread pool work-stealing for implementation
+ *
+ * @param thread_pool_dynamic thread pool tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall splits the iterable into chunks of GrainSize iterations
+ * (or an automatic grain when GrainSize is 0) and deals them out to the
+ * per-thread deques of the persistent pool. Threads that run out of work
+ * steal chunks from the others, so this should be used for loops with
+ * irregular cost per iteration.
+ *
+ * Loops launched from inside a pool launch run sequentially on the
+ * calling thread.
+ */
+template <typename Iterable, typename Func, std::size_t GrainSize>
+RAJA_INLINE void forall_impl(const thread_pool_dynamic<GrainSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using IndexT = decltype(distance_it);
+  using Pool = ::RAJA::threads::ThreadPool;
+
+  Pool& pool = Pool::getInstance();
+  const IndexT nthreads = pool.getNumThreads();
+
+  IndexT grain = static_cast<IndexT>(GrainSize);
+  if (grain == 0) {
+    const IndexT nchunks = nthreads * detail::auto_chunks_per_thread;
+    grain = std::max(IndexT(1), (distance_it + nchunks - 1) / nchunks);
+  }
+
+  if (nthreads == 1 || distance_it <= grain || Pool::inParallelRegion()) {
+    for (IndexT i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+    return;
+  }
+
+  using loop_type =
+      detail::DynamicLoop<decltype(begin_it), IndexT, camp::decay<Func>>;
+  loop_type loop{begin_it, distance_it, grain, loop_body};
+  pool.launch(&loop_type::execute,
+              static_cast<void*>(&loop),
+              (distance_it + grain - 1) / grain);
+}
+
+/**
+ * @brief std::thread pool static for implementation
+ *
+ * @param thread_pool_static thread pool tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall gives each pool thread either one contiguous block of the
+ * iterable (ChunkSize 0) or every num_threads-th chunk of ChunkSize
+ * iterations. The mapping of iterations to threads is the same for every
+ * launch of the same length, so this should be used for well-balanced
+ * loops, or loops where the split between threads must be maintained
+ * across multiple loops.
+ */
+template <typename Iterable, typename Func, std::size_t ChunkSize>
+RAJA_INLINE void forall_impl(const thread_pool_static<ChunkSize>&,
+                             Iterable&& iter,
+                             Func&& loop_body)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  using IndexT = decltype(distance_it);
+  using Pool = ::RAJA::threads::ThreadPool;
+
+  Pool& pool = Pool::getInstance();
+  const int nthreads = pool.getNumThreads();
+
+  if (nthreads == 1 || distance_it <= 1 || Pool::inParallelRegion()) {
+    for (IndexT i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+    return;
+  }
+
+  using loop_type =
+      detail::StaticLoop<decltype(begin_it), IndexT, camp::decay<Func>>;
+  loop_type loop{begin_it,
+                 distance_it,
+                 static_cast<IndexT>(ChunkSize),
+                 nthreads,
+                 loop_body};
+  pool.launch(&loop_type::execute, static_cast<void*>(&loop));
+}
+
+/*!
+ * Bitmap segments are split into whole 64 bit words: the pool runs the
+ * word numbers with the same policy, the grain or chunk size converted to
+ * words, and each thread scans the set bits of the words it gets. Taken by
+ * value so that these overloads are preferred to the ones above.
+ */
+template <typename T, typename Func, std::size_t GrainSize>
+RAJA_INLINE void forall_impl(const thread_pool_dynamic<GrainSize>&,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  using word_policy =
+      thread_pool_dynamic<RAJA::detail::bitmapWordGrain(GrainSize)>;
+  forall_impl(word_policy{},
+              TypedRangeSegment<Index_type>(0, seg.num_words()),
+              RAJA::detail::BitmapWordBody<T, camp::decay<Func>>{seg,
+                                                                 loop_body});
+}
+
+template <typename T, typename Func, std::size_t ChunkSize>
+RAJA_INLINE void forall_impl(const thread_pool_static<ChunkSize>&,
+                             TypedBitmapSegment<T> seg,
+                             Func&& loop_body)
+{
+  using word_policy =
+      thread_pool_static<RAJA::detail::bitmapWordGrain(ChunkSize)>;
+  forall_impl(word_policy{},
+              TypedRangeSegment<Index_type>(0, seg.num_words()),
+              RAJA::detail::BitmapWordBody<T, camp::decay<Func>>{seg,
+                                                                 loop_body});
+}
+
+/**
+ * @brief asynchronous for implementation
+ *
+ * @param async_exec async tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return AsyncEvent that completes when the loop has run
+ *
+ * This forall copies the iterable and the loop body and queues the loop on
+ * the AsyncQueue, where it runs with InnerPolicy after the async launches
+ * already queued. Data the body refers to through pointers or references
+ * must stay valid until the event has been waited on.
+ */
+template <typename Iterable, typename Func, typename InnerPolicy>
+RAJA_INLINE ::RAJA::threads::AsyncEvent forall_impl(
+    const async_exec<InnerPolicy>&,
+    Iterable&& iter,
+    Func&& loop_body)
+{
+  using task_type = detail::
+      AsyncLoop<InnerPolicy, camp::decay<Iterable>, camp::decay<Func>>;
+  std::unique_ptr<::RAJA::threads::detail::AsyncTask> task(
+      new task_type(std::forward<Iterable>(iter),
+                    std::forward<Func>(loop_body)));
+  return ::RAJA::threads::AsyncQueue::getInstance().enqueue(std::move(task));
+}
+
+}  // closing brace for threads namespace
+}  // closing brace for policy namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,142 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA std::thread pool policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_threads_HPP
+#define policy_threads_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+namespace policy
+{
+namespace threads
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+
+/*!
+ * Work-stealing execution: the iteration space is cut into chunks of
+ * GrainSize iterations that are dealt out to per-thread deques; idle
+ * threads steal from the others. A GrainSize of 0 picks a grain that gives
+ * every pool thread several chunks.
+ */
+template <std::size_t GrainSize = 0>
+struct thread_pool_dynamic
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+/*!
+ * Static execution: thread t always gets the same iterations. A ChunkSize
+ * of 0 gives each thread one contiguous block, otherwise chunks of
+ * ChunkSize iterations are dealt round-robin (like schedule(static, N)).
+ */
+template <std::size_t ChunkSize = 0>
+struct thread_pool_static
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+using thread_pool_exec = thread_pool_dynamic<>;
+
+/*!
+ * Asynchronous execution: RAJA::forall copies the iterable and the loop
+ * body, queues the loop to run with InnerPolicy on the persistent async
+ * queue thread, and returns a RAJA::threads::AsyncEvent without waiting.
+ * InnerPolicy may be any host segment policy.
+ */
+template <typename InnerPolicy = thread_pool_static<>>
+struct async_exec
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::forall,
+                                            Launch::async,
+                                            Platform::host,
+                                            wrapper<InnerPolicy>> {
+};
+
+///
+/// Index set segment iteration policies
+///
+using thread_pool_segit = thread_pool_exec;
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct thread_pool_reduce
+    : make_policy_pattern_launch_platform_t<Policy::threads,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Synchronization policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+
+//! Wait for asynchronous launches, see RAJA::threads::AsyncQueue.
+struct async_synchronize : make_policy_pattern_launch_t<Policy::threads,
+                                                        Pattern::synchronize,
+                                                        Launch::sync> {
+};
+
+}  // closing brace for threads
+}  // closing brace for policy
+
+using policy::threads::thread_pool_exec;
+using policy::threads::thread_pool_static;
+using policy::threads::thread_pool_dynamic;
+using policy::threads::thread_pool_segit;
+using policy::threads::thread_pool_reduce;
+using policy::threads::async_exec;
+using policy::threads::async_synchronize;
+
+}  // closing brace for RAJA namespace
+
+#endif
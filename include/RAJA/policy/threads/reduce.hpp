@@ -0,0 +1,123 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for the
+ *          std::thread pool back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_threads_reduce_HPP
+#define RAJA_threads_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+#include "RAJA/policy/threads/ThreadPool.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Combiner for thread pool reductions. Each copy of the reducer made by a
+ * pool thread during a launch folds its value into that thread's slot when
+ * destroyed; slots are cache-line padded and only combined in get(). Copies
+ * destroyed by any other thread (outside a launch, or a thread that is not
+ * in the pool) combine into the parent under a mutex instead, since their
+ * thread id would alias slot 0.
+ */
+template <typename T, typename Reduce>
+class ReduceThreads
+    : public reduce::detail::BaseCombinable<T, Reduce, ReduceThreads<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreads>;
+
+  using Slot = reduce::detail::PaddedValue<T>;
+
+  std::shared_ptr<std::vector<Slot>> data;
+
+  static std::mutex& combineMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+public:
+  ReduceThreads() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceThreads(T init_val, T identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    data = std::make_shared<std::vector<Slot>>(
+        threads::ThreadPool::getInstance().getNumThreads(), Slot(identity_));
+  }
+
+  ~ReduceThreads()
+  {
+    if (Base::parent) {
+      const size_t tid = threads::ThreadPool::getThreadId();
+      if (threads::ThreadPool::inParallelRegion() && tid < data->size()) {
+        Reduce{}((*data)[tid].value, Base::my_data);
+      } else {
+        std::lock_guard<std::mutex> lock(combineMutex());
+        Reduce{}(Base::parent->local(), Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    T res = Base::my_data;
+    for (size_t i = 0; i < data->size(); ++i) {
+      Reduce{}(res, (*data)[i].value);
+    }
+    return res;
+  }
+};
+
+} /* detail */
+
+RAJA_DECLARE_ALL_REDUCERS(thread_pool_reduce, detail::ReduceThreads)
+
+}  // closing brace for RAJA namespace
+
+#endif  // closing endif for RAJA_ENABLE_THREADS guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_synchronize_threads_HPP
+#define RAJA_synchronize_threads_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/AsyncQueue.hpp"
+#include "RAJA/policy/threads/policy.hpp"
+
+namespace RAJA
+{
+
+namespace policy
+{
+
+namespace threads
+{
+
+/*!
+ * \brief Wait for every asynchronous launch made so far.
+ */
+RAJA_INLINE
+void synchronize_impl(const async_synchronize&)
+{
+  ::RAJA::threads::AsyncQueue::getInstance().synchronize();
+}
+
+/*!
+ * \brief Wait for the launches of the given events.
+ */
+template <typename... Events>
+RAJA_INLINE void synchronize_impl(const async_synchronize&,
+                                  ::RAJA::threads::AsyncEvent& event,
+                                  Events&... events)
+{
+  event.wait();
+  synchronize_impl(async_synchronize{}, events...);
+}
+
+}  // end of namespace threads
+}  // end of namespace policy
+}  // end of namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREADS)
+
+#endif  // RAJA_synchronize_threads_HPP
@@ -33,6 +33,7 @@
 #include "RAJA/internal/LegacyCompatibility.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
+#include "RAJA/util/simd_register.hpp"
 
 namespace RAJA
 {
@@ -182,8 +183,10 @@ public:
    * @return Linear space index.
    */
   template <typename... Indices>
-  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin operator()(
-      Indices... indices) const
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr typename std::enable_if<
+      simd_index_pack<0, StrideOneDim, Indices...>::num_vectors == 0,
+      IdxLin>::type
+  operator()(Indices... indices) const
   {
     // dot product of strides and indices
     return VarOps::sum<IdxLin>(
@@ -191,6 +194,32 @@ public:
             indices, strides))...);
   }
 
+  /*!
+   * Computes the linear space vector index for indices where one or more
+   * are simd_vector_index.
+   *
+   * The result addresses the first lane by the linear index of the first
+   * lanes of the indices, and has a compile time unit lane stride if the
+   * only vector index is contiguous and in dimension stride1_dim.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space vector index.
+   */
+  template <typename... Indices,
+            typename Pack = simd_index_pack<0, StrideOneDim, Indices...>>
+  RAJA_INLINE typename std::enable_if<
+      (Pack::num_vectors > 0),
+      simd_vector_index<IdxLin, Pack::width, Pack::contiguous>>::type
+  operator()(Indices... indices) const
+  {
+    return simd_vector_index<IdxLin, Pack::width, Pack::contiguous>(
+        operator()(simd_first_lane(indices)...),
+        VarOps::foldl(RAJA::operators::maximum<size_t>(),
+                      simd_num_lanes(indices)...),
+        VarOps::sum<Index_type>(
+            simd_lane_stride(indices, strides[RangeInts])...));
+  }
+
 
   /*!
    * Given a linear-space index, compute the n-dimensional indices defined
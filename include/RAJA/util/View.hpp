@@ -26,10 +26,16 @@
 #ifndef RAJA_VIEW_HPP
 #define RAJA_VIEW_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 #include "RAJA/config.hpp"
+#include "RAJA/index/RangeSegment.hpp"
 #include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/forall.hpp"
 #include "RAJA/util/Layout.hpp"
 
 #if defined(RAJA_ENABLE_CHAI)
@@ -89,12 +95,36 @@ struct View {
   // making this specifically typed would require unpacking the layout,
   // this is easier to maintain
   template <typename... Args>
-  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Args... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE typename std::enable_if<
+      detail::simd_index_pack<0, -1, Args...>::num_vectors == 0,
+      value_type &>::type
+  operator()(Args... args) const
   {
     auto idx = convertIndex<Index_type>(layout(args...));
     auto &value = data[idx];
     return value;
   }
+
+  /*!
+   * Vector access: if any of args is a simd_vector_index, returns a
+   * simd_view_ref that loads and stores all active lanes at once.
+   */
+  template <typename... Args,
+            typename LinearIndex = decltype(
+                std::declval<layout_type const &>()(std::declval<Args>()...)),
+            typename Ref = simd_view_ref<value_type,
+                                         LinearIndex::width,
+                                         LinearIndex::contiguous>>
+  RAJA_INLINE typename std::enable_if<
+      (detail::simd_index_pack<0, -1, Args...>::num_vectors > 0),
+      Ref>::type
+  operator()(Args... args) const
+  {
+    LinearIndex idx = layout(args...);
+    return Ref(&data[convertIndex<Index_type>(idx.value)],
+               idx.stride(),
+               idx.size);
+  }
 };
 
 template <typename ValueType,
@@ -196,6 +226,215 @@ struct AtomicViewWrapper<ViewType, RAJA::atomic::seq_atomic> {
 };
 
 
+namespace atomic
+{
+
+/*!
+ * Atomic view policy that spreads the updates of an AtomicViewWrapper over
+ * NumReplicas zero-initialized copies of the viewed array. Each copy of the
+ * wrapper, e.g. the one captured by each thread's loop body, updates one
+ * replica with AtomicPolicy, so only threads sharing a replica contend.
+ * flush() adds the replicas into the viewed array.
+ */
+template <std::size_t NumReplicas = 8, typename AtomicPolicy = auto_atomic>
+struct replicated_atomic {
+};
+
+}  // namespace atomic
+
+namespace detail
+{
+
+/*!
+ * Number of the calling thread, counting threads in the order they first
+ * call this. Used to spread threads of any back-end over replicas.
+ */
+inline int replica_thread_id()
+{
+  static std::atomic<int> next_id(0);
+  static thread_local int id = next_id.fetch_add(1);
+  return id;
+}
+
+//! Untyped View underlying a View or TypedView.
+template <typename ValueType, typename LayoutType, typename PointerType>
+RAJA_INLINE View<ValueType, LayoutType, PointerType> const &untyped_view(
+    View<ValueType, LayoutType, PointerType> const &view)
+{
+  return view;
+}
+
+template <typename ValueType,
+          typename PointerType,
+          typename LayoutType,
+          typename... IndexTypes>
+RAJA_INLINE View<ValueType, LayoutType, PointerType> const &untyped_view(
+    TypedViewBase<ValueType, PointerType, LayoutType, IndexTypes...> const
+        &view)
+{
+  return view.base_;
+}
+
+/*!
+ * Element reference of a replicated atomic view. Only additive updates are
+ * allowed, since the element's value is split over the replicas until
+ * flush().
+ */
+template <typename T, typename AtomicPolicy>
+class ReplicatedAtomicRef
+{
+public:
+  RAJA_INLINE explicit ReplicatedAtomicRef(T *value_ptr)
+      : m_value_ptr(value_ptr)
+  {
+  }
+
+  RAJA_INLINE void operator+=(T rhs) const
+  {
+    RAJA::atomic::atomicAdd<AtomicPolicy>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE void operator-=(T rhs) const
+  {
+    RAJA::atomic::atomicSub<AtomicPolicy>(m_value_ptr, rhs);
+  }
+
+  RAJA_INLINE void operator++() const { *this += T(1); }
+
+  RAJA_INLINE void operator++(int) const { *this += T(1); }
+
+  RAJA_INLINE void operator--() const { *this -= T(1); }
+
+  RAJA_INLINE void operator--(int) const { *this -= T(1); }
+
+private:
+  T *m_value_ptr;
+};
+
+}  // namespace detail
+
+
+/*
+ * Specialized AtomicViewWrapper for replicated_atomic. operator() returns
+ * a reference into the replica picked for the thread that made this copy,
+ * so existing kernels using += and -= only need a policy change, plus a
+ * call to flush() after the loops:
+ *
+ *   using pol = RAJA::atomic::replicated_atomic<8, RAJA::atomic::omp_atomic>;
+ *   auto node_view = RAJA::make_atomic_view<pol>(nodes);
+ *   RAJA::forall<RAJA::omp_parallel_for_exec>(elems, [=](int e) {
+ *     node_view(conn[2 * e]) += f[e];
+ *     node_view(conn[2 * e + 1]) -= f[e];
+ *   });
+ *   node_view.flush<RAJA::omp_parallel_for_exec>();
+ *
+ * Copies share the replicas; the viewed data must be addressed by a plain
+ * pointer and its layout must map onto [0, layout.size()). Host only.
+ */
+template <typename ViewType, std::size_t NumReplicas, typename AtomicPolicy>
+struct AtomicViewWrapper<
+    ViewType,
+    RAJA::atomic::replicated_atomic<NumReplicas, AtomicPolicy>> {
+  using base_type = ViewType;
+  using pointer_type = typename base_type::pointer_type;
+  using value_type = typename base_type::value_type;
+  using atomic_type = detail::ReplicatedAtomicRef<value_type, AtomicPolicy>;
+
+  static_assert(NumReplicas > 0, "replicated_atomic needs a replica");
+  static_assert(std::is_pointer<pointer_type>::value,
+                "replicated_atomic views need plain pointer data");
+
+  base_type base_;
+
+  RAJA_INLINE
+  explicit AtomicViewWrapper(ViewType const &view)
+      : base_{view},
+        m_replicas(std::make_shared<Replicas>(
+            detail::untyped_view(view).layout.size())),
+        m_replica{view}
+  {
+    pickReplica();
+  }
+
+  //! Copies made on another thread update that thread's replica.
+  RAJA_INLINE AtomicViewWrapper(AtomicViewWrapper const &other)
+      : base_{other.base_},
+        m_replicas(other.m_replicas),
+        m_replica{other.m_replica}
+  {
+    pickReplica();
+  }
+
+  RAJA_INLINE void set_data(pointer_type data_ptr) { base_.set_data(data_ptr); }
+
+  template <typename... ARGS>
+  RAJA_INLINE atomic_type operator()(ARGS &&... args) const
+  {
+    return atomic_type(&m_replica.operator()(std::forward<ARGS>(args)...));
+  }
+
+  /*!
+   * Add the replicas into the viewed data and clear them, running over the
+   * elements with ExecPolicy. Call once the loops updating the view are
+   * done; the view may then be used for further updates.
+   */
+  template <typename ExecPolicy = RAJA::seq_exec>
+  void flush() const
+  {
+    using nc_value_type = typename std::remove_const<value_type>::type;
+    nc_value_type *out = detail::untyped_view(base_).data;
+    nc_value_type *replicas = m_replicas->data.get();
+    const Index_type pitch = m_replicas->pitch;
+
+    RAJA::forall<ExecPolicy>(
+        RAJA::TypedRangeSegment<Index_type>(0, m_replicas->len),
+        [=](Index_type i) {
+          nc_value_type sum = out[i];
+          for (std::size_t r = 0; r < NumReplicas; ++r) {
+            sum += replicas[r * pitch + i];
+            replicas[r * pitch + i] = nc_value_type();
+          }
+          out[i] = sum;
+        });
+  }
+
+private:
+  struct Replicas {
+    using nc_value_type = typename std::remove_const<value_type>::type;
+
+    explicit Replicas(Index_type len_)
+        : len(len_),
+          pitch(paddedLength(len_)),
+          data(new nc_value_type[pitch * NumReplicas]())
+    {
+    }
+
+    //! Replicas start on separate cache lines.
+    static Index_type paddedLength(Index_type len_)
+    {
+      const Index_type per_line = RAJA::DATA_ALIGN / sizeof(nc_value_type) > 0
+                                      ? RAJA::DATA_ALIGN / sizeof(nc_value_type)
+                                      : 1;
+      return (len_ + per_line - 1) / per_line * per_line;
+    }
+
+    Index_type len;
+    Index_type pitch;
+    std::unique_ptr<nc_value_type[]> data;
+  };
+
+  void pickReplica()
+  {
+    const std::size_t r =
+        static_cast<std::size_t>(detail::replica_thread_id()) % NumReplicas;
+    m_replica.set_data(m_replicas->data.get() + r * m_replicas->pitch);
+  }
+
+  std::shared_ptr<Replicas> m_replicas;
+  base_type m_replica;
+};
+
+
 template <typename AtomicPolicy, typename ViewType>
 RAJA_INLINE AtomicViewWrapper<ViewType, AtomicPolicy> make_atomic_view(
     ViewType const &view)
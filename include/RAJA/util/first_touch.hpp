@@ -0,0 +1,132 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing NUMA-aware allocation routines that
+ *          first-touch memory with the partition of an execution policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_first_touch_HPP
+#define RAJA_first_touch_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/util/types.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Size of a memory page in bytes.
+size_t getPageSize();
+
+//! NUMA node of the CPU running the calling thread, -1 if unknown.
+int getCurrentNumaNode();
+
+/*!
+ * Move the pages of [ptr, ptr + bytes) to nodes[page]; entries of -1 are
+ * left where they are. Does nothing unless RAJA is built with libnuma.
+ */
+void movePagesToNodes(void* ptr, size_t bytes, const std::vector<int>& nodes);
+
+}  // end namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Allocate count value initialized elements of T, first-touched by
+ *         running RAJA::forall<ExecPolicy> over [0, count).
+ *
+ *         Each page is touched by the thread that the policy assigns its
+ *         elements to, so later loops with the same policy and length
+ *         access memory local to their NUMA node. Use a policy with a fixed
+ *         iteration to thread mapping, e.g. omp_parallel_for_static_block or
+ *         thread_pool_static, and bind threads (OMP_PROC_BIND).
+ *
+ *         When RAJA is built with libnuma the touching threads also record
+ *         their node, and pages that were already resident elsewhere (for
+ *         example memory reused by the allocator) are migrated there.
+ *
+ *         Memory must be released with free_first_touch.
+ *
+ *         double* x = RAJA::allocate_first_touch<
+ *             RAJA::omp_parallel_for_static_block, double>(N);
+ *
+ ******************************************************************************
+ */
+template <typename ExecPolicy, typename T>
+T* allocate_first_touch(size_t count)
+{
+  static_assert(std::is_trivially_destructible<T>::value,
+                "allocate_first_touch requires a trivially destructible type");
+
+  const size_t page_size = detail::getPageSize();
+  const size_t bytes = count * sizeof(T);
+
+  T* ptr = static_cast<T*>(allocate_aligned(page_size, bytes ? bytes : 1));
+  if (ptr == nullptr || count == 0) return ptr;
+
+#if defined(RAJA_ENABLE_NUMA)
+  std::vector<int> nodes((bytes + page_size - 1) / page_size, -1);
+  int* page_nodes = nodes.data();
+#endif
+
+  RAJA::forall<ExecPolicy>(RAJA::TypedRangeSegment<size_t>(0, count),
+                           [=](size_t i) {
+                             new (&ptr[i]) T();
+#if defined(RAJA_ENABLE_NUMA)
+                             // record the node of the first element starting
+                             // in each page
+                             const size_t offset = i * sizeof(T);
+                             if (offset % page_size < sizeof(T)) {
+                               page_nodes[offset / page_size] =
+                                   detail::getCurrentNumaNode();
+                             }
+#endif
+                           });
+
+#if defined(RAJA_ENABLE_NUMA)
+  detail::movePagesToNodes(ptr, bytes, nodes);
+#endif
+
+  return ptr;
+}
+
+//! Free memory returned by allocate_first_touch.
+template <typename T>
+void free_first_touch(T* ptr)
+{
+  free_aligned(ptr);
+}
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,283 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the instrumentation interface: launch
+ *          events fired by RAJA patterns, loop labels and a profiler.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_instrument_HPP
+#define RAJA_instrument_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#if defined(RAJA_ENABLE_INSTRUMENTATION)
+#include <typeinfo>
+#endif
+
+namespace RAJA
+{
+
+namespace instrument
+{
+
+//! RAJA pattern that fired a launch event
+enum class Pattern { forall, kernel, scan, sort, reduce, histogram };
+
+//! Name of a pattern, e.g. "forall"
+const char* getPatternName(Pattern pattern);
+
+/*!
+ * \brief Description of one launch passed to Listener callbacks.
+ *
+ * The policy string is valid for the lifetime of the program. The label is
+ * only valid while its ScopedLabel is alive, so listeners that keep it past
+ * the callback should copy it.
+ */
+struct LaunchInfo {
+  Pattern pattern;
+  //! name of the execution (or reduction) policy type
+  const char* policy;
+  //! label of the enclosing ScopedLabel, nullptr if there is none
+  const char* label;
+  //! number of loop iterations, 0 for reductions
+  Index_type num_iterations;
+  //! wall clock time of the launch in seconds, only set in postLaunch
+  double elapsed;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Base class for objects receiving launch events.
+ *
+ *         Events are fired on the thread calling the RAJA pattern, so
+ *         listeners must be thread safe if patterns are launched from more
+ *         than one thread.
+ *
+ *         Events are only fired when RAJA is configured with
+ *         ENABLE_INSTRUMENTATION; otherwise no code is generated for them.
+ *
+ ******************************************************************************
+ */
+class Listener
+{
+public:
+  virtual ~Listener();
+
+  virtual void preLaunch(const LaunchInfo&) {}
+
+  virtual void postLaunch(const LaunchInfo&) {}
+};
+
+//! Start sending launch events to listener.
+void addListener(Listener* listener);
+
+//! Stop sending launch events to listener.
+void removeListener(Listener* listener);
+
+//! Label of the innermost ScopedLabel on the calling thread, or nullptr.
+const char* getLabel();
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Labels all launches made by the calling thread while in scope.
+ *
+ *         Labels nest; the innermost one is reported. The label string must
+ *         outlive the ScopedLabel.
+ *
+ *         RAJA::instrument::ScopedLabel label("hydro::update");
+ *         RAJA::forall<RAJA::omp_parallel_for_exec>(range, body);
+ *
+ ******************************************************************************
+ */
+class ScopedLabel
+{
+public:
+#if defined(RAJA_ENABLE_INSTRUMENTATION)
+  explicit ScopedLabel(const char* label);
+  ~ScopedLabel();
+#else
+  explicit ScopedLabel(const char*) {}
+#endif
+
+  ScopedLabel(const ScopedLabel&) = delete;
+  ScopedLabel& operator=(const ScopedLabel&) = delete;
+
+#if defined(RAJA_ENABLE_INSTRUMENTATION)
+private:
+  const char* m_previous;
+#endif
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Listener aggregating launches by label, pattern and policy.
+ *
+ *         report() prints call counts, total time and iterations per
+ *         second for every entry, sorted by label.
+ *
+ *         RAJA::instrument::Profiler profiler;
+ *         RAJA::instrument::addListener(&profiler);
+ *         ...
+ *         RAJA::instrument::removeListener(&profiler);
+ *         profiler.report(std::cout);
+ *
+ ******************************************************************************
+ */
+class Profiler : public Listener
+{
+public:
+  struct Record {
+    long num_calls;
+    Index_type num_iterations;
+    double elapsed;
+  };
+
+  //! key is (label, pattern name, policy name)
+  using Key = std::tuple<std::string, std::string, std::string>;
+
+  void postLaunch(const LaunchInfo& info) override;
+
+  //! Copy of the aggregated records.
+  std::map<Key, Record> getRecords() const;
+
+  void report(std::ostream& os) const;
+
+  void reset();
+
+private:
+  mutable std::mutex m_mutex;
+  std::map<Key, Record> m_records;
+};
+
+namespace detail
+{
+
+//! Number of registered listeners, checked before building any event.
+extern std::atomic<int> s_num_listeners;
+
+void fireLaunch(bool post, const LaunchInfo& info);
+
+#if defined(RAJA_ENABLE_INSTRUMENTATION)
+
+/*!
+ * Extract the name of T from the signature of getTypeName<T>, or return
+ * fallback if the signature is not understood.
+ */
+std::string parseTypeName(const char* signature, const char* fallback);
+
+//! Readable name for type T, computed once.
+template <typename T>
+const char* getTypeName()
+{
+#if defined(__GNUC__) || defined(__clang__)
+  static const std::string name =
+      parseTypeName(__PRETTY_FUNCTION__, typeid(T).name());
+#else
+  static const std::string name = typeid(T).name();
+#endif
+  return name.c_str();
+}
+
+/*!
+ * Fires preLaunch when constructed and postLaunch when destroyed, if any
+ * listener is registered. Placed at the top of each pattern entry point by
+ * RAJA_INSTRUMENT_LAUNCH.
+ */
+template <typename Policy>
+class LaunchScope
+{
+public:
+  template <typename Iterations>
+  LaunchScope(Pattern pattern, Iterations&& num_iterations)
+      : m_active(s_num_listeners.load(std::memory_order_relaxed) > 0)
+  {
+    if (m_active) {
+      m_info.pattern = pattern;
+      m_info.policy = getTypeName<typename std::decay<Policy>::type>();
+      m_info.label = getLabel();
+      m_info.num_iterations = static_cast<Index_type>(num_iterations());
+      m_info.elapsed = 0.0;
+      fireLaunch(false, m_info);
+      m_start = clock_type::now();
+    }
+  }
+
+  ~LaunchScope()
+  {
+    if (m_active) {
+      m_info.elapsed =
+          std::chrono::duration<double>(clock_type::now() - m_start).count();
+      fireLaunch(true, m_info);
+    }
+  }
+
+  LaunchScope(const LaunchScope&) = delete;
+  LaunchScope& operator=(const LaunchScope&) = delete;
+
+private:
+  using clock_type = std::chrono::steady_clock;
+
+  bool m_active;
+  LaunchInfo m_info;
+  clock_type::time_point m_start;
+};
+
+#endif
+
+}  // end namespace detail
+
+}  // end namespace instrument
+
+}  // end namespace RAJA
+
+/*!
+ * \def RAJA_INSTRUMENT_LAUNCH(pattern, Policy, num_iterations)
+ *
+ * Fire launch events for the rest of the enclosing scope. num_iterations is
+ * only evaluated when a listener is registered, and nothing is generated
+ * unless RAJA is configured with ENABLE_INSTRUMENTATION.
+ */
+#if defined(RAJA_ENABLE_INSTRUMENTATION)
+#define RAJA_INSTRUMENT_LAUNCH(pattern, Policy, num_iterations)         \
+  ::RAJA::instrument::detail::LaunchScope<Policy>                       \
+      raja_instrument_launch_scope(                                      \
+          ::RAJA::instrument::Pattern::pattern,                          \
+          [&]() -> ::RAJA::Index_type { return (num_iterations); })
+#else
+#define RAJA_INSTRUMENT_LAUNCH(pattern, Policy, num_iterations)
+#endif
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,573 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the fixed width SIMD register type,
+ *          the vector loop index passed by simd_vector_exec and the View
+ *          references used for vector loads and stores.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_simd_register_HPP
+#define RAJA_simd_register_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/defines.hpp"
+#include "RAJA/util/types.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Fixed width vector of Width values of type T.
+ *
+ *         Every operation is a loop over exactly Width lanes, which compilers
+ *         turn into vector instructions without relying on the analysis of
+ *         the surrounding loop. Loads and stores take the number of active
+ *         lanes; inactive lanes are neither read nor written and load as
+ *         zero.
+ *
+ *         Scalars convert implicitly to a register with every lane set.
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t Width>
+class simd_register
+{
+public:
+  static_assert(Width > 0, "simd_register needs at least one lane");
+
+  using element_type = T;
+
+  static constexpr size_t width = Width;
+
+  RAJA_INLINE simd_register()
+  {
+    RAJA_SIMD
+    for (size_t i = 0; i < Width; ++i) {
+      m_value[i] = T(0);
+    }
+  }
+
+  RAJA_INLINE simd_register(T const &scalar)
+  {
+    RAJA_SIMD
+    for (size_t i = 0; i < Width; ++i) {
+      m_value[i] = scalar;
+    }
+  }
+
+  //! Load the first num_lanes values of ptr.
+  RAJA_INLINE static simd_register load(T const *ptr,
+                                        size_t num_lanes = Width)
+  {
+    simd_register r;
+    if (num_lanes == Width) {
+      RAJA_SIMD
+      for (size_t i = 0; i < Width; ++i) {
+        r.m_value[i] = ptr[i];
+      }
+    } else {
+      for (size_t i = 0; i < num_lanes; ++i) {
+        r.m_value[i] = ptr[i];
+      }
+    }
+    return r;
+  }
+
+  //! Load ptr[0], ptr[stride], ... for the first num_lanes lanes.
+  RAJA_INLINE static simd_register load_strided(T const *ptr,
+                                                Index_type stride,
+                                                size_t num_lanes = Width)
+  {
+    simd_register r;
+    for (size_t i = 0; i < num_lanes; ++i) {
+      r.m_value[i] = ptr[i * stride];
+    }
+    return r;
+  }
+
+  //! Load ptr[offsets[i]] for the first num_lanes lanes.
+  template <typename IndexType>
+  RAJA_INLINE static simd_register gather(
+      T const *ptr,
+      simd_register<IndexType, Width> const &offsets,
+      size_t num_lanes = Width)
+  {
+    simd_register r;
+    for (size_t i = 0; i < num_lanes; ++i) {
+      r.m_value[i] = ptr[offsets[i]];
+    }
+    return r;
+  }
+
+  //! Store the first num_lanes lanes to ptr.
+  RAJA_INLINE void store(T *ptr, size_t num_lanes = Width) const
+  {
+    if (num_lanes == Width) {
+      RAJA_SIMD
+      for (size_t i = 0; i < Width; ++i) {
+        ptr[i] = m_value[i];
+      }
+    } else {
+      for (size_t i = 0; i < num_lanes; ++i) {
+        ptr[i] = m_value[i];
+      }
+    }
+  }
+
+  //! Store the first num_lanes lanes to ptr[0], ptr[stride], ...
+  RAJA_INLINE void store_strided(T *ptr,
+                                 Index_type stride,
+                                 size_t num_lanes = Width) const
+  {
+    for (size_t i = 0; i < num_lanes; ++i) {
+      ptr[i * stride] = m_value[i];
+    }
+  }
+
+  //! Store the first num_lanes lanes to ptr[offsets[i]].
+  template <typename IndexType>
+  RAJA_INLINE void scatter(T *ptr,
+                           simd_register<IndexType, Width> const &offsets,
+                           size_t num_lanes = Width) const
+  {
+    for (size_t i = 0; i < num_lanes; ++i) {
+      ptr[offsets[i]] = m_value[i];
+    }
+  }
+
+  RAJA_INLINE T const &operator[](size_t lane) const { return m_value[lane]; }
+
+  RAJA_INLINE T &operator[](size_t lane) { return m_value[lane]; }
+
+  //! Sum of the first num_lanes lanes.
+  RAJA_INLINE T sum(size_t num_lanes = Width) const
+  {
+    T result(0);
+    for (size_t i = 0; i < num_lanes; ++i) {
+      result += m_value[i];
+    }
+    return result;
+  }
+
+  //! Minimum of the first num_lanes lanes, num_lanes must not be zero.
+  RAJA_INLINE T min(size_t num_lanes = Width) const
+  {
+    T result = m_value[0];
+    for (size_t i = 1; i < num_lanes; ++i) {
+      result = m_value[i] < result ? m_value[i] : result;
+    }
+    return result;
+  }
+
+  //! Maximum of the first num_lanes lanes, num_lanes must not be zero.
+  RAJA_INLINE T max(size_t num_lanes = Width) const
+  {
+    T result = m_value[0];
+    for (size_t i = 1; i < num_lanes; ++i) {
+      result = m_value[i] > result ? m_value[i] : result;
+    }
+    return result;
+  }
+
+#define RAJA_SIMD_REGISTER_OP(OP)                                          \
+  RAJA_INLINE simd_register &operator OP##=(simd_register const &rhs)     \
+  {                                                                        \
+    RAJA_SIMD                                                              \
+    for (size_t i = 0; i < Width; ++i) {                                   \
+      m_value[i] = m_value[i] OP rhs.m_value[i];                           \
+    }                                                                      \
+    return *this;                                                          \
+  }                                                                        \
+                                                                           \
+  RAJA_INLINE friend simd_register operator OP(simd_register const &lhs,  \
+                                               simd_register const &rhs)  \
+  {                                                                        \
+    simd_register r(lhs);                                                  \
+    r OP##= rhs;                                                           \
+    return r;                                                              \
+  }
+
+  RAJA_SIMD_REGISTER_OP(+)
+  RAJA_SIMD_REGISTER_OP(-)
+  RAJA_SIMD_REGISTER_OP(*)
+  RAJA_SIMD_REGISTER_OP(/)
+
+#undef RAJA_SIMD_REGISTER_OP
+
+  RAJA_INLINE simd_register operator-() const
+  {
+    simd_register r;
+    RAJA_SIMD
+    for (size_t i = 0; i < Width; ++i) {
+      r.m_value[i] = -m_value[i];
+    }
+    return r;
+  }
+
+private:
+  T m_value[Width];
+};
+
+template <typename T, size_t Width>
+constexpr size_t simd_register<T, Width>::width;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Index of Width consecutive loop iterations, passed to the loop
+ *         body by simd_vector_exec.
+ *
+ *         Lane i has the value value + i * stride(); only the first size
+ *         lanes are active, which masks the remainder of a loop whose
+ *         length is not a multiple of Width.
+ *
+ *         Layout maps vector indices to vector indices into linear space,
+ *         and View returns a simd_view_ref for them. Contiguous is true when
+ *         lanes are known at compile time to have unit stride: loop indices,
+ *         and linear indices where the vector index is in the stride1_dim of
+ *         the Layout.
+ *
+ ******************************************************************************
+ */
+template <typename IndexType, size_t Width, bool Contiguous = true>
+struct simd_vector_index {
+  using index_type = IndexType;
+
+  static constexpr size_t width = Width;
+
+  static constexpr bool contiguous = Contiguous;
+
+  //! value of the first lane
+  IndexType value;
+
+  //! distance between lanes, always 1 if Contiguous
+  Index_type lane_stride;
+
+  //! number of active lanes
+  size_t size;
+
+  RAJA_INLINE constexpr simd_vector_index(IndexType first,
+                                          size_t num_lanes = Width,
+                                          Index_type stride_in = 1)
+      : value(first), lane_stride(Contiguous ? 1 : stride_in), size(num_lanes)
+  {
+  }
+
+  RAJA_INLINE constexpr Index_type stride() const
+  {
+    return Contiguous ? 1 : lane_stride;
+  }
+
+  //! true if some lanes are masked off
+  RAJA_INLINE constexpr bool is_partial() const { return size != Width; }
+
+  //! Lane values as a register.
+  template <typename T>
+  RAJA_INLINE simd_register<T, Width> lanes() const
+  {
+    simd_register<T, Width> r;
+    RAJA_SIMD
+    for (size_t i = 0; i < Width; ++i) {
+      r[i] = static_cast<T>(value + static_cast<IndexType>(i * stride()));
+    }
+    return r;
+  }
+
+  //! Shift every lane by offset, e.g. for stencil neighbors.
+  RAJA_INLINE constexpr simd_vector_index operator+(IndexType offset) const
+  {
+    return simd_vector_index(value + offset, size, lane_stride);
+  }
+
+  RAJA_INLINE constexpr simd_vector_index operator-(IndexType offset) const
+  {
+    return simd_vector_index(value - offset, size, lane_stride);
+  }
+};
+
+template <typename IndexType, size_t Width, bool Contiguous>
+constexpr size_t simd_vector_index<IndexType, Width, Contiguous>::width;
+
+template <typename IndexType, size_t Width, bool Contiguous>
+constexpr bool simd_vector_index<IndexType, Width, Contiguous>::contiguous;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Reference to the Width values of a View addressed by a vector
+ *         index.
+ *
+ *         Reading converts to a simd_register with a vector load (strided
+ *         load if the lanes are not contiguous); assignment and compound
+ *         assignment store. Only active lanes are accessed.
+ *
+ ******************************************************************************
+ */
+template <typename T, size_t Width, bool Contiguous>
+class simd_view_ref
+{
+public:
+  using element_type = typename std::remove_const<T>::type;
+  using register_type = simd_register<element_type, Width>;
+
+  RAJA_INLINE simd_view_ref(T *ptr, Index_type stride, size_t num_lanes)
+      : m_ptr(ptr), m_stride(stride), m_size(num_lanes)
+  {
+  }
+
+  RAJA_INLINE register_type load() const
+  {
+    return Contiguous ? register_type::load(m_ptr, m_size)
+                      : register_type::load_strided(m_ptr, m_stride, m_size);
+  }
+
+  RAJA_INLINE operator register_type() const { return load(); }
+
+  RAJA_INLINE simd_view_ref const &operator=(register_type const &value) const
+  {
+    if (Contiguous) {
+      value.store(m_ptr, m_size);
+    } else {
+      value.store_strided(m_ptr, m_stride, m_size);
+    }
+    return *this;
+  }
+
+  //! Assigns the referenced values, it does not rebind the reference.
+  RAJA_INLINE simd_view_ref const &operator=(simd_view_ref const &rhs) const
+  {
+    return operator=(rhs.load());
+  }
+
+  template <typename U, bool C>
+  RAJA_INLINE simd_view_ref const &operator=(
+      simd_view_ref<U, Width, C> const &rhs) const
+  {
+    return operator=(register_type(rhs.load()));
+  }
+
+  RAJA_INLINE simd_view_ref const &operator+=(register_type const &rhs) const
+  {
+    return operator=(load() + rhs);
+  }
+
+  RAJA_INLINE simd_view_ref const &operator-=(register_type const &rhs) const
+  {
+    return operator=(load() - rhs);
+  }
+
+  RAJA_INLINE simd_view_ref const &operator*=(register_type const &rhs) const
+  {
+    return operator=(load() * rhs);
+  }
+
+  RAJA_INLINE simd_view_ref const &operator/=(register_type const &rhs) const
+  {
+    return operator=(load() / rhs);
+  }
+
+  //! number of active lanes
+  RAJA_INLINE size_t size() const { return m_size; }
+
+private:
+  T *m_ptr;
+  Index_type m_stride;
+  size_t m_size;
+};
+
+namespace detail
+{
+
+template <typename T>
+struct is_simd_view_ref : std::false_type {
+};
+
+template <typename T, size_t Width, bool Contiguous>
+struct is_simd_view_ref<simd_view_ref<T, Width, Contiguous>>
+    : std::true_type {
+};
+
+template <typename T>
+struct is_simd_vector_index : std::false_type {
+};
+
+template <typename IndexType, size_t Width, bool Contiguous>
+struct is_simd_vector_index<simd_vector_index<IndexType, Width, Contiguous>>
+    : std::true_type {
+};
+
+//! Scalar value of an index, the first lane for vector indices.
+template <typename IndexType>
+RAJA_INLINE constexpr IndexType simd_first_lane(IndexType index)
+{
+  return index;
+}
+
+template <typename IndexType, size_t Width, bool Contiguous>
+RAJA_INLINE constexpr IndexType simd_first_lane(
+    simd_vector_index<IndexType, Width, Contiguous> index)
+{
+  return index.value;
+}
+
+//! Lane stride of an index scaled by a layout stride, 0 for scalars.
+template <typename IndexType>
+RAJA_INLINE constexpr Index_type simd_lane_stride(IndexType, Index_type)
+{
+  return 0;
+}
+
+template <typename IndexType, size_t Width, bool Contiguous>
+RAJA_INLINE constexpr Index_type simd_lane_stride(
+    simd_vector_index<IndexType, Width, Contiguous> index,
+    Index_type stride)
+{
+  return index.stride() * stride;
+}
+
+//! Number of active lanes of an index, 0 for scalars.
+template <typename IndexType>
+RAJA_INLINE constexpr size_t simd_num_lanes(IndexType)
+{
+  return 0;
+}
+
+template <typename IndexType, size_t Width, bool Contiguous>
+RAJA_INLINE constexpr size_t simd_num_lanes(
+    simd_vector_index<IndexType, Width, Contiguous> index)
+{
+  return index.size;
+}
+
+//! Width and contiguity of an index, zero width for scalars.
+template <typename T, bool IsVector = is_simd_vector_index<T>::value>
+struct simd_index_traits {
+  static constexpr size_t width = 0;
+  static constexpr bool contiguous = true;
+};
+
+template <typename T>
+struct simd_index_traits<T, true> {
+  static constexpr size_t width = T::width;
+  static constexpr bool contiguous = T::contiguous;
+};
+
+/*!
+ * Properties of an index pack passed to Layout: the number of vector
+ * indices, their common width, and whether the one vector index is a
+ * contiguous index in dimension StrideOneDim.
+ */
+template <ptrdiff_t Dim, ptrdiff_t StrideOneDim, typename... Indices>
+struct simd_index_pack;
+
+template <ptrdiff_t Dim, ptrdiff_t StrideOneDim>
+struct simd_index_pack<Dim, StrideOneDim> {
+  static constexpr size_t num_vectors = 0;
+  static constexpr size_t width = 0;
+  static constexpr bool contiguous = true;
+};
+
+template <ptrdiff_t Dim,
+          ptrdiff_t StrideOneDim,
+          typename Index,
+          typename... Indices>
+struct simd_index_pack<Dim, StrideOneDim, Index, Indices...> {
+  using traits = simd_index_traits<typename std::decay<Index>::type>;
+  using rest = simd_index_pack<Dim + 1, StrideOneDim, Indices...>;
+
+  static constexpr bool is_vector = traits::width > 0;
+
+  static constexpr size_t num_vectors = rest::num_vectors + (is_vector ? 1 : 0);
+
+  static constexpr size_t width = is_vector ? traits::width : rest::width;
+
+  static constexpr bool contiguous =
+      is_vector ? (Dim == StrideOneDim && traits::contiguous
+                   && rest::num_vectors == 0)
+                : rest::contiguous;
+};
+
+template <typename T>
+struct simd_register_of {
+  using type = void;
+};
+
+template <typename T, size_t Width>
+struct simd_register_of<simd_register<T, Width>> {
+  using type = simd_register<T, Width>;
+};
+
+template <typename T, size_t Width, bool Contiguous>
+struct simd_register_of<simd_view_ref<T, Width, Contiguous>> {
+  using type = typename simd_view_ref<T, Width, Contiguous>::register_type;
+};
+
+/*!
+ * Register type of a binary expression with a view reference as its left
+ * operand, or as its right operand when the left one is not a reference
+ * (that case is handled by the first rule).
+ */
+template <typename Ref, typename Other>
+using simd_ref_result_t = typename std::enable_if<
+    is_simd_view_ref<Ref>::value,
+    typename simd_register_of<Ref>::type>::type;
+
+template <typename Other, typename Ref>
+using simd_ref_rresult_t = typename std::enable_if<
+    is_simd_view_ref<Ref>::value && !is_simd_view_ref<Other>::value,
+    typename simd_register_of<Ref>::type>::type;
+
+}  // end namespace detail
+
+#define RAJA_SIMD_VIEW_REF_OP(OP)                                        \
+  template <typename Ref, typename Other>                                \
+  RAJA_INLINE detail::simd_ref_result_t<Ref, Other> operator OP(        \
+      Ref const &lhs, Other const &rhs)                                  \
+  {                                                                      \
+    using register_type = detail::simd_ref_result_t<Ref, Other>;         \
+    return lhs.load() OP register_type(rhs);                             \
+  }                                                                      \
+                                                                         \
+  template <typename Other, typename Ref>                                \
+  RAJA_INLINE detail::simd_ref_rresult_t<Other, Ref> operator OP(       \
+      Other const &lhs, Ref const &rhs)                                  \
+  {                                                                      \
+    using register_type = detail::simd_ref_rresult_t<Other, Ref>;        \
+    return register_type(lhs) OP rhs.load();                             \
+  }
+
+RAJA_SIMD_VIEW_REF_OP(+)
+RAJA_SIMD_VIEW_REF_OP(-)
+RAJA_SIMD_VIEW_REF_OP(*)
+RAJA_SIMD_VIEW_REF_OP(/)
+
+#undef RAJA_SIMD_VIEW_REF_OP
+
+}  // end namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,510 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing a size-class slab memory pool.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_SLAB_MEMPOOL_HPP
+#define RAJA_SLAB_MEMPOOL_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace basic_mempool
+{
+
+namespace detail
+{
+
+//! log2 of the smallest block handed out by SlabMemPool
+constexpr int slab_min_block_log2 = 4;
+
+//! number of power of two size classes, 16 bytes up to 2^47 bytes
+constexpr int slab_num_classes = 44;
+
+//! log2 of the slab size; classes up to the slab size are carved from slabs
+constexpr int slab_log2 = 20;
+
+//! number of blocks per size class held by one cache
+constexpr int slab_cache_capacity = 16;
+
+//! maximum number of caches in a SlabMemPool
+constexpr int slab_max_caches = 256;
+
+//! number of entries in the table of blocks recently handed out by a cache
+constexpr int slab_recent_size = 64;
+
+/*!
+ * \brief Return the index of the smallest size class holding nbytes, or -1
+ *        if nbytes is larger than the largest class.
+ */
+RAJA_INLINE int slab_size_class(size_t nbytes)
+{
+  int log2 = slab_min_block_log2;
+  while (log2 < slab_min_block_log2 + slab_num_classes
+         && (size_t(1) << log2) < nbytes) {
+    ++log2;
+  }
+  const int cls = log2 - slab_min_block_log2;
+  return (cls < slab_num_classes) ? cls : -1;
+}
+
+//! Size in bytes of the blocks in size class cls
+RAJA_INLINE size_t slab_block_size(int cls)
+{
+  return size_t(1) << (cls + slab_min_block_log2);
+}
+
+//! Small integer unique to the calling thread, used to pick a cache.
+RAJA_INLINE int slab_thread_index()
+{
+  static std::atomic<int> s_next_index{0};
+  thread_local int tl_index =
+      s_next_index.fetch_add(1, std::memory_order_relaxed);
+  return tl_index;
+}
+
+/*! \class SlabCache
+ ******************************************************************************
+ *
+ * \brief  SlabCache holds blocks for one group of threads of a SlabMemPool.
+ *
+ * Each thread maps to one cache. A thread that finds its cache busy uses
+ * the shared free lists of the pool instead, so the cache lock is never
+ * waited on.
+ *
+ * A freed block that the cache handed out recently goes straight back to
+ * its size class. Other freed blocks are queued unsorted and only sorted
+ * into their size class when the queue is flushed under the pool lock;
+ * this keeps free() from having to look up the block's slab.
+ *
+ ******************************************************************************
+ */
+struct SlabCache {
+  SlabCache() : num_freed(0)
+  {
+    busy.clear();
+    std::fill(num_blocks, num_blocks + slab_num_classes, 0);
+    std::fill(recent_ptr, recent_ptr + slab_recent_size, nullptr);
+  }
+
+  static int recent_slot(const void* ptr)
+  {
+    return static_cast<int>((reinterpret_cast<std::uintptr_t>(ptr)
+                             >> slab_min_block_log2)
+                            & (slab_recent_size - 1));
+  }
+
+  //! Remember that ptr of size class cls was handed out by this cache.
+  void set_recent(void* ptr, int cls)
+  {
+    const int slot = recent_slot(ptr);
+    recent_ptr[slot] = ptr;
+    recent_cls[slot] = cls;
+  }
+
+  //! Put ptr back in its size class if it was handed out recently.
+  bool give_recent(void* ptr)
+  {
+    const int slot = recent_slot(ptr);
+    if (recent_ptr[slot] != ptr) {
+      return false;
+    }
+    const int cls = recent_cls[slot];
+    if (num_blocks[cls] == slab_cache_capacity) {
+      return false;
+    }
+    recent_ptr[slot] = nullptr;
+    blocks[cls][num_blocks[cls]++] = ptr;
+    return true;
+  }
+
+  //! Acquire the cache without waiting, returns false if it is in use.
+  bool try_lock() { return !busy.test_and_set(std::memory_order_acquire); }
+
+  void lock()
+  {
+    while (busy.test_and_set(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+  }
+
+  void unlock() { busy.clear(std::memory_order_release); }
+
+  std::atomic_flag busy;
+  int num_blocks[slab_num_classes];
+  void* blocks[slab_num_classes][slab_cache_capacity];
+  int num_freed;
+  void* freed[slab_cache_capacity];
+  void* recent_ptr[slab_recent_size];
+  int recent_cls[slab_recent_size];
+  char m_pad[RAJA::DATA_ALIGN];
+};
+
+} /* end namespace detail */
+
+
+/*! \class SlabMemPool
+ ******************************************************************************
+ *
+ * \brief  SlabMemPool is an alternative to MemPool with O(1) malloc/free for
+ * small, frequent allocations such as reducer and scratch memory.
+ *
+ * Requests are rounded up to a power of two size class. Classes up to
+ * slab_size are carved from slab_size aligned slabs, which are taken from
+ * arenas of arena_size() bytes obtained from the allocator; larger classes
+ * are allocated individually. Blocks are never coalesced or returned to the
+ * allocator before free_chunks().
+ *
+ * Each thread is served from one of a fixed set of caches, so most calls to
+ * malloc/free touch no shared state. The pool keeps all book-keeping on the
+ * host and never touches the memory it hands out, so it may be used with
+ * device allocators.
+ *
+ * SlabMemPool has the same interface as MemPool and can be used in its
+ * place, for example
+ *
+ * using device_mempool_type = basic_mempool::SlabMemPool<cuda::DeviceAllocator>;
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class SlabMemPool
+{
+public:
+  using allocator_type = allocator_t;
+
+  static inline SlabMemPool<allocator_t>& getInstance()
+  {
+    static SlabMemPool<allocator_t> pool{};
+    return pool;
+  }
+
+  static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
+
+  static const size_t slab_size = size_t(1) << detail::slab_log2;
+
+  SlabMemPool()
+      : m_num_caches(num_caches()),
+        m_caches(new detail::SlabCache[m_num_caches]),
+        m_default_arena_size(default_default_arena_size),
+        m_alloc()
+  {
+  }
+
+  SlabMemPool(SlabMemPool const&) = delete;
+  SlabMemPool& operator=(SlabMemPool const&) = delete;
+
+  ~SlabMemPool()
+  {
+    // With static objects like SlabMemPool, cudaErrorCudartUnloading is a
+    // possible error with cudaFree
+    // So no more cuda calls here
+  }
+
+  void free_chunks()
+  {
+    // caches are always acquired before the pool lock
+    for (int i = 0; i < m_num_caches; ++i) {
+      m_caches[i].lock();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      for (int i = 0; i < m_num_caches; ++i) {
+        detail::SlabCache& cache = m_caches[i];
+        std::fill(cache.num_blocks,
+                  cache.num_blocks + detail::slab_num_classes,
+                  0);
+        cache.num_freed = 0;
+        std::fill(cache.recent_ptr,
+                  cache.recent_ptr + detail::slab_recent_size,
+                  nullptr);
+      }
+      for (int cls = 0; cls < detail::slab_num_classes; ++cls) {
+        m_free_blocks[cls].clear();
+      }
+      m_free_slabs.clear();
+      m_slab_class.clear();
+
+      for (void* chunk : m_chunks) {
+        m_alloc.free(chunk);
+      }
+      m_chunks.clear();
+    }
+
+    for (int i = 0; i < m_num_caches; ++i) {
+      m_caches[i].unlock();
+    }
+  }
+
+  size_t arena_size()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_default_arena_size;
+  }
+
+  size_t arena_size(size_t new_size)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t prev_size = m_default_arena_size;
+    m_default_arena_size = new_size;
+    return prev_size;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    if (alignment > slab_size) {
+      return nullptr;
+    }
+
+    const int cls = detail::slab_size_class(std::max(nTs * sizeof(T),
+                                                     alignment));
+    if (cls < 0) {
+      return nullptr;
+    }
+
+    void* ptr = nullptr;
+    detail::SlabCache& cache = get_cache();
+    if (cache.try_lock()) {
+
+      if (cache.num_blocks[cls] == 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        flush(cache);
+        refill(cache, cls);
+      }
+
+      if (cache.num_blocks[cls] > 0) {
+        ptr = cache.blocks[cls][--cache.num_blocks[cls]];
+        if (detail::slab_block_size(cls) <= slab_size) {
+          cache.set_recent(ptr, cls);
+        }
+      }
+
+      cache.unlock();
+    } else {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ptr = take_block(cls);
+    }
+
+    return static_cast<T*>(ptr);
+  }
+
+  void free(const void* cptr)
+  {
+    if (cptr == nullptr) {
+      return;
+    }
+
+    void* ptr = const_cast<void*>(cptr);
+    detail::SlabCache& cache = get_cache();
+    if (cache.try_lock()) {
+
+      if (!cache.give_recent(ptr)) {
+        if (cache.num_freed == detail::slab_cache_capacity) {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          flush(cache);
+        }
+        cache.freed[cache.num_freed++] = ptr;
+      }
+
+      cache.unlock();
+    } else {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      give_block(ptr, nullptr);
+    }
+  }
+
+private:
+  static int num_caches()
+  {
+    const int hw = static_cast<int>(std::thread::hardware_concurrency());
+    int n = 1;
+    while (n < hw && n < detail::slab_max_caches) {
+      n *= 2;
+    }
+    return n;
+  }
+
+  detail::SlabCache& get_cache()
+  {
+    return m_caches[detail::slab_thread_index() & (m_num_caches - 1)];
+  }
+
+  /*!
+   * Sort the queued frees of cache into size classes, keeping small blocks
+   * in the cache while there is room. Requires m_mutex.
+   */
+  void flush(detail::SlabCache& cache)
+  {
+    for (int i = 0; i < cache.num_freed; ++i) {
+      give_block(cache.freed[i], &cache);
+    }
+    cache.num_freed = 0;
+  }
+
+  //! Return ptr to cache, or to the pool free lists. Requires m_mutex.
+  void give_block(void* ptr, detail::SlabCache* cache)
+  {
+    const std::uintptr_t base =
+        reinterpret_cast<std::uintptr_t>(ptr) & ~std::uintptr_t(slab_size - 1);
+
+    auto found = m_slab_class.find(base);
+    if (found == m_slab_class.end()) {
+      fprintf(stderr, "Unknown pointer %p", ptr);
+      return;
+    }
+
+    const int cls = found->second;
+    if (cache != nullptr && detail::slab_block_size(cls) <= slab_size
+        && cache->num_blocks[cls] < detail::slab_cache_capacity) {
+      cache->blocks[cls][cache->num_blocks[cls]++] = ptr;
+    } else {
+      m_free_blocks[cls].push_back(ptr);
+    }
+  }
+
+  //! Take one block of size class cls from the pool. Requires m_mutex.
+  void* take_block(int cls)
+  {
+    std::vector<void*>& blocks = m_free_blocks[cls];
+    if (blocks.empty()) {
+      grow(cls);
+    }
+    if (blocks.empty()) {
+      return nullptr;
+    }
+    void* ptr = blocks.back();
+    blocks.pop_back();
+    return ptr;
+  }
+
+  //! Move a batch of blocks of size class cls into cache. Requires m_mutex.
+  void refill(detail::SlabCache& cache, int cls)
+  {
+    const int batch = (detail::slab_block_size(cls) <= slab_size)
+                          ? detail::slab_cache_capacity / 2
+                          : 1;
+    std::vector<void*>& blocks = m_free_blocks[cls];
+    while (cache.num_blocks[cls] < batch) {
+      if (blocks.empty()) {
+        grow(cls);
+        if (blocks.empty()) {
+          break;
+        }
+      }
+      cache.blocks[cls][cache.num_blocks[cls]++] = blocks.back();
+      blocks.pop_back();
+    }
+  }
+
+  //! Add new blocks of size class cls to the pool. Requires m_mutex.
+  void grow(int cls)
+  {
+    const size_t block_size = detail::slab_block_size(cls);
+
+    if (block_size > slab_size) {
+      void* base = allocate_aligned(block_size);
+      if (base != nullptr) {
+        m_slab_class[reinterpret_cast<std::uintptr_t>(base)] = cls;
+        m_free_blocks[cls].push_back(base);
+      }
+      return;
+    }
+
+    if (m_free_slabs.empty()) {
+      const size_t num_slabs =
+          std::max(m_default_arena_size / slab_size, size_t(1));
+      char* arena = static_cast<char*>(allocate_aligned(num_slabs * slab_size));
+      if (arena == nullptr) {
+        return;
+      }
+      for (size_t i = num_slabs; i > 0; --i) {
+        m_free_slabs.push_back(arena + (i - 1) * slab_size);
+      }
+    }
+
+    char* slab = static_cast<char*>(m_free_slabs.back());
+    m_free_slabs.pop_back();
+    m_slab_class[reinterpret_cast<std::uintptr_t>(slab)] = cls;
+
+    // hand out the lowest addresses first
+    std::vector<void*>& blocks = m_free_blocks[cls];
+    for (size_t offset = slab_size; offset > 0; offset -= block_size) {
+      blocks.push_back(slab + offset - block_size);
+    }
+  }
+
+  //! Allocate nbytes aligned to slab_size. Requires m_mutex.
+  void* allocate_aligned(size_t nbytes)
+  {
+    void* chunk = m_alloc.malloc(nbytes + slab_size);
+    if (chunk == nullptr) {
+      return nullptr;
+    }
+    m_chunks.push_back(chunk);
+
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(chunk);
+    const std::uintptr_t aligned =
+        (addr + slab_size - 1) & ~std::uintptr_t(slab_size - 1);
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  std::mutex m_mutex;
+
+  int m_num_caches;
+  std::unique_ptr<detail::SlabCache[]> m_caches;
+
+  std::vector<void*> m_free_blocks[detail::slab_num_classes];
+  std::vector<void*> m_free_slabs;
+  std::unordered_map<std::uintptr_t, int> m_slab_class;
+  std::vector<void*> m_chunks;
+
+  size_t m_default_arena_size;
+  allocator_t m_alloc;
+};
+
+} /* end namespace basic_mempool */
+
+} /* end namespace RAJA */
+
+
+#endif /* RAJA_SLAB_MEMPOOL_HPP */
@@ -23,13 +23,149 @@
 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+#include "RAJA/index/BlockListSegment.hpp"
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace RAJA
 {
 
+namespace
+{
+
+/*
+ * Classifies the positions of an index array the way buildIndexSetAligned
+ * does: position p is in a Range segment if it extends the Range holding
+ * p-1, or if indices[p] is a multiple of RANGE_ALIGN and indices[p+1]
+ * follows it. Every other position is in a List segment, and a List
+ * segment spans all positions between two Range segments.
+ */
+class AlignedRunClassifier
+{
+public:
+  AlignedRunClassifier(const Index_type* indices, Index_type length)
+      : m_indices(indices), m_length(length)
+  {
+  }
+
+  //! Whether indices[p] directly follows indices[p-1].
+  bool linked(Index_type p) const
+  {
+    return p > 0 && p < m_length && m_indices[p] == m_indices[p - 1] + 1;
+  }
+
+  //! Whether position p is in a Range segment, given whether p-1 is.
+  bool inRange(bool prev_in_range, Index_type p) const
+  {
+    return (prev_in_range && linked(p))
+           || ((m_indices[p] % RANGE_ALIGN) == 0 && linked(p + 1));
+  }
+
+  //! Whether a segment starts at position p, given whether p-1 and p are in
+  //! Range segments.
+  bool startsSegment(bool prev_in_range, bool in_range, Index_type p) const
+  {
+    if (p == 0) return true;
+    return in_range ? !(prev_in_range && linked(p)) : prev_in_range;
+  }
+
+private:
+  const Index_type* m_indices;
+  Index_type m_length;
+};
+
+//! Start of a segment built by buildIndexSetAlignedParallel.
+struct AlignedSegmentStart {
+  Index_type pos;
+  bool range;
+};
+
+//! Per-thread part of the index array in buildIndexSetAlignedParallel.
+struct AlignedChunk {
+  Index_type begin;
+  Index_type end;
+  //! first position whose state does not depend on whether begin-1 is in a
+  //! Range segment
+  Index_type settled;
+  //! whether end-1 is in a Range segment if begin-1 is not / is
+  bool last_in_range_from_list;
+  bool last_in_range_from_range;
+  //! segments starting in [settled, end)
+  std::vector<AlignedSegmentStart> starts;
+};
+
+/*
+ * Segment starts of buildIndexSetAligned for the whole index array,
+ * followed by a List start at length.
+ */
+std::vector<AlignedSegmentStart> alignedSegmentStarts(
+    const AlignedRunClassifier& classify,
+    Index_type length)
+{
+  std::vector<AlignedSegmentStart> starts;
+  bool prev = false;
+  for (Index_type p = 0; p < length; ++p) {
+    const bool cur = classify.inRange(prev, p);
+    if (classify.startsSegment(prev, cur, p)) {
+      starts.push_back(AlignedSegmentStart{p, cur});
+    }
+    prev = cur;
+  }
+  starts.push_back(AlignedSegmentStart{length, false});
+  return starts;
+}
+
+//! Segment built by the Block List version of buildIndexSetAligned.
+struct AlignedPiece {
+  enum Kind { list, range, blocks };
+  Kind kind;
+  Index_type pos;
+  Index_type len;
+};
+
+//! Longest Range segment, in blocks, that may become part of a Block List.
+//! Loading one start per block costs less than running a segment of its
+//! own, but long Ranges are kept for their longer inner loop.
+constexpr Index_type block_list_max_range_blocks = 32;
+
+//! Whether indices[p] is a multiple of block_size and starts a run of
+//! block_size consecutive indices.
+bool isAlignedBlock(const Index_type* indices,
+                    Index_type p,
+                    Index_type block_size)
+{
+  if (indices[p] % block_size != 0) return false;
+  for (Index_type j = 1; j < block_size; ++j) {
+    if (indices[p + j] != indices[p] + j) return false;
+  }
+  return true;
+}
+
+//! Append a piece, merging neighbouring blocks.
+void appendAlignedPiece(std::vector<AlignedPiece>& pieces,
+                        AlignedPiece::Kind kind,
+                        Index_type pos,
+                        Index_type len)
+{
+  if (kind == AlignedPiece::blocks && !pieces.empty()
+      && pieces.back().kind == AlignedPiece::blocks) {
+    pieces.back().len += len;
+  } else {
+    pieces.push_back(AlignedPiece{kind, pos, len});
+  }
+}
+
+}  // end anonymous namespace
+
 /*
 *************************************************************************
 *
@@ -193,4 +329,262 @@ void buildIndexSetAligned(RAJA::TypedIndexSet<RAJA::RangeSegment,
   }
 }
 
+/*
+*************************************************************************
+*
+* Build the same index set as buildIndexSetAligned in parallel. Whether a
+* position is in a Range segment depends only on its neighbours and on
+* whether the previous position is, and stops depending on the latter at
+* the first break in consecutive indices or the first aligned index. So
+* each chunk is scanned once in parallel from both possible states at its
+* start until they agree, and records its segments from there on. A
+* serial pass then rescans these few settling positions of each chunk
+* with the state carried over from the previous chunk.
+*
+*************************************************************************
+*/
+
+void buildIndexSetAlignedParallel(RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                  RAJA::ListSegment>& hiset,
+                                  const Index_type* const indices_in,
+                                  Index_type length)
+{
+  if (length == 0) return;
+
+  if (length <= RANGE_MIN_LENGTH) {
+    hiset.push_back(ListSegment(indices_in, length));
+    return;
+  }
+
+  const AlignedRunClassifier classify(indices_in, length);
+
+  const int num_chunks = static_cast<int>(
+      std::min<Index_type>(getMaxOMPThreadsCPU(), length));
+  std::vector<AlignedChunk> chunks(num_chunks);
+
+#pragma omp parallel for schedule(static, 1)
+  for (int c = 0; c < num_chunks; ++c) {
+    AlignedChunk& chunk = chunks[c];
+    chunk.begin = length * c / num_chunks;
+    chunk.end = length * (c + 1) / num_chunks;
+
+    bool from_list = false;
+    bool from_range = true;
+    Index_type p = chunk.begin;
+    for (; p < chunk.end && from_list != from_range; ++p) {
+      from_list = classify.inRange(from_list, p);
+      from_range = classify.inRange(from_range, p);
+    }
+    chunk.settled = p;
+
+    bool prev = from_list;
+    for (; p < chunk.end; ++p) {
+      const bool cur = classify.inRange(prev, p);
+      if (classify.startsSegment(prev, cur, p)) {
+        chunk.starts.push_back(AlignedSegmentStart{p, cur});
+      }
+      prev = cur;
+    }
+    chunk.last_in_range_from_list = (chunk.settled < chunk.end) ? prev
+                                                                : from_list;
+    chunk.last_in_range_from_range = (chunk.settled < chunk.end) ? prev
+                                                                 : from_range;
+  }
+
+  std::vector<AlignedSegmentStart> starts;
+  bool prev = false;
+  for (const AlignedChunk& chunk : chunks) {
+    for (Index_type p = chunk.begin; p < chunk.settled; ++p) {
+      const bool cur = classify.inRange(prev, p);
+      if (classify.startsSegment(prev, cur, p)) {
+        starts.push_back(AlignedSegmentStart{p, cur});
+      }
+      prev = cur;
+    }
+    starts.insert(starts.end(), chunk.starts.begin(), chunk.starts.end());
+    prev = prev ? chunk.last_in_range_from_range
+                : chunk.last_in_range_from_list;
+  }
+
+  const Index_type num_segments = starts.size();
+  starts.push_back(AlignedSegmentStart{length, false});
+
+  /* same cutoff as buildIndexSetAligned: length + begin for each range, */
+  /* length + singletons for each list, zero length termination */
+  Index_type docount = 1;
+  for (Index_type seg = 0; seg < num_segments; ++seg) {
+    docount += starts[seg].range ? 2
+                                 : 1 + starts[seg + 1].pos - starts[seg].pos;
+  }
+  if (!(docount < (length * (RANGE_ALIGN - 1)) / RANGE_ALIGN)) {
+    hiset.push_back(ListSegment(indices_in, length));
+    return;
+  }
+
+  std::vector<std::unique_ptr<ListSegment>> lists(num_segments);
+
+#pragma omp parallel for schedule(dynamic, 16)
+  for (Index_type seg = 0; seg < num_segments; ++seg) {
+    if (!starts[seg].range) {
+      lists[seg].reset(new ListSegment(&indices_in[starts[seg].pos],
+                                       starts[seg + 1].pos - starts[seg].pos));
+    }
+  }
+
+  for (Index_type seg = 0; seg < num_segments; ++seg) {
+    if (starts[seg].range) {
+      const Index_type first = indices_in[starts[seg].pos];
+      hiset.push_back(RangeSegment(
+          first, first + starts[seg + 1].pos - starts[seg].pos));
+    } else {
+      hiset.push_back(std::move(*lists[seg]));
+    }
+  }
+}
+
+/*
+*************************************************************************
+*
+* Initialize index set with aligned Ranges, List segments and Block List
+* segments from array of indices with given length. The segments of
+* buildIndexSetAligned are split into pieces: short Ranges of whole
+* aligned blocks and aligned blocks within Lists become blocks, and
+* neighbouring blocks are merged into one Block List.
+*
+*************************************************************************
+*/
+
+template <Index_type BlockSize>
+void buildIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::BlockListSegment<BlockSize>>& hiset,
+    const Index_type* const indices_in,
+    Index_type length)
+{
+  if (length == 0) return;
+
+  if (length <= RANGE_MIN_LENGTH) {
+    hiset.push_back(ListSegment(indices_in, length));
+    return;
+  }
+
+  const AlignedRunClassifier classify(indices_in, length);
+  const std::vector<AlignedSegmentStart> starts =
+      alignedSegmentStarts(classify, length);
+
+  std::vector<AlignedPiece> pieces;
+  for (size_t seg = 0; seg + 1 < starts.size(); ++seg) {
+    const Index_type begin = starts[seg].pos;
+    const Index_type end = starts[seg + 1].pos;
+    const Index_type len = end - begin;
+
+    if (starts[seg].range) {
+      const bool whole_blocks = indices_in[begin] % BlockSize == 0
+                                && len % BlockSize == 0
+                                && len / BlockSize
+                                       <= block_list_max_range_blocks;
+      appendAlignedPiece(pieces,
+                         whole_blocks ? AlignedPiece::blocks
+                                      : AlignedPiece::range,
+                         begin,
+                         len);
+      continue;
+    }
+
+    Index_type list_begin = begin;
+    Index_type p = begin;
+    while (p < end) {
+      if (p + BlockSize <= end && isAlignedBlock(indices_in, p, BlockSize)) {
+        if (p > list_begin) {
+          appendAlignedPiece(pieces, AlignedPiece::list, list_begin,
+                             p - list_begin);
+        }
+        appendAlignedPiece(pieces, AlignedPiece::blocks, p, BlockSize);
+        p += BlockSize;
+        list_begin = p;
+      } else {
+        ++p;
+      }
+    }
+    if (end > list_begin) {
+      appendAlignedPiece(pieces, AlignedPiece::list, list_begin,
+                         end - list_begin);
+    }
+  }
+
+  /* blocks that are one run of consecutive indices are a Range; each */
+  /* block must start where the previous one ends, since repeated or  */
+  /* permuted blocks can span the same first and last index           */
+  for (AlignedPiece& piece : pieces) {
+    if (piece.kind != AlignedPiece::blocks) continue;
+    bool consecutive = true;
+    for (Index_type p = piece.pos + BlockSize;
+         consecutive && p < piece.pos + piece.len;
+         p += BlockSize) {
+      consecutive = indices_in[p] == indices_in[p - BlockSize] + BlockSize;
+    }
+    if (consecutive) {
+      piece.kind = AlignedPiece::range;
+    }
+  }
+
+  /* same cutoff as buildIndexSetAligned, with start + count for each */
+  /* block list */
+  Index_type docount = 1;
+  for (const AlignedPiece& piece : pieces) {
+    docount += piece.kind == AlignedPiece::range
+                   ? 2
+                   : piece.kind == AlignedPiece::list
+                         ? 1 + piece.len
+                         : 1 + piece.len / BlockSize;
+  }
+  if (!(docount < (length * (RANGE_ALIGN - 1)) / RANGE_ALIGN)) {
+    hiset.push_back(ListSegment(indices_in, length));
+    return;
+  }
+
+  std::vector<Index_type> block_starts;
+  for (const AlignedPiece& piece : pieces) {
+    if (piece.kind == AlignedPiece::range) {
+      const Index_type first = indices_in[piece.pos];
+      hiset.push_back(RangeSegment(first, first + piece.len));
+    } else if (piece.kind == AlignedPiece::list) {
+      hiset.push_back(ListSegment(&indices_in[piece.pos], piece.len));
+    } else {
+      block_starts.clear();
+      for (Index_type p = piece.pos; p < piece.pos + piece.len;
+           p += BlockSize) {
+        block_starts.push_back(indices_in[p]);
+      }
+      hiset.push_back(BlockListSegment<BlockSize>(block_starts));
+    }
+  }
+}
+
+template void buildIndexSetAligned<4>(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::BlockListSegment<4>>&,
+    const Index_type* const,
+    Index_type);
+template void buildIndexSetAligned<8>(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::BlockListSegment<8>>&,
+    const Index_type* const,
+    Index_type);
+template void buildIndexSetAligned<16>(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::BlockListSegment<16>>&,
+    const Index_type* const,
+    Index_type);
+template void buildIndexSetAligned<32>(
+    RAJA::TypedIndexSet<RAJA::RangeSegment,
+                        RAJA::ListSegment,
+                        RAJA::BlockListSegment<32>>&,
+    const Index_type* const,
+    Index_type);
+
 }  // closing brace for RAJA namespace
@@ -0,0 +1,185 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the asynchronous host launch queue.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/AsyncQueue.hpp"
+#include "RAJA/policy/threads/ThreadPool.hpp"
+
+namespace RAJA
+{
+
+namespace threads
+{
+
+namespace
+{
+
+//! Whether the calling thread is the AsyncQueue worker.
+thread_local bool tl_on_queue = false;
+
+}  // end anonymous namespace
+
+/*
+*************************************************************************
+*
+* AsyncState methods.
+*
+*************************************************************************
+*/
+void detail::AsyncState::complete(std::exception_ptr error)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_done = true;
+    m_error = error;
+  }
+  m_cv.notify_all();
+}
+
+bool detail::AsyncState::ready()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_done;
+}
+
+void detail::AsyncState::wait()
+{
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return m_done; });
+    std::swap(error, m_error);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+/*
+*************************************************************************
+*
+* AsyncQueue methods.
+*
+*************************************************************************
+*/
+AsyncQueue& AsyncQueue::getInstance()
+{
+  static AsyncQueue queue;
+  return queue;
+}
+
+AsyncQueue::AsyncQueue() : m_busy(false), m_shutdown(false)
+{
+  // Tasks usually launch on the thread pool; make sure it is constructed
+  // first so that it outlives the queue at exit.
+  ThreadPool::getInstance();
+
+  m_worker = std::thread(&AsyncQueue::workerLoop, this);
+}
+
+AsyncQueue::~AsyncQueue()
+{
+  synchronize();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+  }
+  m_wake.notify_one();
+  m_worker.join();
+}
+
+bool AsyncQueue::onQueueThread() { return tl_on_queue; }
+
+AsyncEvent AsyncQueue::enqueue(std::unique_ptr<detail::AsyncTask> task)
+{
+  auto state = std::make_shared<detail::AsyncState>();
+  task->state = state;
+
+  if (tl_on_queue) {
+    // waiting on this task from the queue thread would deadlock
+    std::exception_ptr error;
+    try {
+      task->execute();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    state->complete(error);
+    return AsyncEvent(state);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+  }
+  m_wake.notify_one();
+  return AsyncEvent(state);
+}
+
+void AsyncQueue::synchronize()
+{
+  if (tl_on_queue) return;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_idle.wait(lock, [this] { return m_tasks.empty() && !m_busy; });
+}
+
+void AsyncQueue::workerLoop()
+{
+  tl_on_queue = true;
+
+  while (true) {
+    std::unique_ptr<detail::AsyncTask> task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [this] { return m_shutdown || !m_tasks.empty(); });
+      if (m_tasks.empty()) return;
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      m_busy = true;
+    }
+
+    std::exception_ptr error;
+    try {
+      task->execute();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    task->state->complete(error);
+    task.reset();
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_busy = false;
+    }
+    m_idle.notify_all();
+  }
+}
+
+}  // closing brace for threads namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // if defined(RAJA_ENABLE_THREADS)
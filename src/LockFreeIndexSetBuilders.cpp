@@ -24,6 +24,7 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
@@ -33,7 +34,11 @@
 #include <cstdlib>
 #include <cstring>
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 namespace RAJA
 {
@@ -42,6 +47,228 @@ namespace RAJA
  * See buildLockFreeIndexSet.hxx for other comments.
  */
 
+using LockFreeIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                             RAJA::ListSegment,
+                                             RAJA::RangeStrideSegment>;
+
+namespace
+{
+
+/*
+ ******************************************************************************
+ *
+ * Dependency graph for a lock-free "block" index set of numThreads *
+ * numLanes slabs. Slab p = thread * numLanes + lane is stored as segment
+ * lane * numThreads + thread, and a slab only shares entities with slabs
+ * p - 1 and p + 1. Each slab depends on its neighbors in lower lanes, so
+ * all lane 0 slabs start at once and every other slab starts as soon as
+ * both of its neighbors are done.
+ *
+ ******************************************************************************
+ */
+void buildLaneDependencyGraph(LockFreeIndexSet& iset,
+                              int numThreads,
+                              int numLanes)
+{
+  iset.initDependencyGraph();
+
+  const int numSlabs = numThreads * numLanes;
+  for (int slab = 0; slab < numSlabs; ++slab) {
+    const int lane = slab % numLanes;
+    const int seg = lane * numThreads + slab / numLanes;
+    RAJA::DepGraphNode* task = iset.getDepGraphNode(seg);
+
+    for (int nbr = slab - 1; nbr <= slab + 1; nbr += 2) {
+      if (nbr < 0 || nbr >= numSlabs || nbr % numLanes >= lane) continue;
+      const int nbrSeg = (nbr % numLanes) * numThreads + nbr / numLanes;
+      iset.getDepGraphNode(nbrSeg)->addDepTask(seg);
+      ++task->semaphoreReloadValue();
+    }
+  }
+
+  iset.finalizeDependencyGraph();
+}
+
+#define PROFITABLE_ENTITY_THRESHOLD_COLOR 100
+
+/*
+ ******************************************************************************
+ *
+ * Split each of the numColors colors of workset, which end at colorDelim,
+ * into up to numThreads chunks and push one segment per chunk; the
+ * segments are Ranges into the permutation if one is asked for, and else
+ * Ranges or Lists of the elements. Returns the end of each chunk in
+ * workset.
+ *
+ ******************************************************************************
+ */
+std::vector<Index_type> pushColorSegments(LockFreeIndexSet& iset,
+                                          const Index_type* workset,
+                                          const Index_type* colorDelim,
+                                          Index_type numColors,
+                                          int numEntity,
+                                          Index_type* elemPermutation,
+                                          Index_type* ielemPermutation)
+{
+  /* split each color into up to numThreads chunks */
+  int numThreads = getMaxOMPThreadsCPU();
+  std::vector<Index_type> chunkDelim;
+  Index_type colorEnd = 0;
+  for (int i = 0; i < numColors; ++i) {
+    Index_type colorBegin = colorEnd;
+    colorEnd = colorDelim[i];
+    Index_type len = colorEnd - colorBegin;
+    Index_type numChunks = std::max<Index_type>(
+        1,
+        std::min<Index_type>(numThreads,
+                             len / PROFITABLE_ENTITY_THRESHOLD_COLOR));
+    for (Index_type k = 0; k < numChunks; ++k) {
+      chunkDelim.push_back(colorBegin + (k + 1) * len / numChunks);
+    }
+  }
+  int numChunks = static_cast<int>(chunkDelim.size());
+
+  /* we may want to create a permutation array here */
+  if (elemPermutation != 0l) {
+    /* send back permutaion array, and corresponding range segments */
+
+    memcpy(elemPermutation, &workset[0], numEntity * sizeof(Index_type));
+    if (ielemPermutation != 0l) {
+      for (int i = 0; i < numEntity; ++i) {
+        ielemPermutation[elemPermutation[i]] = i;
+      }
+    }
+    Index_type end = 0;
+    for (int i = 0; i < numChunks; ++i) {
+      Index_type begin = end;
+      end = chunkDelim[i];
+      iset.push_back(RAJA::RangeSegment(begin, end));
+    }
+  } else {
+    Index_type end = 0;
+    for (int i = 0; i < numChunks; ++i) {
+      Index_type begin = end;
+      end = chunkDelim[i];
+      bool isRange = true;
+      for (int j = begin + 1; j < end; ++j) {
+        if (workset[j - 1] + 1 != workset[j]) {
+          isRange = false;
+          break;
+        }
+      }
+      if (isRange) {
+        iset.push_back(
+            RAJA::RangeSegment(workset[begin], workset[end - 1] + 1));
+      } else {
+        iset.push_back(RAJA::ListSegment(&workset[begin], end - begin));
+      }
+    }
+  }
+
+  return chunkDelim;
+}
+
+/*
+ ******************************************************************************
+ *
+ * Conflict graph of the parallel color builder: two domain elements are
+ * neighbors if they share a range entity. The range-to-domain map is held
+ * in compressed rows.
+ *
+ ******************************************************************************
+ */
+struct ColorConflictGraph {
+  Index_type const* domainToRange;
+  int numRangePerDomain;
+  //! elements of range entity r are rangeToDomain[rangeBegin[r] ...
+  //! rangeBegin[r + 1] - 1]
+  std::vector<Index_type> rangeBegin;
+  std::vector<Index_type> rangeToDomain;
+  //! upper bound on the number of neighbors of an element
+  Index_type maxNeighbors;
+
+  ColorConflictGraph(Index_type const* d2r,
+                     int numEntity,
+                     int numRangePerDomain_,
+                     int numEntityRange)
+      : domainToRange(d2r),
+        numRangePerDomain(numRangePerDomain_),
+        rangeBegin(numEntityRange + 1, 0),
+        rangeToDomain(static_cast<size_t>(numEntity) * numRangePerDomain_),
+        maxNeighbors(0)
+  {
+    const Index_type numRefs =
+        static_cast<Index_type>(numEntity) * numRangePerDomain;
+
+#pragma omp parallel for
+    for (Index_type k = 0; k < numRefs; ++k) {
+      Index_type& count = rangeBegin[domainToRange[k] + 1];
+#pragma omp atomic
+      ++count;
+    }
+
+    Index_type maxCount = 0;
+    for (int r = 0; r < numEntityRange; ++r) {
+      maxCount = std::max(maxCount, rangeBegin[r + 1]);
+      rangeBegin[r + 1] += rangeBegin[r];
+    }
+    maxNeighbors = numRangePerDomain * maxCount;
+
+    /* the order of the elements of a range entity does not matter */
+    std::vector<Index_type> next(rangeBegin.begin(), rangeBegin.end() - 1);
+#pragma omp parallel for
+    for (Index_type k = 0; k < numRefs; ++k) {
+      Index_type& pos = next[domainToRange[k]];
+      Index_type slot;
+#pragma omp atomic capture
+      slot = pos++;
+      rangeToDomain[slot] = k / numRangePerDomain;
+    }
+  }
+
+  //! Call f(nbr) for each neighbor of element e, possibly more than once,
+  //! until f returns false.
+  template <typename F>
+  void forEachNeighbor(Index_type e, F&& f) const
+  {
+    for (int j = 0; j < numRangePerDomain; ++j) {
+      const Index_type r = domainToRange[e * numRangePerDomain + j];
+      for (Index_type k = rangeBegin[r]; k < rangeBegin[r + 1]; ++k) {
+        const Index_type nbr = rangeToDomain[k];
+        if (nbr != e && !f(nbr)) return;
+      }
+    }
+  }
+};
+
+//! Pseudo-random priority of element e when moving elements between
+//! colors in the parallel color builder.
+inline std::uint64_t colorPriority(Index_type e)
+{
+  std::uint64_t z = static_cast<std::uint64_t>(e) + 0x9e3779b97f4a7c15ull;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+//! Whether element a goes before element b, by priority and then index.
+inline bool colorMovesBefore(Index_type a, Index_type b)
+{
+  const std::uint64_t pa = colorPriority(a), pb = colorPriority(b);
+  return pa > pb || (pa == pb && a < b);
+}
+
+//! Elements colored in turn by one thread in the parallel color builder.
+const int color_block_size = 4096;
+
+//! Most rounds of moving elements from large to small colors.
+const int color_balance_max_rounds = 16;
+
+//! Colors are balanced once none exceeds the mean by more than 1/this.
+const int color_balance_tolerance = 100;
+
+}  // end anonymous namespace
+
 /*
  ******************************************************************************
  *
@@ -53,53 +280,36 @@ namespace RAJA
  */
 #define PROFITABLE_ENTITY_THRESHOLD_BLOCK 100
 
-void buildLockFreeBlockIndexset(RAJA::TypedIndexSet<RAJA::RangeSegment,
-                                RAJA::ListSegment, RAJA::RangeStrideSegment>& iset,
+void buildLockFreeBlockIndexset(LockFreeIndexSet& iset,
                                 Index_type fastDim,
                                 Index_type midDim,
                                 Index_type slowDim)
 {
   int numThreads = getMaxOMPThreadsCPU();
 
-  // printf("Lock-free created\n") ;
-
   if ((midDim | slowDim) == 0) /* 1d mesh */
   {
     if (fastDim / PROFITABLE_ENTITY_THRESHOLD_BLOCK <= 1) {
-      // printf("%d %d\n", 0, fastDim) ;
       iset.push_back(RAJA::RangeSegment(0, fastDim));
+      buildLaneDependencyGraph(iset, 1, 1);
     } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
-
-      /* We might want to force one thread if the */
-      /* profitability ratio is really bad, but for */
-      /* now use the brain dead approach. */
       int numSegments = numThreads * 3;
       for (int lane = 0; lane < 3; ++lane) {
         for (int i = lane; i < numSegments; i += 3) {
           Index_type start = i * fastDim / numSegments;
           Index_type end = (i + 1) * fastDim / numSegments;
-          // printf("%d %d\n", start, end) ;
           iset.push_back(RAJA::RangeSegment(start, end));
         }
       }
+      buildLaneDependencyGraph(iset, numThreads, 3);
     }
   } else if (slowDim == 0) /* 2d mesh */
   {
     int rowsPerSegment = midDim / (3 * numThreads);
     if (rowsPerSegment == 0) {
-      // printf("%d %d\n", 0, fastDim*midDim) ;
       iset.push_back(RAJA::RangeSegment(0, fastDim * midDim));
+      buildLaneDependencyGraph(iset, 1, 1);
     } else {
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
-
-      /* We might want to force one thread if the */
-      /* profitability ratio is really bad, but for */
-      /* now use the brain dead approach. */
       for (int lane = 0; lane < 3; ++lane) {
         for (int i = 0; i < numThreads; ++i) {
           Index_type startRow = i * midDim / numThreads;
@@ -107,39 +317,21 @@ void buildLockFreeBlockIndexset(RAJA::TypedIndexSet<RAJA::RangeSegment,
           Index_type start = startRow * fastDim;
           Index_type end = endRow * fastDim;
           Index_type len = end - start;
-          // printf("%d %d\n", start + (lane  )*len/3,
-          //                   start + (lane+1)*len/3  ) ;
           iset.push_back(RAJA::RangeSegment(start + (lane)*len / 3,
                                             start + (lane + 1) * len / 3));
         }
       }
+      buildLaneDependencyGraph(iset, numThreads, 3);
     }
   } else { /* 3d mesh */
 
-// this requires dependence graph - commenting out for now
-
-    /* Need at least 3 full planes per thread */
-    /* and at least one segment per plane */
-/*
+    /* Need at least one full plane per segment */
     const int segmentsPerThread = 2;
     int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
     if (rowsPerSegment == 0) {
-      // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
       iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-      printf(
-          "Failure to create lockfree indexset - not enough rows per "
-          "segment\n");
-      exit(-1);
+      buildLaneDependencyGraph(iset, 1, 1);
     } else {
-*/
-      /* This just sets up the schedule -- a truly safe */
-      /* execution of this schedule would require a check */
-      /* for completion of dependent threads before execution. */
-
-      /* We might want to force one thread if the */
-      /* profitability ratio is really bad, but for */
-      /* now use the brain dead approach. */
-/*
       for (int lane = 0; lane < segmentsPerThread; ++lane) {
         for (int i = 0; i < numThreads; ++i) {
           Index_type startPlane = i * slowDim / numThreads;
@@ -147,55 +339,13 @@ void buildLockFreeBlockIndexset(RAJA::TypedIndexSet<RAJA::RangeSegment,
           Index_type start = startPlane * fastDim * midDim;
           Index_type end = endPlane * fastDim * midDim;
           Index_type len = end - start;
-          // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-          //                   start + (lane+1)*len/segmentsPerThread  );
           iset.push_back(
               RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
                                  start + (lane + 1) * len / segmentsPerThread));
         }
       }
-*/
-      /* Allocate dependency graph structures for index set segments */
-/*
-      iset.initDependencyGraph();
-
-      if (segmentsPerThread == 1) {
-*/
-        /* This dependency graph should impose serialization */
-/*
-        for (int i = 0; i < numThreads; ++i) {
-          RAJA::DepGraphNode* task = iset.getSegmentInfo(i)->getDepGraphNode();
-          task->semaphoreValue() = ((i == 0) ? 0 : 1);
-          task->semaphoreReloadValue() = ((i == 0) ? 0 : 1);
-          if (i != numThreads - 1) {
-            task->numDepTasks() = 1;
-            task->depTaskNum(0) = i + 1;
-          }
-        }
-      } else {
-*/
-        /* This dependency graph relies on omp schedule(static, 1) */
-        /* but allows a minimumal set of dependent tasks be used */
-/*
-        int borderSeg = numThreads * (segmentsPerThread - 1);
-        for (int i = 1; i < numThreads; ++i) {
-          RAJA::DepGraphNode* task = iset.getSegmentInfo(i)->getDepGraphNode();
-          task->semaphoreReloadValue() = 1;
-          task->numDepTasks() = 1;
-          task->depTaskNum(0) = borderSeg + i - 1;
-
-          RAJA::DepGraphNode* border_task =
-              iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-          border_task->semaphoreValue() = 1;
-          border_task->semaphoreReloadValue() = 1;
-          border_task->numDepTasks() = 1;
-          border_task->depTaskNum(0) = i;
-        }
-      }
-
-      iset.finalizeDependencyGraph();
+      buildLaneDependencyGraph(iset, numThreads, segmentsPerThread);
     }
-*/
   }
 
   /* Print the dependency schedule for segments */
@@ -206,15 +356,16 @@ void buildLockFreeBlockIndexset(RAJA::TypedIndexSet<RAJA::RangeSegment,
  ******************************************************************************
  *
  * Build Lock-free "color" index set. The domain-set is colored based on
- * connectivity to the range-set.  All elements in each segment are
- * independent, and no two segments can be executed in parallel.
+ * connectivity to the range-set.  All elements in each color are
+ * independent. Each color is split into segments, and each segment depends
+ * on the segments of earlier colors that share range entities with it.
  *
  * Note: Method assumes IndexSet ptr refers to an empty index set.
  *
  ******************************************************************************
  */
-void buildLockFreeColorIndexset(RAJA::TypedIndexSet<RAJA::RangeSegment,
-                                RAJA::ListSegment, RAJA::RangeStrideSegment>& iset,
+
+void buildLockFreeColorIndexset(LockFreeIndexSet& iset,
                                 Index_type const* domainToRange,
                                 int numEntity,
                                 int numRangePerDomain,
@@ -296,50 +447,393 @@ void buildLockFreeColorIndexset(RAJA::TypedIndexSet<RAJA::RangeSegment,
     exit(-1);
   }
 
-  /* we may want to create a permutation array here */
-  if (elemPermutation != 0l) {
-    /* send back permutaion array, and corresponding range segments */
-
-    memcpy(elemPermutation, &workset[0], numEntity * sizeof(int));
-    if (ielemPermutation != 0l) {
-      for (int i = 0; i < numEntity; ++i) {
-        ielemPermutation[elemPermutation[i]] = i;
+  std::vector<Index_type> chunkDelim = pushColorSegments(iset,
+                                                         workset,
+                                                         worksetDelim,
+                                                         numWorkset,
+                                                         numEntity,
+                                                         elemPermutation,
+                                                         ielemPermutation);
+  int numChunks = static_cast<int>(chunkDelim.size());
+
+  /*
+   * Elements of one color share no range entities, so the chunks touching
+   * a range entity are ordered by color. Each chunk depends on the last
+   * earlier chunk touching each of its range entities.
+   */
+  iset.initDependencyGraph();
+
+  std::vector<int> lastChunk(numEntityRange, -1);
+  std::vector<int> preds;
+  Index_type end = 0;
+  for (int i = 0; i < numChunks; ++i) {
+    Index_type begin = end;
+    end = chunkDelim[i];
+
+    preds.clear();
+    for (Index_type j = begin; j < end; ++j) {
+      Index_type elem = workset[j];
+      for (int k = 0; k < numRangePerDomain; ++k) {
+        Index_type id = domainToRange[elem * numRangePerDomain + k];
+        if (lastChunk[id] >= 0 && lastChunk[id] != i) {
+          preds.push_back(lastChunk[id]);
+        }
+        lastChunk[id] = i;
       }
     }
-    Index_type end = 0;
-    for (int i = 0; i < numWorkset; ++i) {
-      Index_type begin = end;
-      end = worksetDelim[i];
-      iset.push_back(RAJA::RangeSegment(begin, end));
+
+    std::sort(preds.begin(), preds.end());
+    preds.erase(std::unique(preds.begin(), preds.end()), preds.end());
+    for (int pred : preds) {
+      iset.getDepGraphNode(pred)->addDepTask(i);
     }
-  } else {
-    Index_type end = 0;
-    for (int i = 0; i < numWorkset; ++i) {
-      Index_type begin = end;
-      end = worksetDelim[i];
-      bool isRange = true;
-      for (int j = begin + 1; j < end; ++j) {
-        if (workset[j - 1] + 1 != workset[j]) {
-          isRange = false;
-          break;
+    iset.getDepGraphNode(i)->semaphoreReloadValue() =
+        static_cast<int>(preds.size());
+  }
+
+  iset.finalizeDependencyGraph();
+
+  delete[] isMarked;
+  delete[] worksetDelim;
+  delete[] workset;
+}
+
+/*
+ ******************************************************************************
+ *
+ * Build Lock-free "color" index set in parallel.
+ *
+ * Elements are colored speculatively in rounds. The uncolored elements are
+ * split into blocks of color_block_size consecutive elements, and each
+ * block is colored greedily in element order by one thread, seeing the
+ * colors from earlier rounds and those of its own block; an element takes
+ * the color least used so far in its block that none of its neighbors has,
+ * and a new color only if there is none. Neighbors in different blocks may
+ * then have the same color; the one with the larger index is uncolored
+ * again for the next round. The blocks do not depend on the number of
+ * threads, and neither do the colors.
+ *
+ * The colors are then balanced. In each round, some elements of each color
+ * larger than the mean, chosen by a pseudo-random priority, pick a color
+ * below the mean that none of their neighbors has; those going before all
+ * of their neighbors that picked the same color move, in element order, as
+ * long as the colors stay on their side of the mean. Balancing stops once
+ * no color exceeds the mean by more than 1/color_balance_tolerance.
+ *
+ * The elements are sorted by color, keeping element order within a color,
+ * and the segments and dependency graph are built as by
+ * buildLockFreeColorIndexset, with the predecessors of each chunk found in
+ * parallel.
+ *
+ ******************************************************************************
+ */
+void buildLockFreeColorIndexsetParallel(LockFreeIndexSet& iset,
+                                        Index_type const* domainToRange,
+                                        int numEntity,
+                                        int numRangePerDomain,
+                                        int numEntityRange,
+                                        Index_type* elemPermutation,
+                                        Index_type* ielemPermutation)
+{
+  const ColorConflictGraph graph(domainToRange,
+                                 numEntity,
+                                 numRangePerDomain,
+                                 numEntityRange);
+
+  /* speculative coloring */
+  std::vector<int> color(numEntity, -1);
+  std::vector<int> tentative(numEntity, -1);
+  std::vector<Index_type> work(numEntity);
+  for (int e = 0; e < numEntity; ++e) {
+    work[e] = e;
+  }
+  std::vector<Index_type> workBlocks;
+  std::vector<char> conflict;
+  const Index_type maxColors = graph.maxNeighbors + 1;
+
+  while (!work.empty()) {
+    const Index_type numWork = work.size();
+
+    workBlocks.clear();
+    for (Index_type u = 0; u < numWork; ++u) {
+      if (u == 0
+          || work[u] / color_block_size != work[u - 1] / color_block_size) {
+        workBlocks.push_back(u);
+      }
+    }
+    workBlocks.push_back(numWork);
+    const Index_type numBlocks = workBlocks.size() - 1;
+
+#pragma omp parallel
+    {
+      std::vector<Index_type> forbidden(maxColors, -1);
+      std::vector<Index_type> used(maxColors);
+
+#pragma omp for schedule(dynamic, 1)
+      for (Index_type b = 0; b < numBlocks; ++b) {
+        std::fill(used.begin(), used.end(), 0);
+        int numUsed = 0;
+        for (Index_type u = workBlocks[b]; u < workBlocks[b + 1]; ++u) {
+          const Index_type e = work[u];
+          graph.forEachNeighbor(e, [&](Index_type nbr) {
+            if (color[nbr] >= 0) {
+              forbidden[color[nbr]] = e;
+            } else if (nbr < e
+                       && nbr / color_block_size == e / color_block_size) {
+              forbidden[tentative[nbr]] = e;
+            }
+            return true;
+          });
+          int c = -1;
+          for (int k = 0; k < numUsed; ++k) {
+            if (forbidden[k] != e && (c < 0 || used[k] < used[c])) {
+              c = k;
+            }
+          }
+          if (c < 0) {
+            c = 0;
+            while (forbidden[c] == e) {
+              ++c;
+            }
+            numUsed = std::max(numUsed, c + 1);
+          }
+          ++used[c];
+          tentative[e] = c;
         }
       }
-      if (isRange) {
-        iset.push_back(
-            RAJA::RangeSegment(workset[begin], workset[end - 1] + 1));
+    }
+
+    conflict.assign(numWork, 0);
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (Index_type u = 0; u < numWork; ++u) {
+      const Index_type e = work[u];
+      graph.forEachNeighbor(e, [&](Index_type nbr) {
+        conflict[u] = nbr < e && color[nbr] < 0
+                      && tentative[nbr] == tentative[e]
+                      && nbr / color_block_size != e / color_block_size;
+        return !conflict[u];
+      });
+    }
+
+    Index_type numLeft = 0;
+    for (Index_type u = 0; u < numWork; ++u) {
+      if (conflict[u]) {
+        work[numLeft++] = work[u];
       } else {
-        iset.push_back(RAJA::ListSegment(&workset[begin], end - begin));
-        // printf("segment %d\n", i) ;
-        // for (int j=begin; j<end; ++j) {
-        //    printf("%d\n", workset[j]) ;
-        // }
+        color[work[u]] = tentative[work[u]];
       }
     }
+    work.resize(numLeft);
   }
 
-  delete[] isMarked;
-  delete[] worksetDelim;
-  delete[] workset;
+  int numColors = 0;
+  for (int c : color) {
+    numColors = std::max(numColors, c + 1);
+  }
+
+  /* balance the color sizes */
+  std::vector<Index_type> colorSize(numColors, 0);
+  for (int c : color) {
+    ++colorSize[c];
+  }
+  const Index_type target =
+      numColors > 0 ? (numEntity + numColors - 1) / numColors : 0;
+
+  const int numThreads = getMaxOMPThreadsCPU();
+  const int numChunks = std::max(1, std::min(numThreads, numEntity));
+  std::vector<std::vector<std::pair<Index_type, int>>> moves(numChunks);
+  std::vector<int> wanted(numEntity, -1);
+
+  for (int round = 0; round < color_balance_max_rounds; ++round) {
+    if (numColors == 0
+        || *std::max_element(colorSize.begin(), colorSize.end())
+               <= target + target / color_balance_tolerance) {
+      break;
+    }
+
+#pragma omp parallel
+    {
+      std::vector<Index_type> forbidden(numColors, -1);
+
+#pragma omp for schedule(dynamic, 1024)
+      for (int e = 0; e < numEntity; ++e) {
+        wanted[e] = -1;
+        /* about four times the excess of a color are candidates to move */
+        const Index_type size = colorSize[color[e]];
+        if (size <= target
+            || colorPriority(e) % size
+                   >= static_cast<std::uint64_t>(4 * (size - target))) {
+          continue;
+        }
+        graph.forEachNeighbor(e, [&](Index_type nbr) {
+          forbidden[color[nbr]] = e;
+          return true;
+        });
+        /* spread the candidates over the small colors */
+        const int first = static_cast<int>(colorPriority(e) % numColors);
+        for (int k = 0; k < numColors; ++k) {
+          const int c = (first + k) % numColors;
+          if (colorSize[c] < target && forbidden[c] != e) {
+            wanted[e] = c;
+            break;
+          }
+        }
+      }
+    }
+
+#pragma omp parallel for schedule(static, 1)
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+      moves[chunk].clear();
+      const int begin =
+          static_cast<int>(static_cast<Index_type>(numEntity) * chunk
+                           / numChunks);
+      const int end =
+          static_cast<int>(static_cast<Index_type>(numEntity) * (chunk + 1)
+                           / numChunks);
+      for (int e = begin; e < end; ++e) {
+        if (wanted[e] < 0) continue;
+        bool first = true;
+        graph.forEachNeighbor(e, [&](Index_type nbr) {
+          first = wanted[nbr] != wanted[e] || colorMovesBefore(e, nbr);
+          return first;
+        });
+        if (first) {
+          moves[chunk].push_back(std::make_pair(e, wanted[e]));
+        }
+      }
+    }
+
+    Index_type numMoved = 0;
+    for (const auto& chunkMoves : moves) {
+      for (const auto& move : chunkMoves) {
+        const int from = color[move.first];
+        if (colorSize[from] > target && colorSize[move.second] < target) {
+          color[move.first] = move.second;
+          --colorSize[from];
+          ++colorSize[move.second];
+          ++numMoved;
+        }
+      }
+    }
+    if (numMoved == 0) break;
+  }
+
+  /* sort the elements by color, in element order within a color */
+  std::vector<Index_type> chunkCount(
+      static_cast<size_t>(numChunks) * numColors, 0);
+#pragma omp parallel for schedule(static, 1)
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    Index_type* count =
+        chunkCount.data() + static_cast<size_t>(chunk) * numColors;
+    const int begin =
+        static_cast<int>(static_cast<Index_type>(numEntity) * chunk
+                         / numChunks);
+    const int end =
+        static_cast<int>(static_cast<Index_type>(numEntity) * (chunk + 1)
+                         / numChunks);
+    for (int e = begin; e < end; ++e) {
+      ++count[color[e]];
+    }
+  }
+
+  std::vector<Index_type> colorDelim(numColors);
+  Index_type offset = 0;
+  for (int c = 0; c < numColors; ++c) {
+    for (int chunk = 0; chunk < numChunks; ++chunk) {
+      Index_type& count =
+          chunkCount[static_cast<size_t>(chunk) * numColors + c];
+      const Index_type n = count;
+      count = offset;
+      offset += n;
+    }
+    colorDelim[c] = offset;
+  }
+
+  std::vector<Index_type> workset(numEntity);
+#pragma omp parallel for schedule(static, 1)
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    Index_type* next =
+        chunkCount.data() + static_cast<size_t>(chunk) * numColors;
+    const int begin =
+        static_cast<int>(static_cast<Index_type>(numEntity) * chunk
+                         / numChunks);
+    const int end =
+        static_cast<int>(static_cast<Index_type>(numEntity) * (chunk + 1)
+                         / numChunks);
+    for (int e = begin; e < end; ++e) {
+      workset[next[color[e]]++] = e;
+    }
+  }
+
+  std::vector<Index_type> chunkDelim = pushColorSegments(iset,
+                                                         workset.data(),
+                                                         colorDelim.data(),
+                                                         numColors,
+                                                         numEntity,
+                                                         elemPermutation,
+                                                         ielemPermutation);
+  const int numSegments = static_cast<int>(chunkDelim.size());
+
+  /*
+   * Each chunk depends on the last earlier chunk touching each of its range
+   * entities, as in buildLockFreeColorIndexset.
+   */
+  std::vector<int> segmentOf(numEntity);
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int seg = 0; seg < numSegments; ++seg) {
+    const Index_type begin = seg > 0 ? chunkDelim[seg - 1] : 0;
+    for (Index_type j = begin; j < chunkDelim[seg]; ++j) {
+      segmentOf[workset[j]] = seg;
+    }
+  }
+
+  /* the segments touching each range entity, in order */
+  std::vector<int> rangeSegments(graph.rangeToDomain.size());
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (int r = 0; r < numEntityRange; ++r) {
+    for (Index_type n = graph.rangeBegin[r]; n < graph.rangeBegin[r + 1];
+         ++n) {
+      rangeSegments[n] = segmentOf[graph.rangeToDomain[n]];
+    }
+    std::sort(rangeSegments.begin() + graph.rangeBegin[r],
+              rangeSegments.begin() + graph.rangeBegin[r + 1]);
+  }
+
+  std::vector<std::vector<int>> preds(numSegments);
+#pragma omp parallel
+  {
+    std::vector<int> seen(numSegments, -1);
+
+#pragma omp for schedule(dynamic, 1)
+    for (int seg = 0; seg < numSegments; ++seg) {
+      const Index_type begin = seg > 0 ? chunkDelim[seg - 1] : 0;
+      for (Index_type j = begin; j < chunkDelim[seg]; ++j) {
+        const Index_type elem = workset[j];
+        for (int k = 0; k < numRangePerDomain; ++k) {
+          const Index_type id = domainToRange[elem * numRangePerDomain + k];
+          const int* first = &rangeSegments[graph.rangeBegin[id]];
+          const int* last = first + (graph.rangeBegin[id + 1]
+                                     - graph.rangeBegin[id]);
+          const int* pos = std::lower_bound(first, last, seg);
+          if (pos != first && seen[pos[-1]] != seg) {
+            seen[pos[-1]] = seg;
+            preds[seg].push_back(pos[-1]);
+          }
+        }
+      }
+      std::sort(preds[seg].begin(), preds[seg].end());
+    }
+  }
+
+  iset.initDependencyGraph();
+  for (int seg = 0; seg < numSegments; ++seg) {
+    for (int pred : preds[seg]) {
+      iset.getDepGraphNode(pred)->addDepTask(seg);
+    }
+    iset.getDepGraphNode(seg)->semaphoreReloadValue() =
+        static_cast<int>(preds[seg].size());
+  }
+  iset.finalizeDependencyGraph();
 }
 
 }  // closing brace for RAJA namespace
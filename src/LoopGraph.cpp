@@ -0,0 +1,175 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for recorded loop graphs.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/pattern/graph.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+
+namespace RAJA
+{
+
+LoopGraph::NodeRef LoopGraph::addNode(detail::LoopGraphNodeBase* node)
+{
+  m_nodes.emplace_back(node);
+  m_accesses.emplace_back();
+  m_finalized = false;
+  return NodeRef(this, getNumNodes() - 1);
+}
+
+void LoopGraph::addAccess(int node, const void* ptr, bool write)
+{
+  m_accesses[node].push_back(Access{ptr, write});
+  m_finalized = false;
+}
+
+void LoopGraph::addEdge(int from, int to)
+{
+  if (from < 0 || from == to) return;
+
+  DepGraphNode& dep_node = m_dep_nodes[from];
+  for (int d = 0; d < dep_node.numDepTasks(); ++d) {
+    if (dep_node.depTaskNum(d) == to) return;
+  }
+  dep_node.addDepTask(to);
+  m_dep_nodes[to].semaphoreReloadValue()++;
+}
+
+/*
+*************************************************************************
+*
+* Dependencies follow the declared accesses of each launch in recorded
+* order: a launch depends on the last earlier launch writing any of its
+* data and, for data it writes, on the launches that read it since then.
+* A launch declaring no accesses depends on everything since the previous
+* such launch and everything after it depends on it. Edges implied by
+* others are mostly, but not always, left out.
+*
+* Phases are then assigned greedily in recorded order; a new phase starts
+* at the first launch depending on a launch of the current phase.
+*
+*************************************************************************
+*/
+void LoopGraph::finalize()
+{
+  if (m_finalized) return;
+
+  const int num_nodes = getNumNodes();
+  m_dep_nodes.assign(num_nodes, DepGraphNode());
+
+  struct DataState {
+    int last_writer = -1;
+    std::vector<int> readers;
+  };
+  std::unordered_map<const void*, DataState> data;
+
+  int barrier = -1;
+  std::vector<int> since_barrier;
+
+  for (int j = 0; j < num_nodes; ++j) {
+    addEdge(barrier, j);
+
+    if (m_accesses[j].empty()) {
+      // the others reach j through their successors
+      for (int i : since_barrier) {
+        if (m_dep_nodes[i].numDepTasks() == 0) addEdge(i, j);
+      }
+      since_barrier.clear();
+      data.clear();
+      barrier = j;
+      continue;
+    }
+
+    for (const Access& access : m_accesses[j]) {
+      DataState& state = data[access.ptr];
+      addEdge(state.last_writer, j);
+      if (access.write) {
+        for (int i : state.readers) {
+          addEdge(i, j);
+        }
+        state.readers.clear();
+        state.last_writer = j;
+      } else {
+        state.readers.push_back(j);
+      }
+    }
+    since_barrier.push_back(j);
+  }
+
+  // latest phase among the predecessors of each node
+  std::vector<int> pred_phase(num_nodes, -1);
+  m_phase.assign(num_nodes, 0);
+  int phase = 0;
+  for (int j = 0; j < num_nodes; ++j) {
+    if (pred_phase[j] == phase) ++phase;
+    m_phase[j] = phase;
+
+    const DepGraphNode& dep_node = m_dep_nodes[j];
+    for (int d = 0; d < dep_node.numDepTasks(); ++d) {
+      int& p = pred_phase[dep_node.depTaskNum(d)];
+      p = std::max(p, phase);
+    }
+  }
+  m_num_phases = num_nodes > 0 ? phase + 1 : 0;
+
+  m_finalized = true;
+}
+
+void LoopGraph::replay() const
+{
+  for (const auto& node : m_nodes) {
+    node->execute();
+  }
+}
+
+void LoopGraph::clear()
+{
+  m_nodes.clear();
+  m_accesses.clear();
+  m_dep_nodes.clear();
+  m_phase.clear();
+  m_num_phases = 0;
+  m_finalized = true;
+}
+
+void LoopGraph::print(std::ostream& os) const
+{
+  os << "LoopGraph : num nodes = " << m_nodes.size();
+  if (m_finalized) os << " , num phases = " << m_num_phases;
+  os << std::endl;
+
+  for (int j = 0; j < getNumNodes(); ++j) {
+    os << "  node " << j << " : length = " << m_nodes[j]->length();
+    if (m_finalized) {
+      os << " , phase = " << m_phase[j] << std::endl << "    ";
+      m_dep_nodes[j].print(os);
+    } else {
+      os << std::endl;
+    }
+  }
+}
+
+}  // closing brace for RAJA namespace
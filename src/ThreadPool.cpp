@@ -0,0 +1,312 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the persistent std::thread pool used by
+ *          the RAJA threads back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREADS)
+
+#include "RAJA/policy/threads/ThreadPool.hpp"
+
+#include <cstdlib>
+#include <utility>
+
+namespace RAJA
+{
+
+namespace threads
+{
+
+namespace
+{
+
+//! Pool thread id of the calling thread, valid during a launch.
+thread_local int tl_thread_id = 0;
+
+//! Whether the calling thread is executing a pool launch.
+thread_local bool tl_in_launch = false;
+
+//! Number of polls of the launch counter before a worker goes to sleep.
+const int s_spin_count = 4096;
+
+}  // end anonymous namespace
+
+/*
+*************************************************************************
+*
+* WorkStealingDeque methods.
+*
+*************************************************************************
+*/
+void WorkStealingDeque::fill(Index_type first, Index_type last)
+{
+  const Index_type count = last - first;
+  if (count > m_capacity) {
+    m_buffer.reset(new std::atomic<Index_type>[count]);
+    m_capacity = count;
+  }
+
+  // The owner pops from the bottom, so store in reverse to have it walk
+  // its chunks front to back; thieves take from the far end of the block.
+  for (Index_type k = 0; k < count; ++k) {
+    m_buffer[k].store(last - 1 - k, std::memory_order_relaxed);
+  }
+  m_top.store(0, std::memory_order_relaxed);
+  m_bottom.store(count, std::memory_order_relaxed);
+}
+
+bool WorkStealingDeque::pop(Index_type& chunk)
+{
+  const Index_type b = m_bottom.load(std::memory_order_relaxed) - 1;
+  m_bottom.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  Index_type t = m_top.load(std::memory_order_relaxed);
+
+  if (t > b) {
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return false;
+  }
+
+  chunk = m_buffer[b].load(std::memory_order_relaxed);
+  if (t == b) {
+    // last element: race against thieves for it
+    const bool won = m_top.compare_exchange_strong(t,
+                                                   t + 1,
+                                                   std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+WorkStealingDeque::StealResult WorkStealingDeque::steal(Index_type& chunk)
+{
+  Index_type t = m_top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const Index_type b = m_bottom.load(std::memory_order_acquire);
+
+  if (t >= b) {
+    return StealResult::empty;
+  }
+
+  chunk = m_buffer[t].load(std::memory_order_relaxed);
+  if (!m_top.compare_exchange_strong(t,
+                                     t + 1,
+                                     std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+    return StealResult::abort;
+  }
+  return StealResult::success;
+}
+
+/*
+*************************************************************************
+*
+* ThreadPool methods.
+*
+*************************************************************************
+*/
+ThreadPool& ThreadPool::getInstance()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::ThreadPool()
+    : m_num_threads(1),
+      m_generation(0),
+      m_pending(0),
+      m_shutdown(false),
+      m_task(nullptr),
+      m_data(nullptr)
+{
+  const char* env = std::getenv("RAJA_NUM_THREADS");
+  int nthreads = env ? std::atoi(env) : 0;
+  if (nthreads <= 0) {
+    nthreads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  m_num_threads = (nthreads > 0) ? nthreads : 1;
+
+  m_deques.reset(new WorkStealingDeque[m_num_threads]);
+
+  m_workers.reserve(m_num_threads - 1);
+  for (int tid = 1; tid < m_num_threads; ++tid) {
+    m_workers.emplace_back(&ThreadPool::workerLoop, this, tid);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+  }
+  m_wake.notify_all();
+
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+}
+
+int ThreadPool::getThreadId() { return tl_thread_id; }
+
+bool ThreadPool::inParallelRegion() { return tl_in_launch; }
+
+void ThreadPool::launch(task_fn fn, void* data, Index_type num_chunks)
+{
+  std::lock_guard<std::mutex> launch_lock(m_launch_mutex);
+
+  // Workers are asleep or spinning on m_generation here, so the deques
+  // can be refilled without synchronizing with thieves.
+  if (num_chunks > 0) {
+    const Index_type chunk = num_chunks / m_num_threads;
+    const Index_type rem = num_chunks % m_num_threads;
+    for (int tid = 0; tid < m_num_threads; ++tid) {
+      const Index_type first = tid * chunk + (tid < rem ? tid : rem);
+      m_deques[tid].fill(first, first + chunk + (tid < rem ? 1 : 0));
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task = fn;
+    m_data = data;
+    m_exception = nullptr;
+    m_pending.store(m_num_threads - 1, std::memory_order_relaxed);
+    m_generation.fetch_add(1, std::memory_order_release);
+  }
+  m_wake.notify_all();
+
+  // Leave the launch and join the workers however fn exits, so that no
+  // worker is still using data when it goes out of scope in the caller.
+  struct Join {
+    ThreadPool& pool;
+    ~Join()
+    {
+      tl_in_launch = false;
+      pool.waitForWorkers();
+    }
+  };
+
+  {
+    Join join{*this};
+    tl_in_launch = true;
+    tl_thread_id = 0;
+    fn(data, 0);
+  }
+
+  std::exception_ptr worker_exception;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(worker_exception, m_exception);
+  }
+  if (worker_exception) {
+    std::rethrow_exception(worker_exception);
+  }
+}
+
+void ThreadPool::waitForWorkers()
+{
+  for (int spin = 0; spin < s_spin_count; ++spin) {
+    if (m_pending.load(std::memory_order_acquire) == 0) return;
+  }
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [this] {
+    return m_pending.load(std::memory_order_acquire) == 0;
+  });
+}
+
+bool ThreadPool::nextChunk(int tid, Index_type& chunk)
+{
+  if (m_deques[tid].pop(chunk)) return true;
+
+  // No chunks are created during a launch, so once every victim has been
+  // seen empty (and no steal was lost to a race) the launch is drained.
+  bool retry = true;
+  while (retry) {
+    retry = false;
+    for (int k = 1; k < m_num_threads; ++k) {
+      const int victim = (tid + k) % m_num_threads;
+      switch (m_deques[victim].steal(chunk)) {
+        case WorkStealingDeque::StealResult::success:
+          return true;
+        case WorkStealingDeque::StealResult::abort:
+          retry = true;
+          break;
+        case WorkStealingDeque::StealResult::empty:
+          break;
+      }
+    }
+  }
+  return false;
+}
+
+void ThreadPool::workerLoop(int tid)
+{
+  tl_thread_id = tid;
+  unsigned long seen = 0;
+
+  while (true) {
+    for (int spin = 0; spin < s_spin_count; ++spin) {
+      if (m_generation.load(std::memory_order_acquire) != seen) break;
+    }
+
+    task_fn task;
+    void* data;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [this, seen] {
+        return m_shutdown
+               || m_generation.load(std::memory_order_relaxed) != seen;
+      });
+      if (m_shutdown) return;
+      seen = m_generation.load(std::memory_order_relaxed);
+      task = m_task;
+      data = m_data;
+    }
+
+    tl_in_launch = true;
+    try {
+      task(data, tid);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_exception) m_exception = std::current_exception();
+    }
+    tl_in_launch = false;
+
+    if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_done.notify_one();
+    }
+  }
+}
+
+}  // closing brace for threads namespace
+
+}  // closing brace for RAJA namespace
+
+#endif  // if defined(RAJA_ENABLE_THREADS)
@@ -0,0 +1,106 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for NUMA-aware first-touch allocation.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/first_touch.hpp"
+
+#if defined(RAJA_ENABLE_NUMA)
+#include <numa.h>
+#include <numaif.h>
+#include <sched.h>
+#endif
+
+#if defined(RAJA_PLATFORM_WINDOWS)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+size_t getPageSize()
+{
+#if defined(RAJA_PLATFORM_WINDOWS)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return static_cast<size_t>(info.dwPageSize);
+#else
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+#endif
+}
+
+int getCurrentNumaNode()
+{
+#if defined(RAJA_ENABLE_NUMA)
+  static const bool available = numa_available() != -1;
+  if (!available) return -1;
+
+  const int cpu = sched_getcpu();
+  return cpu < 0 ? -1 : numa_node_of_cpu(cpu);
+#else
+  return -1;
+#endif
+}
+
+void movePagesToNodes(void* ptr, size_t bytes, const std::vector<int>& nodes)
+{
+#if defined(RAJA_ENABLE_NUMA)
+  if (numa_available() == -1 || numa_max_node() == 0) return;
+
+  const size_t page_size = getPageSize();
+  char* base = static_cast<char*>(ptr);
+
+  std::vector<void*> pages;
+  std::vector<int> targets;
+  for (size_t p = 0; p < nodes.size() && p * page_size < bytes; ++p) {
+    if (nodes[p] < 0) continue;
+    pages.push_back(base + p * page_size);
+    targets.push_back(nodes[p]);
+  }
+  if (pages.empty()) return;
+
+  // pages already on their target node are left alone by the kernel; a
+  // failure only costs locality, so the result is not checked
+  std::vector<int> status(pages.size());
+  numa_move_pages(0,
+                  pages.size(),
+                  pages.data(),
+                  targets.data(),
+                  status.data(),
+                  MPOL_MF_MOVE);
+#else
+  (void)ptr;
+  (void)bytes;
+  (void)nodes;
+#endif
+}
+
+}  // end namespace detail
+
+}  // end namespace RAJA
@@ -0,0 +1,232 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the RAJA instrumentation interface.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/instrument.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace instrument
+{
+
+namespace
+{
+
+using listener_list = std::vector<Listener*>;
+
+//! Serializes changes to s_listeners.
+std::mutex s_listener_mutex;
+
+//! Registered listeners; replaced, never modified, so events need no lock.
+std::shared_ptr<const listener_list> s_listeners;
+
+//! Innermost label on this thread.
+thread_local const char* tl_label = nullptr;
+
+}  // end anonymous namespace
+
+namespace detail
+{
+
+std::atomic<int> s_num_listeners{0};
+
+void fireLaunch(bool post, const LaunchInfo& info)
+{
+  std::shared_ptr<const listener_list> listeners =
+      std::atomic_load(&s_listeners);
+  if (!listeners) return;
+
+  for (Listener* listener : *listeners) {
+    if (post) {
+      listener->postLaunch(info);
+    } else {
+      listener->preLaunch(info);
+    }
+  }
+}
+
+std::string parseTypeName(const char* signature, const char* fallback)
+{
+  // GCC:   "... getTypeName() [with T = <name>]"
+  // Clang: "... getTypeName() [T = <name>]"
+  const char* first = std::strstr(signature, "T = ");
+  if (first == nullptr) return fallback;
+  first += 4;
+
+  // stop at the closing bracket of the signature, or GCC's "; ..." suffix
+  // for typedefs, skipping brackets that belong to the type itself
+  int depth = 0;
+  const char* last = first;
+  for (; *last != '\0'; ++last) {
+    if (*last == '[' || *last == '<' || *last == '(') {
+      ++depth;
+    } else if (*last == ')' || *last == '>') {
+      --depth;
+    } else if (*last == ']') {
+      if (depth == 0) break;
+      --depth;
+    } else if (*last == ';' && depth == 0) {
+      break;
+    }
+  }
+  return std::string(first, last);
+}
+
+}  // end namespace detail
+
+const char* getPatternName(Pattern pattern)
+{
+  switch (pattern) {
+    case Pattern::forall:
+      return "forall";
+    case Pattern::kernel:
+      return "kernel";
+    case Pattern::scan:
+      return "scan";
+    case Pattern::sort:
+      return "sort";
+    case Pattern::reduce:
+      return "reduce";
+    case Pattern::histogram:
+      return "histogram";
+  }
+  return "unknown";
+}
+
+Listener::~Listener() {}
+
+void addListener(Listener* listener)
+{
+  std::lock_guard<std::mutex> lock(s_listener_mutex);
+
+  std::shared_ptr<listener_list> listeners =
+      s_listeners ? std::make_shared<listener_list>(*s_listeners)
+                  : std::make_shared<listener_list>();
+  listeners->push_back(listener);
+
+  std::atomic_store(&s_listeners,
+                    std::shared_ptr<const listener_list>(listeners));
+  detail::s_num_listeners.store(static_cast<int>(listeners->size()));
+}
+
+void removeListener(Listener* listener)
+{
+  std::lock_guard<std::mutex> lock(s_listener_mutex);
+
+  if (!s_listeners) return;
+
+  std::shared_ptr<listener_list> listeners =
+      std::make_shared<listener_list>(*s_listeners);
+  listeners->erase(std::remove(listeners->begin(), listeners->end(), listener),
+                   listeners->end());
+
+  std::atomic_store(&s_listeners,
+                    std::shared_ptr<const listener_list>(listeners));
+  detail::s_num_listeners.store(static_cast<int>(listeners->size()));
+}
+
+const char* getLabel() { return tl_label; }
+
+#if defined(RAJA_ENABLE_INSTRUMENTATION)
+ScopedLabel::ScopedLabel(const char* label) : m_previous(tl_label)
+{
+  tl_label = label;
+}
+
+ScopedLabel::~ScopedLabel() { tl_label = m_previous; }
+#endif
+
+/*
+*************************************************************************
+*
+* Profiler methods.
+*
+*************************************************************************
+*/
+void Profiler::postLaunch(const LaunchInfo& info)
+{
+  Key key(info.label ? info.label : "",
+          getPatternName(info.pattern),
+          info.policy);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  Record& record = m_records[key];
+  record.num_calls += 1;
+  record.num_iterations += info.num_iterations;
+  record.elapsed += info.elapsed;
+}
+
+std::map<Profiler::Key, Profiler::Record> Profiler::getRecords() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  return m_records;
+}
+
+void Profiler::report(std::ostream& os) const
+{
+  std::map<Key, Record> records = getRecords();
+
+  os << std::left << std::setw(24) << "label" << std::setw(8) << "pattern"
+     << std::right << std::setw(10) << "calls" << std::setw(14) << "time (s)"
+     << std::setw(14) << "iter/s"
+     << "  policy\n";
+
+  for (const auto& entry : records) {
+    const std::string& label = std::get<0>(entry.first);
+    const Record& record = entry.second;
+
+    os << std::left << std::setw(24) << (label.empty() ? "-" : label)
+       << std::setw(8) << std::get<1>(entry.first) << std::right
+       << std::setw(10) << record.num_calls << std::setw(14)
+       << std::scientific << std::setprecision(4) << record.elapsed
+       << std::setw(14);
+    if (record.num_iterations > 0 && record.elapsed > 0.0) {
+      os << record.num_iterations / record.elapsed;
+    } else {
+      os << "-";
+    }
+    os << std::defaultfloat << "  " << std::get<2>(entry.first) << "\n";
+  }
+}
+
+void Profiler::reset()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_records.clear();
+}
+
+}  // end namespace instrument
+
+}  // end namespace RAJA
@@ -0,0 +1,190 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for asynchronous host launches
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#if defined(RAJA_ENABLE_THREADS)
+
+template <typename T>
+class AsyncTest : public ::testing::Test
+{
+};
+
+using AsyncTypes = ::testing::Types<RAJA::async_exec<>,
+                                    RAJA::async_exec<RAJA::seq_exec>,
+                                    RAJA::async_exec<RAJA::thread_pool_exec>
+#if defined(RAJA_ENABLE_OPENMP)
+                                    ,
+                                    RAJA::async_exec<RAJA::omp_parallel_for_exec>
+#endif
+                                    >;
+
+TYPED_TEST_CASE(AsyncTest, AsyncTypes);
+
+TYPED_TEST(AsyncTest, forall_wait)
+{
+  const RAJA::Index_type n = 10000;
+  std::vector<RAJA::Index_type> data(n, 0);
+  RAJA::Index_type* ptr = data.data();
+
+  auto event = RAJA::forall<TypeParam>(RAJA::RangeSegment(0, n),
+                                       [=](RAJA::Index_type i) {
+                                         ptr[i] = i;
+                                       });
+  event.wait();
+  ASSERT_TRUE(event.ready());
+  ASSERT_FALSE(event.valid());
+
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(i, data[i]);
+  }
+}
+
+TYPED_TEST(AsyncTest, in_order)
+{
+  const RAJA::Index_type n = 1000;
+  std::vector<double> data(n, 1.0);
+  double* ptr = data.data();
+
+  // each launch depends on the previous one
+  std::vector<RAJA::threads::AsyncEvent> events;
+  for (int k = 0; k < 10; ++k) {
+    events.push_back(
+        RAJA::forall<TypeParam>(RAJA::RangeSegment(0, n),
+                                [=](RAJA::Index_type i) { ptr[i] *= 2.0; }));
+  }
+  RAJA::synchronize<RAJA::async_synchronize>();
+
+  for (auto& event : events) {
+    ASSERT_TRUE(event.ready());
+  }
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(1024.0, data[i]);
+  }
+}
+
+TEST(Async, overlap)
+{
+  std::atomic<bool> release(false);
+  std::atomic<bool>* flag = &release;
+
+  // the loop cannot finish until the launching thread sets the flag
+  auto event = RAJA::forall<RAJA::async_exec<RAJA::seq_exec>>(
+      RAJA::RangeSegment(0, 1), [=](RAJA::Index_type) {
+        while (!flag->load()) {
+        }
+      });
+  ASSERT_FALSE(event.ready());
+
+  release.store(true);
+  RAJA::synchronize<RAJA::async_synchronize>(event);
+  ASSERT_TRUE(event.ready());
+}
+
+TEST(Async, synchronize_events)
+{
+  std::vector<int> a(100, 0), b(100, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  auto ea = RAJA::forall<RAJA::async_exec<>>(RAJA::RangeSegment(0, 100),
+                                             [=](RAJA::Index_type i) {
+                                               pa[i] = 1;
+                                             });
+  auto eb = RAJA::forall<RAJA::async_exec<>>(RAJA::RangeSegment(0, 100),
+                                             [=](RAJA::Index_type i) {
+                                               pb[i] = 2;
+                                             });
+  RAJA::synchronize<RAJA::async_synchronize>(ea, eb);
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(1, a[i]);
+    ASSERT_EQ(2, b[i]);
+  }
+}
+
+TEST(Async, discarded_event_waits)
+{
+  std::vector<int> data(100, 0);
+  int* ptr = data.data();
+
+  RAJA::forall<RAJA::async_exec<>>(RAJA::RangeSegment(0, 100),
+                                   [=](RAJA::Index_type i) { ptr[i] = 3; });
+
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(3, data[i]);
+  }
+}
+
+TEST(Async, exception)
+{
+  auto event = RAJA::forall<RAJA::async_exec<RAJA::seq_exec>>(
+      RAJA::RangeSegment(0, 10), [=](RAJA::Index_type i) {
+        if (i == 5) throw std::runtime_error("loop failed");
+      });
+  ASSERT_THROW(event.wait(), std::runtime_error);
+}
+
+TEST(Async, nested)
+{
+  std::vector<int> data(10, 0);
+  int* ptr = data.data();
+
+  auto event = RAJA::forall<RAJA::async_exec<RAJA::seq_exec>>(
+      RAJA::RangeSegment(0, 1), [=](RAJA::Index_type) {
+        // launched from the queue thread, runs immediately
+        auto inner = RAJA::forall<RAJA::async_exec<RAJA::seq_exec>>(
+            RAJA::RangeSegment(0, 10),
+            [=](RAJA::Index_type i) { ptr[i] = 1; });
+        inner.wait();
+      });
+  event.wait();
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(1, data[i]);
+  }
+}
+
+TEST(Async, list_segment)
+{
+  std::vector<RAJA::Index_type> idx{1, 3, 5, 7};
+  std::vector<int> data(8, 0);
+  int* ptr = data.data();
+
+  RAJA::threads::AsyncEvent event;
+  {
+    // the segment is copied into the launch
+    RAJA::TypedListSegment<RAJA::Index_type> seg(idx.data(), idx.size());
+    event = RAJA::forall<RAJA::async_exec<>>(seg, [=](RAJA::Index_type i) {
+      ptr[i] = 1;
+    });
+  }
+  event.wait();
+
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_EQ(i % 2, data[i]);
+  }
+}
+
+#endif
@@ -0,0 +1,214 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for batched loop launches
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <vector>
+
+template <typename T>
+class BatchTest : public ::testing::Test
+{
+};
+
+using BatchTypes = ::testing::Types<RAJA::seq_exec,
+                                    RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                    ,
+                                    RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+                                    ,
+                                    RAJA::thread_pool_exec
+#endif
+                                    >;
+
+TYPED_TEST_CASE(BatchTest, BatchTypes);
+
+TYPED_TEST(BatchTest, heterogeneous)
+{
+  const RAJA::Index_type n = 5000;
+  std::vector<int> a(n, 0);
+  std::vector<double> b(n, 0.0);
+  int* pa = a.data();
+  double* pb = b.data();
+
+  std::vector<RAJA::Index_type> idx;
+  for (RAJA::Index_type i = 1; i < n; i += 7) {
+    idx.push_back(i);
+  }
+
+  // chunks straddle loop boundaries
+  RAJA::LoopBatch batch(100);
+  batch.add(RAJA::RangeSegment(0, 1234),
+            [=](RAJA::Index_type i) { pa[i] += 1; });
+  batch.add(RAJA::RangeSegment(50, 50),
+            [=](RAJA::Index_type i) { pa[i] += 100; });
+  batch.add(RAJA::RangeStrideSegment(1234, n, 2),
+            [=](RAJA::Index_type i) { pa[i] += 2; });
+  batch.add(RAJA::TypedListSegment<RAJA::Index_type>(idx.data(), idx.size()),
+            [=](RAJA::Index_type i) { pb[i] = 0.5 * i; });
+  batch.add(RAJA::RangeSegment(2, 5),
+            [=](RAJA::Index_type i) { pb[i] += 1.0; });
+
+  ASSERT_EQ(4u, batch.getNumLoops());
+  ASSERT_EQ(1234 + (n - 1234 + 1) / 2 + static_cast<RAJA::Index_type>(
+                                            idx.size()) + 3,
+            batch.getLength());
+
+  RAJA::forall_batch<TypeParam>(batch);
+  RAJA::forall_batch<TypeParam>(batch);
+
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    int expected = 0;
+    if (i < 1234) expected = 2;
+    if (i >= 1234 && (i - 1234) % 2 == 0) expected = 4;
+    ASSERT_EQ(expected, a[i]);
+  }
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    double expected = (i % 7 == 1) ? 0.5 * i : 0.0;
+    if (i >= 2 && i < 5) expected += 2.0;
+    ASSERT_EQ(expected, b[i]);
+  }
+}
+
+TYPED_TEST(BatchTest, many_small)
+{
+  const int num_loops = 1000;
+  std::vector<int> data(num_loops * 37, 0);
+  int* ptr = data.data();
+
+  RAJA::LoopBatch batch;
+  for (int k = 0; k < num_loops; ++k) {
+    const int len = k % 37;
+    batch.add(RAJA::RangeSegment(k * 37, k * 37 + len),
+              [=](RAJA::Index_type i) { ptr[i] = k; });
+  }
+  RAJA::forall_batch<TypeParam>(batch);
+
+  for (int k = 0; k < num_loops; ++k) {
+    for (int j = 0; j < 37; ++j) {
+      ASSERT_EQ(j < k % 37 ? k : 0, data[k * 37 + j]);
+    }
+  }
+}
+
+TEST(Batch, reduce)
+{
+  RAJA::ReduceSum<RAJA::seq_reduce, RAJA::Index_type> sum(0);
+
+  RAJA::LoopBatch batch(16);
+  batch.add(RAJA::RangeSegment(0, 100),
+            [=](RAJA::Index_type i) { sum += i; });
+  batch.add(RAJA::RangeSegment(0, 10), [=](RAJA::Index_type) { sum += 1; });
+  RAJA::forall_batch<RAJA::seq_exec>(batch);
+
+  ASSERT_EQ(4950 + 10, sum.get());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Batch, omp_reduce)
+{
+  RAJA::ReduceSum<RAJA::omp_reduce, RAJA::Index_type> sum(0);
+  RAJA::ReduceMax<RAJA::omp_reduce, RAJA::Index_type> max(-1);
+
+  RAJA::LoopBatch batch(16);
+  for (int k = 0; k < 50; ++k) {
+    batch.add(RAJA::RangeSegment(0, k), [=](RAJA::Index_type i) {
+      sum += i;
+      max.max(i);
+    });
+  }
+  RAJA::forall_batch<RAJA::omp_parallel_for_exec>(batch);
+
+  RAJA::Index_type expected = 0;
+  for (int k = 0; k < 50; ++k) {
+    expected += k * (k - 1) / 2;
+  }
+  ASSERT_EQ(expected, sum.get());
+  ASSERT_EQ(48, max.get());
+}
+#endif
+
+namespace
+{
+
+//! Loop body counting the copies made of it.
+struct CountingBody {
+  std::atomic<int>* copies;
+  int* data;
+
+  CountingBody(std::atomic<int>* copies, int* data)
+      : copies(copies), data(data)
+  {
+  }
+
+  CountingBody(const CountingBody& other)
+      : copies(other.copies), data(other.data)
+  {
+    ++*copies;
+  }
+
+  void operator()(RAJA::Index_type i) const { data[i] += 1; }
+};
+
+template <typename ExecPolicy>
+void checkBodyCopies(int max_copies_per_loop)
+{
+  const RAJA::Index_type n = 10000;
+  std::vector<int> data(2 * n, 0);
+  std::atomic<int> copies(0);
+
+  // chunks of one iteration: a copy per piece would give 2 * n copies
+  RAJA::LoopBatch batch(1);
+  batch.add(RAJA::RangeSegment(0, n), CountingBody(&copies, data.data()));
+  batch.add(RAJA::RangeSegment(n, 2 * n), CountingBody(&copies, data.data()));
+
+  copies = 0;
+  RAJA::forall_batch<ExecPolicy>(batch);
+  ASSERT_LE(copies.load(), 2 * max_copies_per_loop);
+  ASSERT_EQ(std::vector<int>(2 * n, 1), data);
+}
+
+}  // end anonymous namespace
+
+TEST(Batch, body_copies_per_thread)
+{
+  checkBodyCopies<RAJA::seq_exec>(1);
+#if defined(RAJA_ENABLE_OPENMP)
+  checkBodyCopies<RAJA::omp_parallel_for_exec>(omp_get_max_threads());
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+  checkBodyCopies<RAJA::thread_pool_exec>(
+      RAJA::threads::ThreadPool::getInstance().getNumThreads());
+#endif
+}
+
+TEST(Batch, empty)
+{
+  RAJA::LoopBatch batch;
+  RAJA::forall_batch<RAJA::seq_exec>(batch);
+  ASSERT_EQ(0, batch.getLength());
+
+  batch.add(RAJA::RangeSegment(0, 10), [=](RAJA::Index_type) {});
+  batch.clear();
+  ASSERT_EQ(0u, batch.getNumLoops());
+  ASSERT_EQ(0, batch.getNumChunks());
+}
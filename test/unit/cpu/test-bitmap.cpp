@@ -0,0 +1,279 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the bitmap segment
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// about half of [first, first + extent), with some full and empty words
+std::vector<RAJA::Index_type> activeIndices(RAJA::Index_type first,
+                                            RAJA::Index_type extent)
+{
+  std::mt19937 gen(13);
+  std::bernoulli_distribution active(0.5);
+  std::vector<RAJA::Index_type> indices;
+  for (RAJA::Index_type i = 0; i < extent; ++i) {
+    const RAJA::Index_type word = i / 64;
+    const bool in = word % 5 == 1 ? true : word % 5 == 3 ? false : active(gen);
+    if (in) {
+      indices.push_back(first + i);
+    }
+  }
+  return indices;
+}
+
+template <typename T>
+std::vector<T> iterated(const RAJA::TypedBitmapSegment<T>& seg)
+{
+  return std::vector<T>(seg.begin(), seg.end());
+}
+
+}  // end anonymous namespace
+
+TEST(BitmapSegment, construct)
+{
+  std::vector<RAJA::Index_type> indices = activeIndices(-100, 5000);
+  RAJA::BitmapSegment seg(indices);
+  ASSERT_EQ(static_cast<RAJA::Index_type>(indices.size()), seg.size());
+  ASSERT_EQ(indices, iterated(seg));
+
+  // order and repetitions of the input do not matter
+  std::vector<RAJA::Index_type> shuffled(indices);
+  shuffled.insert(shuffled.end(), indices.begin(), indices.begin() + 100);
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(2));
+  RAJA::BitmapSegment from_shuffled(shuffled.data(), shuffled.size());
+  ASSERT_EQ(indices, iterated(from_shuffled));
+  ASSERT_EQ(seg, from_shuffled);
+
+  RAJA::BitmapSegment from_pred(0, 300, [](RAJA::Index_type i) {
+    return i % 3 == 0 || i == 299;
+  });
+  std::vector<RAJA::Index_type> expected;
+  for (RAJA::Index_type i = 0; i < 300; ++i) {
+    if (i % 3 == 0 || i == 299) expected.push_back(i);
+  }
+  ASSERT_EQ(expected, iterated(from_pred));
+  ASSERT_LE(from_pred.storage_bytes(), 300 / 8 + 64);
+}
+
+TEST(BitmapSegment, int_indices)
+{
+  std::vector<int> indices = {9, 8, 7, 100, 101, 102, 103, -5, 0};
+  RAJA::TypedBitmapSegment<int> seg(indices);
+  std::vector<int> expected = {-5, 0, 7, 8, 9, 100, 101, 102, 103};
+  ASSERT_EQ(expected, iterated(seg));
+}
+
+TEST(BitmapSegment, queries)
+{
+  std::vector<RAJA::Index_type> indices = activeIndices(10, 3000);
+  RAJA::BitmapSegment seg(indices);
+
+  for (RAJA::Index_type i = 0; i < 3100; ++i) {
+    ASSERT_EQ(std::binary_search(indices.begin(), indices.end(), i),
+              seg.contains(i));
+  }
+  for (RAJA::Index_type w = 0; w <= seg.num_words(); ++w) {
+    const RAJA::Index_type count =
+        std::lower_bound(indices.begin(), indices.end(), seg.wordBase(w))
+        - indices.begin();
+    ASSERT_EQ(count, seg.countBefore(w));
+  }
+  auto it = seg.begin();
+  for (RAJA::Index_type k = 0; k < seg.size(); k += 7) {
+    ASSERT_EQ(indices[k], it[k]);
+  }
+}
+
+TEST(BitmapSegment, empty)
+{
+  std::vector<RAJA::Index_type> none;
+  RAJA::BitmapSegment seg(none);
+  ASSERT_EQ(0, seg.size());
+  ASSERT_TRUE(seg.begin() == seg.end());
+  ASSERT_FALSE(seg.contains(0));
+
+  RAJA::BitmapSegment no_match(0, 1000, [](RAJA::Index_type) {
+    return false;
+  });
+  ASSERT_EQ(0, no_match.size());
+
+  int count = 0;
+  RAJA::forall<RAJA::seq_exec>(seg, [&](RAJA::Index_type) { ++count; });
+  RAJA::forall<RAJA::seq_exec>(no_match, [&](RAJA::Index_type) { ++count; });
+  ASSERT_EQ(0, count);
+}
+
+TEST(BitmapSegment, equality_and_copies)
+{
+  std::vector<RAJA::Index_type> indices = activeIndices(0, 1000);
+  RAJA::BitmapSegment a(indices);
+  RAJA::BitmapSegment copy(a);
+  ASSERT_EQ(a, copy);
+  ASSERT_EQ(indices, iterated(copy));
+
+  indices.pop_back();
+  RAJA::BitmapSegment b(indices);
+  ASSERT_NE(a, b);
+}
+
+template <typename T>
+class BitmapForallTest : public ::testing::Test
+{
+};
+
+using BitmapPolicies = ::testing::Types<RAJA::seq_exec,
+                                        RAJA::loop_exec,
+                                        RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                        ,
+                                        RAJA::omp_parallel_for_exec,
+                                        RAJA::omp_parallel_exec<
+                                            RAJA::omp_for_nowait_exec>,
+                                        RAJA::omp_parallel_exec<
+                                            RAJA::omp_for_static<16>>,
+                                        RAJA::omp_parallel_for_static_block,
+                                        RAJA::omp_persistent_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                        ,
+                                        RAJA::tbb_for_exec,
+                                        RAJA::tbb_for_dynamic
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+                                        ,
+                                        RAJA::thread_pool_exec,
+                                        RAJA::thread_pool_dynamic<100>,
+                                        RAJA::thread_pool_static<>,
+                                        RAJA::thread_pool_static<256>
+#endif
+                                        >;
+
+TYPED_TEST_CASE(BitmapForallTest, BitmapPolicies);
+
+TYPED_TEST(BitmapForallTest, forall)
+{
+  const RAJA::Index_type extent = 20000;
+  std::vector<RAJA::Index_type> indices = activeIndices(3, extent);
+  RAJA::BitmapSegment seg(indices);
+
+  std::vector<int> visits(extent + 3, 0);
+  int* visit_data = visits.data();
+  RAJA::forall<TypeParam>(seg, [=](RAJA::Index_type i) { ++visit_data[i]; });
+
+  std::vector<int> expected(extent + 3, 0);
+  for (RAJA::Index_type i : indices) {
+    expected[i] = 1;
+  }
+  ASSERT_EQ(expected, visits);
+}
+
+TYPED_TEST(BitmapForallTest, indexset)
+{
+  std::vector<RAJA::Index_type> indices = activeIndices(100, 3000);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::BitmapSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 100));
+  iset.push_back(RAJA::BitmapSegment(indices));
+  ASSERT_EQ(100 + indices.size(), iset.getLength());
+
+  std::vector<int> visits(3100, 0);
+  int* visit_data = visits.data();
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, TypeParam>>(
+      iset, [=](RAJA::Index_type i) { ++visit_data[i]; });
+
+  std::vector<int> expected(3100, 0);
+  for (RAJA::Index_type i = 0; i < 100; ++i) {
+    expected[i] = 1;
+  }
+  for (RAJA::Index_type i : indices) {
+    expected[i] = 1;
+  }
+  ASSERT_EQ(expected, visits);
+}
+
+TYPED_TEST(BitmapForallTest, forall_Icount)
+{
+  std::vector<RAJA::Index_type> indices = activeIndices(0, 2000);
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::BitmapSegment> iset;
+  iset.push_back(RAJA::RangeSegment(2000, 2010));
+  iset.push_back(RAJA::BitmapSegment(indices));
+
+  std::vector<RAJA::Index_type> position(2010, -1);
+  RAJA::Index_type* position_data = position.data();
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, TypeParam>>(
+      iset, [=](RAJA::Index_type icount, RAJA::Index_type i) {
+        position_data[i] = icount;
+      });
+
+  for (RAJA::Index_type k = 0; k < 10; ++k) {
+    ASSERT_EQ(k, position[2000 + k]);
+  }
+  for (size_t k = 0; k < indices.size(); ++k) {
+    ASSERT_EQ(static_cast<RAJA::Index_type>(10 + k), position[indices[k]]);
+  }
+}
+
+TEST(BitmapSegment, reductions)
+{
+  std::vector<RAJA::Index_type> indices = activeIndices(0, 10000);
+  RAJA::BitmapSegment seg(indices);
+  RAJA::Index_type sum = 0;
+  for (RAJA::Index_type i : indices) {
+    sum += i;
+  }
+
+  RAJA::ReduceSum<RAJA::seq_reduce, RAJA::Index_type> seq_sum(0);
+  RAJA::ReduceMax<RAJA::seq_reduce, RAJA::Index_type> seq_max(-1);
+  RAJA::forall<RAJA::seq_exec>(seg, [=](RAJA::Index_type i) {
+    seq_sum += i;
+    seq_max.max(i);
+  });
+  ASSERT_EQ(sum, seq_sum.get());
+  ASSERT_EQ(indices.back(), seq_max.get());
+
+#if defined(RAJA_ENABLE_OPENMP)
+  RAJA::ReduceSum<RAJA::omp_reduce, RAJA::Index_type> omp_sum(0);
+  RAJA::ReduceMinLoc<RAJA::omp_reduce, RAJA::Index_type> omp_min(1 << 30, -1);
+  RAJA::forall<RAJA::omp_parallel_for_exec>(seg, [=](RAJA::Index_type i) {
+    omp_sum += i;
+    omp_min.minloc(i, i);
+  });
+  ASSERT_EQ(sum, omp_sum.get());
+  ASSERT_EQ(indices.front(), omp_min.get());
+  ASSERT_EQ(indices.front(), omp_min.getLoc());
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+  RAJA::ReduceSum<RAJA::thread_pool_reduce, RAJA::Index_type> pool_sum(0);
+  RAJA::ReduceMax<RAJA::thread_pool_reduce, RAJA::Index_type> pool_max(-1);
+  RAJA::forall<RAJA::thread_pool_exec>(seg, [=](RAJA::Index_type i) {
+    pool_sum += i;
+    pool_max.max(i);
+  });
+  ASSERT_EQ(sum, pool_sum.get());
+  ASSERT_EQ(indices.back(), pool_max.get());
+#endif
+}
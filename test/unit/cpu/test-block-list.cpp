@@ -0,0 +1,144 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the block list segment
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// starts of a random selection of the aligned blocks of [0, 16 * n), in
+// random order
+std::vector<RAJA::Index_type> blockStarts(RAJA::Index_type n,
+                                          RAJA::Index_type block_size)
+{
+  std::vector<RAJA::Index_type> starts;
+  for (RAJA::Index_type b = 0; b < 16 * n / block_size; b += 2) {
+    starts.push_back(b * block_size);
+  }
+  std::shuffle(starts.begin(), starts.end(), std::mt19937(7));
+  return starts;
+}
+
+}  // end anonymous namespace
+
+TEST(BlockListSegment, construct)
+{
+  std::vector<RAJA::Index_type> starts = {64, 0, 24, -8};
+  RAJA::BlockListSegment<8> seg(starts.data(), starts.size());
+  ASSERT_EQ(32, seg.size());
+  ASSERT_EQ(4, seg.num_blocks());
+
+  std::vector<RAJA::Index_type> expected;
+  for (RAJA::Index_type s : starts) {
+    for (RAJA::Index_type j = 0; j < 8; ++j) {
+      expected.push_back(s + j);
+    }
+  }
+  ASSERT_EQ(expected, std::vector<RAJA::Index_type>(seg.begin(), seg.end()));
+  ASSERT_EQ(expected[13], seg.begin()[13]);
+
+  RAJA::BlockListSegment<8> from_container(starts);
+  RAJA::BlockListSegment<8> copy(seg);
+  ASSERT_EQ(seg, from_container);
+  ASSERT_EQ(seg, copy);
+
+  starts[2] = 32;
+  ASSERT_NE(seg, RAJA::BlockListSegment<8>(starts));
+
+  std::vector<int> int_starts = {4, 12};
+  RAJA::TypedBlockListSegment<int, 4> int_seg(int_starts);
+  std::vector<int> int_expected = {4, 5, 6, 7, 12, 13, 14, 15};
+  ASSERT_EQ(int_expected, std::vector<int>(int_seg.begin(), int_seg.end()));
+}
+
+TEST(BlockListSegment, empty)
+{
+  std::vector<RAJA::Index_type> none;
+  RAJA::BlockListSegment<16> seg(none);
+  ASSERT_EQ(0, seg.size());
+  ASSERT_TRUE(seg.begin() == seg.end());
+
+  int count = 0;
+  RAJA::forall<RAJA::simd_exec>(seg, [&](RAJA::Index_type) { ++count; });
+  ASSERT_EQ(0, count);
+}
+
+template <typename T>
+class BlockListForallTest : public ::testing::Test
+{
+};
+
+using BlockListPolicies = ::testing::Types<RAJA::seq_exec,
+                                           RAJA::loop_exec,
+                                           RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                           ,
+                                           RAJA::omp_parallel_for_exec,
+                                           RAJA::omp_parallel_exec<
+                                               RAJA::omp_for_nowait_exec>,
+                                           RAJA::omp_parallel_exec<
+                                               RAJA::omp_for_static<32>>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                           ,
+                                           RAJA::tbb_for_exec
+#endif
+                                           >;
+
+TYPED_TEST_CASE(BlockListForallTest, BlockListPolicies);
+
+TYPED_TEST(BlockListForallTest, forall)
+{
+  const RAJA::Index_type n = 5000;
+  std::vector<RAJA::Index_type> starts = blockStarts(n, 16);
+  RAJA::BlockListSegment<16> seg(starts);
+
+  std::vector<int> visits(16 * n, 0);
+  int* visit_data = visits.data();
+  RAJA::forall<TypeParam>(seg, [=](RAJA::Index_type i) { ++visit_data[i]; });
+
+  for (RAJA::Index_type i = 0; i < 16 * n; ++i) {
+    ASSERT_EQ((i / 16) % 2 == 0 ? 1 : 0, visits[i]);
+  }
+}
+
+TYPED_TEST(BlockListForallTest, indexset)
+{
+  const RAJA::Index_type n = 1000;
+  std::vector<RAJA::Index_type> starts = blockStarts(n, 8);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::BlockListSegment<8>> iset;
+  iset.push_back(RAJA::RangeSegment(16 * n, 16 * n + 5));
+  iset.push_back(RAJA::BlockListSegment<8>(starts));
+  ASSERT_EQ(static_cast<size_t>(5 + 8 * starts.size()), iset.getLength());
+
+  std::vector<int> visits(16 * n + 5, 0);
+  int* visit_data = visits.data();
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, TypeParam>>(
+      iset, [=](RAJA::Index_type i) { ++visit_data[i]; });
+
+  for (RAJA::Index_type i = 0; i < 16 * n + 5; ++i) {
+    ASSERT_EQ(i >= 16 * n || (i / 8) % 2 == 0 ? 1 : 0, visits[i]);
+  }
+}
@@ -0,0 +1,237 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the compressed list segment
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// sorted indices: runs of consecutive indices with small gaps in between
+std::vector<RAJA::Index_type> sortedIndices(RAJA::Index_type n)
+{
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> run_length(1, 40);
+  std::uniform_int_distribution<int> gap(2, 9);
+  std::vector<RAJA::Index_type> indices;
+  RAJA::Index_type next = 0;
+  while (static_cast<RAJA::Index_type>(indices.size()) < n) {
+    const int len = run_length(gen);
+    for (int i = 0; i < len; ++i) {
+      indices.push_back(next++);
+    }
+    next += gap(gen);
+  }
+  indices.resize(n);
+  return indices;
+}
+
+std::vector<RAJA::Index_type> shuffledIndices(RAJA::Index_type n)
+{
+  std::vector<RAJA::Index_type> indices(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    indices[i] = 7 * i;
+  }
+  std::shuffle(indices.begin(), indices.end(), std::mt19937(5));
+  return indices;
+}
+
+template <typename T>
+std::vector<T> decodeAll(const RAJA::TypedCompressedListSegment<T>& seg)
+{
+  return std::vector<T>(seg.begin(), seg.end());
+}
+
+}  // end anonymous namespace
+
+TEST(CompressedListSegment, round_trip)
+{
+  const RAJA::Index_type n = 1000;
+  std::vector<std::vector<RAJA::Index_type>> inputs;
+  inputs.push_back(sortedIndices(n));
+  inputs.push_back(shuffledIndices(n));
+  inputs.push_back(std::vector<RAJA::Index_type>(n, 42));
+
+  std::vector<RAJA::Index_type> descending(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    descending[i] = 5000 - 3 * i;
+  }
+  inputs.push_back(descending);
+
+  std::vector<RAJA::Index_type> extremes = {
+      0,
+      std::numeric_limits<RAJA::Index_type>::max() / 2,
+      3,
+      std::numeric_limits<RAJA::Index_type>::max() / 4,
+      -std::numeric_limits<RAJA::Index_type>::max() / 2};
+  inputs.push_back(extremes);
+
+  for (const auto& indices : inputs) {
+    RAJA::CompressedListSegment seg(indices.data(), indices.size());
+    ASSERT_EQ(static_cast<RAJA::Index_type>(indices.size()), seg.size());
+    ASSERT_EQ(indices, decodeAll(seg));
+
+    std::vector<RAJA::Index_type> blocks;
+    RAJA::Index_type buf[RAJA::CompressedListSegment::block_size];
+    for (RAJA::Index_type b = 0; b < seg.num_blocks(); ++b) {
+      const RAJA::Index_type len = seg.decodeBlock(b, buf);
+      blocks.insert(blocks.end(), buf, buf + len);
+    }
+    ASSERT_EQ(indices, blocks);
+  }
+}
+
+TEST(CompressedListSegment, int_indices)
+{
+  std::vector<int> indices = {9, 8, 7, 100, 101, 102, 103, -5, 0};
+  RAJA::TypedCompressedListSegment<int> seg(indices);
+  ASSERT_EQ(indices, decodeAll(seg));
+}
+
+TEST(CompressedListSegment, compression)
+{
+  const RAJA::Index_type n = 1 << 16;
+  std::vector<RAJA::Index_type> consecutive(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    consecutive[i] = 1000 + i;
+  }
+  RAJA::CompressedListSegment runs(consecutive);
+  // block headers only
+  ASSERT_LT(runs.storage_bytes(), n / 4);
+
+  std::vector<RAJA::Index_type> sorted = sortedIndices(n);
+  RAJA::CompressedListSegment small_gaps(sorted);
+  ASSERT_LT(small_gaps.storage_bytes(), n * sizeof(RAJA::Index_type) / 4);
+}
+
+TEST(CompressedListSegment, empty)
+{
+  std::vector<RAJA::Index_type> none;
+  RAJA::CompressedListSegment seg(none);
+  ASSERT_EQ(0, seg.size());
+  ASSERT_EQ(0, seg.num_blocks());
+  ASSERT_TRUE(seg.begin() == seg.end());
+
+  int count = 0;
+  RAJA::forall<RAJA::seq_exec>(seg, [&](RAJA::Index_type) { ++count; });
+  ASSERT_EQ(0, count);
+}
+
+TEST(CompressedListSegment, equality_and_copies)
+{
+  std::vector<RAJA::Index_type> indices = sortedIndices(500);
+  RAJA::CompressedListSegment a(indices);
+  RAJA::CompressedListSegment b(indices.data(), indices.size());
+  RAJA::CompressedListSegment copy(a);
+  ASSERT_EQ(a, b);
+  ASSERT_EQ(a, copy);
+  ASSERT_EQ(indices, decodeAll(copy));
+
+  indices[300] += 1;
+  RAJA::CompressedListSegment c(indices);
+  ASSERT_NE(a, c);
+}
+
+template <typename T>
+class CompressedListForallTest : public ::testing::Test
+{
+};
+
+using CompressedListPolicies = ::testing::Types<RAJA::seq_exec,
+                                                RAJA::loop_exec,
+                                                RAJA::simd_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                                ,
+                                                RAJA::omp_parallel_for_exec,
+                                                RAJA::omp_parallel_exec<
+                                                    RAJA::omp_for_nowait_exec>,
+                                                RAJA::omp_parallel_exec<
+                                                    RAJA::omp_for_static<16>>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                                ,
+                                                RAJA::tbb_for_exec
+#endif
+                                                >;
+
+TYPED_TEST_CASE(CompressedListForallTest, CompressedListPolicies);
+
+TYPED_TEST(CompressedListForallTest, forall)
+{
+  const RAJA::Index_type n = 10000;
+  std::vector<RAJA::Index_type> indices = shuffledIndices(n);
+  RAJA::CompressedListSegment seg(indices);
+
+  std::vector<int> visits(7 * n, 0);
+  int* visit_data = visits.data();
+  RAJA::forall<TypeParam>(seg, [=](RAJA::Index_type i) { ++visit_data[i]; });
+
+  for (RAJA::Index_type i = 0; i < 7 * n; ++i) {
+    ASSERT_EQ(i % 7 == 0 ? 1 : 0, visits[i]);
+  }
+}
+
+TYPED_TEST(CompressedListForallTest, indexset)
+{
+  const RAJA::Index_type n = 3000;
+  std::vector<RAJA::Index_type> indices = sortedIndices(n);
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::CompressedListSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 10));
+  iset.push_back(RAJA::CompressedListSegment(indices));
+  ASSERT_EQ(static_cast<size_t>(10 + n), iset.getLength());
+
+  const RAJA::Index_type max_index = indices.back();
+  std::vector<int> visits(max_index + 1, 0);
+  int* visit_data = visits.data();
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, TypeParam>>(
+      iset, [=](RAJA::Index_type i) { ++visit_data[i]; });
+
+  std::vector<int> expected(max_index + 1, 0);
+  for (RAJA::Index_type i = 0; i < 10; ++i) {
+    ++expected[i];
+  }
+  for (RAJA::Index_type i : indices) {
+    ++expected[i];
+  }
+  ASSERT_EQ(expected, visits);
+}
+
+TEST(CompressedListSegment, forall_Icount)
+{
+  std::vector<RAJA::Index_type> indices = shuffledIndices(1000);
+  RAJA::TypedIndexSet<RAJA::CompressedListSegment> iset;
+  iset.push_back(RAJA::CompressedListSegment(indices));
+
+  std::vector<RAJA::Index_type> position(7 * 1000, -1);
+  RAJA::Index_type* position_data = position.data();
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type icount, RAJA::Index_type i) {
+        position_data[i] = icount;
+      });
+
+  for (RAJA::Index_type k = 0; k < 1000; ++k) {
+    ASSERT_EQ(k, position[indices[k]]);
+  }
+}
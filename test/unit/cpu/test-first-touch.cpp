@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for NUMA-aware first-touch allocation
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+template <typename Policy>
+void checkFirstTouch()
+{
+  const size_t sizes[] = {0, 1, 1000, 100000};
+  for (size_t n : sizes) {
+    double* data = RAJA::allocate_first_touch<Policy, double>(n);
+    ASSERT_NE(nullptr, data);
+    ASSERT_EQ(0u,
+              reinterpret_cast<std::uintptr_t>(data)
+                  % RAJA::detail::getPageSize());
+
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(0.0, data[i]);
+    }
+
+    RAJA::free_first_touch(data);
+  }
+}
+
+TEST(FirstTouch, seq_exec) { checkFirstTouch<RAJA::seq_exec>(); }
+
+TEST(FirstTouch, loop_exec) { checkFirstTouch<RAJA::loop_exec>(); }
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(FirstTouch, omp_parallel_for_static_block)
+{
+  checkFirstTouch<RAJA::omp_parallel_for_static_block>();
+}
+
+TEST(FirstTouch, static_block_affinity)
+{
+  const RAJA::Index_type n = 10007;
+  std::vector<int> first(n, -1);
+  std::vector<int> second(n, -1);
+  int* f = first.data();
+  int* s = second.data();
+
+  RAJA::forall<RAJA::omp_parallel_for_static_block>(
+      RAJA::RangeSegment(0, n),
+      [=](RAJA::Index_type i) { f[i] = omp_get_thread_num(); });
+  RAJA::forall<RAJA::omp_parallel_for_static_block>(
+      RAJA::RangeSegment(0, n),
+      [=](RAJA::Index_type i) { s[i] = omp_get_thread_num(); });
+
+  ASSERT_EQ(first, second);
+
+  // each thread owns one contiguous block, in thread order
+  ASSERT_EQ(0, first[0]);
+  for (RAJA::Index_type i = 1; i < n; ++i) {
+    ASSERT_TRUE(first[i] == first[i - 1] || first[i] == first[i - 1] + 1);
+  }
+  ASSERT_EQ(omp_get_max_threads() - 1, first[n - 1]);
+}
+
+TEST(FirstTouch, static_block_balanced)
+{
+  const int nt = omp_get_max_threads();
+  const RAJA::Index_type sizes[] = {0, 1, 7, 10007};
+  for (RAJA::Index_type n : sizes) {
+    std::vector<int> owner(n, -1);
+    int* o = owner.data();
+    RAJA::forall<RAJA::omp_parallel_for_static_block>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { o[i] = omp_get_thread_num(); });
+
+    // block sizes differ by at most one, the larger blocks coming first
+    std::vector<RAJA::Index_type> count(nt, 0);
+    for (RAJA::Index_type i = 0; i < n; ++i) {
+      ASSERT_LE(0, owner[i]);
+      ++count[owner[i]];
+    }
+    for (int t = 0; t < nt; ++t) {
+      ASSERT_EQ(n / nt + (t < n % nt ? 1 : 0), count[t]);
+    }
+  }
+}
+
+TEST(FirstTouch, static_block_reduce)
+{
+  const RAJA::Index_type n = 1000;
+  RAJA::ReduceSum<RAJA::omp_reduce, RAJA::Index_type> sum(0);
+  RAJA::forall<RAJA::omp_parallel_for_static_block>(
+      RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { sum += i; });
+  ASSERT_EQ(n * (n - 1) / 2, sum.get());
+}
+
+#endif
+
+#if defined(RAJA_ENABLE_THREADS)
+
+TEST(FirstTouch, thread_pool_static)
+{
+  checkFirstTouch<RAJA::thread_pool_static<>>();
+}
+
+#endif
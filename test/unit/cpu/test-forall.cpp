@@ -134,3 +134,16 @@ using TBBTypes = ::testing::Types<
 
 INSTANTIATE_TYPED_TEST_CASE_P(TBB, ForallTest, TBBTypes);
 #endif
+
+#if defined(RAJA_ENABLE_THREADS)
+using ThreadPoolTypes = ::testing::Types<
+    ExecPolicy<seq_segit, thread_pool_exec>,
+    ExecPolicy<thread_pool_exec, seq_exec>,
+    ExecPolicy<thread_pool_exec, loop_exec>,
+    ExecPolicy<seq_segit, thread_pool_static<>>,
+    ExecPolicy<seq_segit, thread_pool_static<16>>,
+    ExecPolicy<seq_segit, thread_pool_dynamic<7>>
+    >;
+
+INSTANTIATE_TYPED_TEST_CASE_P(ThreadPool, ForallTest, ThreadPoolTypes);
+#endif
@@ -0,0 +1,160 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for fused multi-body forall
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+template <typename T>
+class FusedTest : public ::testing::Test
+{
+};
+
+using FusedTypes = ::testing::Types<
+    camp::list<RAJA::seq_exec, RAJA::seq_reduce>,
+    camp::list<RAJA::loop_exec, RAJA::seq_reduce>,
+    camp::list<RAJA::simd_exec, RAJA::seq_reduce>
+#if defined(RAJA_ENABLE_OPENMP)
+    ,
+    camp::list<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>,
+    camp::list<RAJA::omp_parallel_for_static_block, RAJA::omp_reduce>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    ,
+    camp::list<RAJA::tbb_for_exec, RAJA::tbb_reduce>
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+    ,
+    camp::list<RAJA::thread_pool_exec, RAJA::thread_pool_reduce>
+#endif
+    >;
+
+TYPED_TEST_CASE(FusedTest, FusedTypes);
+
+TYPED_TEST(FusedTest, per_index)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ReducePolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  const int n = 10007;
+  std::vector<double> a(n), b(n, 0.0), c(n, 0.0);
+  for (int i = 0; i < n; ++i) {
+    a[i] = i;
+  }
+  const double* pa = a.data();
+  double* pb = b.data();
+  double* pc = c.data();
+
+  RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+  RAJA::forall_fused<ExecPolicy>(
+      RAJA::RangeSegment(0, n),
+      [=](RAJA::Index_type i) { pb[i] = 2.0 * pa[i]; },
+      [=](RAJA::Index_type i) { pc[i] = pb[i] + 1.0; },
+      [=](RAJA::Index_type i) { sum += pc[i]; });
+
+  double expected = 0.0;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(2.0 * i, b[i]);
+    ASSERT_EQ(2.0 * i + 1.0, c[i]);
+    expected += c[i];
+  }
+  ASSERT_EQ(expected, sum.get());
+}
+
+TYPED_TEST(FusedTest, chunked)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ReducePolicy = typename camp::at<TypeParam, camp::num<1>>::type;
+
+  const int n = 5003;
+  std::vector<int> a(n, 1), b(n, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  for (RAJA::Index_type chunk : {1, 64, 1000, 100000}) {
+    RAJA::ReduceMax<ReducePolicy, int> max_b(0);
+    RAJA::forall_fused_chunked<ExecPolicy>(
+        chunk,
+        RAJA::RangeStrideSegment(1, n, 2),
+        [=](RAJA::Index_type i) { pa[i] += 1; },
+        [=](RAJA::Index_type i) { pb[i] = pa[i] * 3; },
+        [=](RAJA::Index_type i) { max_b.max(pb[i] + static_cast<int>(i)); });
+
+    ASSERT_EQ(3 * a[n - 2] + n - 2, max_b.get());
+  }
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(i % 2 ? 5 : 1, a[i]);
+    ASSERT_EQ(i % 2 ? 15 : 0, b[i]);
+  }
+}
+
+TEST(FusedTest, list_and_indexset)
+{
+  const int n = 100;
+  std::vector<int> a(n, 0), b(n, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  std::vector<RAJA::Index_type> idx{3, 7, 50, 99};
+  RAJA::TypedListSegment<RAJA::Index_type> list(idx.data(), idx.size());
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment,
+                      RAJA::TypedListSegment<RAJA::Index_type>>
+      iset;
+  iset.push_back(RAJA::RangeSegment(10, 20));
+  iset.push_back(list);
+
+  RAJA::forall_fused<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset,
+      [=](RAJA::Index_type i) { pa[i] += 1; },
+      [=](RAJA::Index_type i) { pb[i] += pa[i]; });
+
+  RAJA::forall_fused_chunked<RAJA::seq_exec>(
+      3, list, [=](RAJA::Index_type i) { pa[i] += 10; });
+
+  for (int i = 0; i < n; ++i) {
+    const bool in_list = i == 3 || i == 7 || i == 50 || i == 99;
+    const bool in_range = i >= 10 && i < 20;
+    ASSERT_EQ(in_list ? 11 : in_range ? 1 : 0, a[i]);
+    ASSERT_EQ(in_list || in_range ? 1 : 0, b[i]);
+  }
+}
+
+#if defined(RAJA_ENABLE_THREADS)
+
+TEST(FusedTest, async)
+{
+  const int n = 1000;
+  std::vector<int> a(n, 0);
+  int* pa = a.data();
+
+  auto event = RAJA::forall_fused<RAJA::async_exec<>>(
+      RAJA::RangeSegment(0, n),
+      [=](RAJA::Index_type i) { pa[i] = static_cast<int>(i); },
+      [=](RAJA::Index_type i) { pa[i] *= 2; });
+  event.wait();
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(2 * i, a[i]);
+  }
+}
+
+#endif
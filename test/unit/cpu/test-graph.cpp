@@ -0,0 +1,245 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for recorded loop graphs
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace
+{
+
+//! Record a three-launch step: two independent updates, then a combine.
+void recordStep(RAJA::LoopGraph& graph, double* a, double* b, double* c, int n)
+{
+  graph.forall<RAJA::seq_exec>(RAJA::RangeSegment(0, n),
+                               [=](RAJA::Index_type i) { a[i] += 1.0; })
+      .writes(a);
+  graph.forall<RAJA::loop_exec>(RAJA::RangeSegment(0, n),
+                                [=](RAJA::Index_type i) { b[i] += 2.0; })
+      .writes(b);
+  graph.forall<RAJA::seq_exec>(RAJA::RangeSegment(0, n),
+                               [=](RAJA::Index_type i) {
+                                 c[i] = a[(i + 1) % n] + b[i];
+                               })
+      .reads(a, b)
+      .writes(c);
+}
+
+}  // end anonymous namespace
+
+TEST(GraphTest, dependencies)
+{
+  double a, b, c;
+  RAJA::LoopGraph graph;
+  auto body = [](RAJA::Index_type) {};
+  RAJA::RangeSegment range(0, 10);
+
+  graph.forall<RAJA::seq_exec>(range, body).writes(&a);          // 0
+  graph.forall<RAJA::seq_exec>(range, body).writes(&b);          // 1
+  graph.forall<RAJA::seq_exec>(range, body).reads(&a, &b);       // 2
+  graph.forall<RAJA::seq_exec>(range, body).reads(&a);           // 3
+  graph.forall<RAJA::seq_exec>(range, body).writes(&a);          // 4
+  graph.forall<RAJA::seq_exec>(range, body);                     // 5
+  graph.forall<RAJA::seq_exec>(range, body).reads(&c);           // 6
+  graph.forall<RAJA::seq_exec>(range, body).reads(&c).writes(&b);  // 7
+  graph.finalize();
+
+  ASSERT_EQ(8, graph.getNumNodes());
+
+  // RAW, then WAW
+  ASSERT_EQ(3, graph.getDepGraphNode(0).numDepTasks());
+  ASSERT_EQ(2, graph.getDepGraphNode(0).depTaskNum(0));
+  ASSERT_EQ(3, graph.getDepGraphNode(0).depTaskNum(1));
+  ASSERT_EQ(4, graph.getDepGraphNode(0).depTaskNum(2));
+  // WAR; 2 and 3 reach the barrier through 4
+  ASSERT_EQ(1, graph.getDepGraphNode(2).numDepTasks());
+  ASSERT_EQ(4, graph.getDepGraphNode(3).depTaskNum(0));
+  ASSERT_EQ(1, graph.getDepGraphNode(1).numDepTasks());
+  ASSERT_EQ(2, graph.getDepGraphNode(1).depTaskNum(0));
+  // node without accesses orders everything around it
+  ASSERT_EQ(1, graph.getDepGraphNode(4).numDepTasks());
+  ASSERT_EQ(5, graph.getDepGraphNode(4).depTaskNum(0));
+  ASSERT_EQ(2, graph.getDepGraphNode(5).numDepTasks());
+  ASSERT_EQ(1, graph.getDepGraphNode(6).semaphoreReloadValue());
+  ASSERT_EQ(3, graph.getDepGraphNode(4).semaphoreReloadValue());
+  ASSERT_EQ(0, graph.getDepGraphNode(6).numDepTasks());
+
+  // phases: {0, 1}, {2, 3}, {4}, {5}, {6, 7}
+  const int phases[] = {0, 0, 1, 1, 2, 3, 4, 4};
+  for (int j = 0; j < 8; ++j) {
+    ASSERT_EQ(phases[j], graph.getPhase(j));
+  }
+  ASSERT_EQ(5, graph.getNumPhases());
+
+  // recording again invalidates the analysis
+  graph.forall<RAJA::seq_exec>(range, body).reads(&b);
+  graph.finalize();
+  ASSERT_EQ(9, graph.getNumNodes());
+  ASSERT_EQ(1, graph.getDepGraphNode(7).numDepTasks());
+  ASSERT_EQ(6, graph.getNumPhases());
+
+  graph.clear();
+  ASSERT_EQ(0, graph.getNumNodes());
+  ASSERT_EQ(0, graph.getNumPhases());
+}
+
+TEST(GraphTest, replay)
+{
+  const int n = 1000;
+  std::vector<double> a(n, 0.0), b(n, 0.0), c(n, 0.0);
+
+  RAJA::LoopGraph graph;
+  recordStep(graph, a.data(), b.data(), c.data(), n);
+
+  // recording does not execute
+  ASSERT_EQ(0.0, a[0]);
+
+  for (int step = 1; step <= 3; ++step) {
+    graph.replay();
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(step * 3.0, c[i]);
+    }
+  }
+}
+
+TEST(GraphTest, kernel)
+{
+  const int n = 20;
+  std::vector<int> a(n * n, 0);
+  int* pa = a.data();
+  int sum = 0;
+
+  using KernelPol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+                           RAJA::statement::For<0, RAJA::loop_exec,
+                                                RAJA::statement::Lambda<0>,
+                                                RAJA::statement::Lambda<1>>>>;
+
+  RAJA::LoopGraph graph;
+  graph.kernel<KernelPol>(
+           RAJA::make_tuple(RAJA::RangeSegment(0, n), RAJA::RangeSegment(0, n)),
+           [=](RAJA::Index_type i, RAJA::Index_type j) { pa[i + n * j] += 1; },
+           [=](RAJA::Index_type i, RAJA::Index_type j) { pa[i + n * j] *= 2; })
+      .writes(pa);
+  graph.forall<RAJA::seq_exec>(RAJA::RangeSegment(0, n * n),
+                               [=, &sum](RAJA::Index_type i) { sum += pa[i]; })
+      .reads(pa);
+
+  graph.replay();
+  ASSERT_EQ(2 * n * n, sum);
+
+  graph.finalize();
+  ASSERT_EQ(0, graph.getNode(0).length());
+  ASSERT_EQ(2, graph.getNumPhases());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(GraphTest, team_replay)
+{
+  const int n = 1003;
+  std::vector<double> a(n, 0.0), b(n, 0.0), c(n, 0.0);
+
+  RAJA::LoopGraph graph;
+  recordStep(graph, a.data(), b.data(), c.data(), n);
+
+  const double* pc = c.data();
+  RAJA::ReduceSum<RAJA::omp_reduce, double> total(0.0);
+  graph.forall<RAJA::seq_exec>(RAJA::RangeSegment(0, n),
+                               [=](RAJA::Index_type i) { total += pc[i]; })
+      .reads(pc);
+
+  for (int step = 1; step <= 3; ++step) {
+    total.reset(0.0);
+    graph.replay<RAJA::omp_persistent_exec>();
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(step * 3.0, c[i]);
+    }
+    ASSERT_EQ(step * 3.0 * n, total.get());
+  }
+  ASSERT_EQ(3, graph.getNumPhases());
+}
+
+TEST(GraphTest, team_replay_sequential_recurrence)
+{
+  const int n = 2000;
+  std::vector<double> x(n, 0.0), y(n, 0.0);
+  double* px = x.data();
+  double* py = y.data();
+
+  RAJA::LoopGraph graph;
+  graph.forall<RAJA::seq_exec>(RAJA::RangeSegment(1, n),
+                               [=](RAJA::Index_type i) {
+                                 px[i] = px[i - 1] + 1.0;
+                               })
+      .writes(px);
+  graph.forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, n),
+                                            [=](RAJA::Index_type i) {
+                                              py[i] = 2.0 * px[i];
+                                            })
+      .reads(px)
+      .writes(py);
+
+  // the recurrence runs whole, the parallel launch is split
+  ASSERT_EQ(0, graph.getNode(0).length());
+  ASSERT_EQ(n, graph.getNode(1).length());
+
+  for (int step = 0; step < 5; ++step) {
+    x[0] = step;
+    graph.replay<RAJA::omp_persistent_exec>();
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(step + i, x[i]);
+      ASSERT_EQ(2.0 * (step + i), y[i]);
+    }
+  }
+}
+
+TEST(GraphTest, persistent_region_replay)
+{
+  const int n = 517;
+  std::vector<double> a(n, 0.0), b(n, 0.0), c(n, 0.0);
+  std::vector<int> d(n * 4, 0);
+  int* pd = d.data();
+
+  using KernelPol = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::omp_persistent_exec,
+                           RAJA::statement::Lambda<0>>>;
+
+  RAJA::LoopGraph graph;
+  recordStep(graph, a.data(), b.data(), c.data(), n);
+  graph.kernel<KernelPol>(RAJA::make_tuple(RAJA::RangeSegment(0, n * 4)),
+                          [=](RAJA::Index_type i) { pd[i] += 1; })
+      .writes(pd);
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    for (int step = 0; step < 10; ++step) {
+      graph.replay<RAJA::omp_persistent_exec>();
+    }
+  });
+
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(30.0, c[i]);
+  }
+  for (int i = 0; i < n * 4; ++i) {
+    ASSERT_EQ(10, d[i]);
+  }
+}
+
+#endif
@@ -0,0 +1,210 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the histogram and scatter-add patterns
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+template <typename T>
+class HistogramTest : public ::testing::Test
+{
+};
+
+using HistogramTypes = ::testing::Types<RAJA::seq_exec,
+                                        RAJA::loop_exec
+#if defined(RAJA_ENABLE_OPENMP)
+                                        ,
+                                        RAJA::omp_parallel_for_exec
+#endif
+#if defined(RAJA_ENABLE_TBB)
+                                        ,
+                                        RAJA::tbb_for_exec
+#endif
+                                        >;
+
+TYPED_TEST_CASE(HistogramTest, HistogramTypes);
+
+namespace
+{
+
+std::vector<int> randomBins(RAJA::Index_type n, int num_bins)
+{
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, num_bins - 1);
+  std::vector<int> values(n);
+  for (auto& v : values) {
+    v = dist(gen);
+  }
+  return values;
+}
+
+}  // end anonymous namespace
+
+// few bins, privatized by the parallel back-ends
+TYPED_TEST(HistogramTest, few_bins)
+{
+  const RAJA::Index_type n = 100000;
+  const int num_bins = 10;
+  std::vector<int> values = randomBins(n, num_bins);
+  const int* vals = values.data();
+
+  std::vector<int> expected(num_bins, 0);
+  for (int v : values) {
+    ++expected[v];
+  }
+
+  std::vector<int> bins(num_bins, 0);
+  RAJA::histogram<TypeParam>(RAJA::RangeSegment(0, n),
+                             bins.data(),
+                             num_bins,
+                             [=](RAJA::Index_type i) { return vals[i]; });
+  ASSERT_EQ(expected, bins);
+}
+
+// more bins than iterations per thread, atomics in the parallel back-ends
+TYPED_TEST(HistogramTest, many_bins)
+{
+  const RAJA::Index_type n = 50000;
+  const int num_bins = 40000;
+  std::vector<int> values = randomBins(n, num_bins);
+  const int* vals = values.data();
+
+  std::vector<long> expected(num_bins, 0);
+  for (int v : values) {
+    ++expected[v];
+  }
+
+  std::vector<long> bins(num_bins, 0);
+  RAJA::histogram<TypeParam>(RAJA::RangeSegment(0, n),
+                             bins.data(),
+                             num_bins,
+                             [=](RAJA::Index_type i) { return vals[i]; });
+  ASSERT_EQ(expected, bins);
+}
+
+TYPED_TEST(HistogramTest, accumulates)
+{
+  const int num_bins = 4;
+  std::vector<int> bins(num_bins, 100);
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::histogram<TypeParam>(RAJA::RangeSegment(0, 4000),
+                               bins.data(),
+                               num_bins,
+                               [=](RAJA::Index_type i) { return i % 4; });
+  }
+  for (int b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(100 + 3 * 1000, bins[b]);
+  }
+}
+
+TYPED_TEST(HistogramTest, scatter_add_list)
+{
+  const RAJA::Index_type n = 20000;
+  std::vector<RAJA::Index_type> idx;
+  for (RAJA::Index_type i = n - 1; i >= 0; i -= 3) {
+    idx.push_back(i);
+  }
+  RAJA::TypedListSegment<RAJA::Index_type> list(idx.data(), idx.size());
+
+  const int num_bins = 16;
+  std::vector<double> expected(num_bins, 0.0);
+  for (RAJA::Index_type i : idx) {
+    expected[i % num_bins] += 0.5 * i;
+  }
+
+  std::vector<double> out(num_bins, 0.0);
+  RAJA::scatter_add<TypeParam>(
+      list,
+      out.data(),
+      num_bins,
+      [=](RAJA::Index_type i) { return i % num_bins; },
+      [=](RAJA::Index_type i) { return 0.5 * i; });
+
+  // sums of multiples of 0.5 well below 2^53 are exact in any order
+  ASSERT_EQ(expected, out);
+}
+
+TYPED_TEST(HistogramTest, empty)
+{
+  std::vector<int> bins(8, 1);
+  RAJA::histogram<TypeParam>(RAJA::RangeSegment(0, 0),
+                             bins.data(),
+                             8,
+                             [=](RAJA::Index_type i) { return i; });
+  ASSERT_EQ(std::vector<int>(8, 1), bins);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// worksharing policies share one histogram among the threads of a region
+template <typename Policy>
+void checkHistogramInRegion(RAJA::Index_type n, int num_bins)
+{
+  std::vector<int> values = randomBins(n, num_bins);
+  const int* vals = values.data();
+
+  std::vector<long> expected(num_bins, 0);
+  for (int v : values) {
+    ++expected[v];
+  }
+
+  std::vector<long> bins(num_bins, 0);
+  long* out = bins.data();
+  RAJA::region<RAJA::omp_parallel_region>([=]() {
+    RAJA::histogram<Policy>(RAJA::RangeSegment(0, n),
+                            out,
+                            num_bins,
+                            [=](RAJA::Index_type i) { return vals[i]; });
+  });
+  ASSERT_EQ(expected, bins);
+}
+
+TEST(Histogram, omp_for_exec_in_region)
+{
+  checkHistogramInRegion<RAJA::omp_for_exec>(100000, 4);
+  checkHistogramInRegion<RAJA::omp_for_exec>(50000, 40000);
+}
+
+TEST(Histogram, omp_for_nowait_exec_in_region)
+{
+  checkHistogramInRegion<RAJA::omp_for_nowait_exec>(100000, 4);
+  checkHistogramInRegion<RAJA::omp_for_nowait_exec>(50000, 40000);
+}
+
+TEST(Histogram, omp_for_static_in_region)
+{
+  checkHistogramInRegion<RAJA::omp_for_static<64>>(100000, 4);
+}
+
+#endif
+
+TEST(Histogram, select_strategy)
+{
+  using RAJA::impl::histogram::Strategy;
+  using RAJA::impl::histogram::select_strategy;
+
+  ASSERT_EQ(Strategy::direct, select_strategy<int>(10, 1000000, 1));
+  ASSERT_EQ(Strategy::privatized, select_strategy<int>(10, 1000000, 8));
+  // merge would cost more than the loop
+  ASSERT_EQ(Strategy::atomic, select_strategy<int>(100000, 100000, 8));
+  // copies would not stay in cache
+  ASSERT_EQ(Strategy::atomic, select_strategy<double>(1 << 20, 1 << 30, 8));
+}
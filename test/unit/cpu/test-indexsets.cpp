@@ -22,6 +22,11 @@
 #include "buildIndexSet.hpp"
 
 #include "RAJA/RAJA.hpp"
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include <atomic>
+#include <random>
+#include <vector>
 
 class IndexSetTest : public ::testing::Test
 {
@@ -137,3 +142,537 @@ TEST(IndexSet, swap)
   ASSERT_EQ(0l, iset1.size());
   ASSERT_EQ(0lu, iset1.getLength());
 }
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+// Every segment records when it started and finished; check that no segment
+// started before all of its predecessors finished.
+static void checkTaskGraphOrder(UnitIndexSet& iset, int num_sweeps)
+{
+  const int num_seg = iset.getNumSegments();
+  std::atomic<int> clock(0);
+  std::vector<int> start(num_seg), finish(num_seg);
+
+  using policy = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+  for (int sweep = 0; sweep < num_sweeps; ++sweep) {
+    std::vector<int> visits(iset.getLength(), 0);
+    int* visit_data = visits.data();
+    int* start_data = start.data();
+    int* finish_data = finish.data();
+    std::atomic<int>* clock_ptr = &clock;
+
+    RAJA::forall<policy>(iset, [=](RAJA::Index_type i) { ++visit_data[i]; });
+
+    for (int v : visits) {
+      ASSERT_EQ(1, v);
+    }
+
+    using seg_policy = RAJA::ExecPolicy<RAJA::omp_taskgraph_segit,
+                                        RAJA::seq_exec>;
+    RAJA::wrap::forall(seg_policy::seg_it(), iset, [=](int segid) {
+      start_data[segid] = (*clock_ptr)++;
+      finish_data[segid] = (*clock_ptr)++;
+    });
+
+    for (int seg = 0; seg < num_seg; ++seg) {
+      const RAJA::DepGraphNode* node = iset.getDepGraphNode(seg);
+      for (int d = 0; d < node->numDepTasks(); ++d) {
+        ASSERT_LT(finish[seg], start[node->depTaskNum(d)]);
+      }
+    }
+  }
+}
+
+TEST(IndexSet, taskgraph_block)
+{
+  UnitIndexSet iset1d, iset2d, iset3d;
+  RAJA::buildLockFreeBlockIndexset(iset1d, 10000, 0, 0);
+  RAJA::buildLockFreeBlockIndexset(iset2d, 50, 400, 0);
+  RAJA::buildLockFreeBlockIndexset(iset3d, 10, 10, 200);
+
+  ASSERT_TRUE(iset1d.dependencyGraphSet());
+  ASSERT_TRUE(iset2d.dependencyGraphSet());
+  ASSERT_TRUE(iset3d.dependencyGraphSet());
+
+  checkTaskGraphOrder(iset1d, 3);
+  checkTaskGraphOrder(iset2d, 3);
+  checkTaskGraphOrder(iset3d, 3);
+}
+
+TEST(IndexSet, taskgraph_color)
+{
+  // 1d chain of elements, element i touches nodes i and i + 1
+  const int num_elem = 5000;
+  std::vector<RAJA::Index_type> elem_to_node(2 * num_elem);
+  for (int i = 0; i < num_elem; ++i) {
+    elem_to_node[2 * i] = i;
+    elem_to_node[2 * i + 1] = i + 1;
+  }
+
+  UnitIndexSet iset;
+  RAJA::buildLockFreeColorIndexset(
+      iset, elem_to_node.data(), num_elem, 2, num_elem + 1);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  checkTaskGraphOrder(iset, 2);
+
+  // unsynchronized scatter to nodes is safe under the dependency graph
+  std::vector<int> node_count(num_elem + 1, 0);
+  int* count = node_count.data();
+  const RAJA::Index_type* e2n = elem_to_node.data();
+  RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type i) {
+        ++count[e2n[2 * i]];
+        ++count[e2n[2 * i + 1]];
+      });
+  ASSERT_EQ(1, node_count.front());
+  ASSERT_EQ(1, node_count.back());
+  for (int i = 1; i < num_elem; ++i) {
+    ASSERT_EQ(2, node_count[i]);
+  }
+}
+
+// element (i, j) of an nx x ny quad mesh touches the 4 nodes at its corners
+static std::vector<RAJA::Index_type> quadMeshNodes(int nx, int ny)
+{
+  std::vector<RAJA::Index_type> elem_to_node;
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const RAJA::Index_type n = i + j * (nx + 1);
+      elem_to_node.push_back(n);
+      elem_to_node.push_back(n + 1);
+      elem_to_node.push_back(n + nx + 1);
+      elem_to_node.push_back(n + nx + 2);
+    }
+  }
+  return elem_to_node;
+}
+
+// each quad of an nx x ny quad mesh split into 2 triangles along a random
+// diagonal, so up to 8 triangles share a node
+static std::vector<RAJA::Index_type> triMeshNodes(int nx, int ny)
+{
+  std::mt19937 gen(5);
+  std::vector<RAJA::Index_type> elem_to_node;
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const RAJA::Index_type n = i + j * (nx + 1);
+      const RAJA::Index_type tris[2][6] = {
+          {n, n + 1, n + nx + 2, n, n + nx + 2, n + nx + 1},
+          {n, n + 1, n + nx + 1, n + 1, n + nx + 2, n + nx + 1}};
+      const RAJA::Index_type* t = tris[gen() % 2];
+      elem_to_node.insert(elem_to_node.end(), t, t + 6);
+    }
+  }
+  return elem_to_node;
+}
+
+// Check that the elements of each segment share no range entity and that
+// an unsynchronized scatter under the dependency graph is correct.
+static void checkColorIndexSet(UnitIndexSet& iset,
+                               const std::vector<RAJA::Index_type>& e2r,
+                               int num_elem,
+                               int num_per_elem,
+                               int num_range)
+{
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(static_cast<size_t>(num_elem), iset.getLength());
+
+  // segment and element that last touched each range entity
+  std::vector<int> owner_seg(num_range, -1);
+  std::vector<RAJA::Index_type> owner_elem(num_range, -1);
+  for (size_t seg = 0; seg < iset.getNumSegments(); ++seg) {
+    const int segid = static_cast<int>(seg);
+    iset.segmentCall(seg,
+                     RAJA::detail::CallForall{},
+                     RAJA::seq_exec(),
+                     [&](RAJA::Index_type e) {
+                       for (int k = 0; k < num_per_elem; ++k) {
+                         const RAJA::Index_type r = e2r[e * num_per_elem + k];
+                         ASSERT_TRUE(owner_seg[r] != segid
+                                     || owner_elem[r] == e);
+                         owner_seg[r] = segid;
+                         owner_elem[r] = e;
+                       }
+                     });
+  }
+
+  checkTaskGraphOrder(iset, 2);
+
+  std::vector<int> expected(num_range, 0);
+  for (RAJA::Index_type r : e2r) {
+    ++expected[r];
+  }
+  std::vector<int> count(num_range, 0);
+  int* count_data = count.data();
+  const RAJA::Index_type* e2r_data = e2r.data();
+  RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+      iset, [=](RAJA::Index_type e) {
+        for (int k = 0; k < num_per_elem; ++k) {
+          ++count_data[e2r_data[e * num_per_elem + k]];
+        }
+      });
+  ASSERT_EQ(expected, count);
+}
+
+TEST(IndexSet, taskgraph_color_parallel)
+{
+  const int nx = 150, ny = 90;
+  std::vector<RAJA::Index_type> quad = quadMeshNodes(nx, ny);
+  UnitIndexSet quad_set;
+  RAJA::buildLockFreeColorIndexsetParallel(
+      quad_set, quad.data(), nx * ny, 4, (nx + 1) * (ny + 1));
+  checkColorIndexSet(quad_set, quad, nx * ny, 4, (nx + 1) * (ny + 1));
+
+  std::vector<RAJA::Index_type> tri = triMeshNodes(nx, ny);
+  UnitIndexSet tri_set;
+  RAJA::buildLockFreeColorIndexsetParallel(
+      tri_set, tri.data(), 2 * nx * ny, 3, (nx + 1) * (ny + 1));
+  checkColorIndexSet(tri_set, tri, 2 * nx * ny, 3, (nx + 1) * (ny + 1));
+
+  // permuted elements in range segments
+  std::vector<RAJA::Index_type> perm(nx * ny), iperm(nx * ny);
+  UnitIndexSet perm_set;
+  RAJA::buildLockFreeColorIndexsetParallel(perm_set,
+                                           quad.data(),
+                                           nx * ny,
+                                           4,
+                                           (nx + 1) * (ny + 1),
+                                           perm.data(),
+                                           iperm.data());
+  for (size_t seg = 0; seg < perm_set.getNumSegments(); ++seg) {
+    ASSERT_TRUE(perm_set.checkSegmentType<RAJA::RangeSegment>(seg));
+  }
+  for (int k = 0; k < nx * ny; ++k) {
+    ASSERT_EQ(k, iperm[perm[k]]);
+  }
+
+  UnitIndexSet empty;
+  RAJA::buildLockFreeColorIndexsetParallel(empty, quad.data(), 0, 4, 0);
+  ASSERT_EQ(0u, empty.getNumSegments());
+}
+
+TEST(IndexSet, taskgraph_color_parallel_balance)
+{
+  const int nx = 200, ny = 120;
+  const int num_elem = 2 * nx * ny;
+  const int num_nodes = (nx + 1) * (ny + 1);
+  std::vector<RAJA::Index_type> tri = triMeshNodes(nx, ny);
+
+  // with one thread each color is one segment
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  UnitIndexSet iset;
+  std::vector<RAJA::Index_type> perm(num_elem);
+  RAJA::buildLockFreeColorIndexsetParallel(
+      iset, tri.data(), num_elem, 3, num_nodes, perm.data());
+
+  const size_t mean = num_elem / iset.getNumSegments();
+  for (size_t seg = 0; seg < iset.getNumSegments(); ++seg) {
+    const size_t len = iset.getSegment<RAJA::RangeSegment>(seg).size();
+    ASSERT_LE(len, mean + mean / 50 + 1);
+    ASSERT_GE(len, mean - mean / 10);
+  }
+
+  // the colors do not depend on the number of threads
+  for (int nt = 2; nt <= 4; ++nt) {
+    omp_set_num_threads(nt);
+    UnitIndexSet nt_set;
+    std::vector<RAJA::Index_type> nt_perm(num_elem);
+    RAJA::buildLockFreeColorIndexsetParallel(
+        nt_set, tri.data(), num_elem, 3, num_nodes, nt_perm.data());
+    ASSERT_EQ(perm, nt_perm);
+  }
+  omp_set_num_threads(max_threads);
+}
+
+TEST(IndexSet, taskgraph_interval)
+{
+  // Segment k of thread t must follow segment k of thread t - 1.
+  const int num_threads = 3;
+  const int num_per_thread = 4;
+  UnitIndexSet iset;
+  for (int t = 0; t < num_threads; ++t) {
+    for (int k = 0; k < num_per_thread; ++k) {
+      const int seg = t * num_per_thread + k;
+      iset.push_back(RAJA::RangeSegment(seg * 10, seg * 10 + 10));
+    }
+    iset.setSegmentInterval(t, t * num_per_thread, (t + 1) * num_per_thread);
+  }
+  ASSERT_EQ(3u, iset.getNumSegmentIntervals());
+
+  iset.initDependencyGraph();
+  for (int t = 1; t < num_threads; ++t) {
+    for (int k = 0; k < num_per_thread; ++k) {
+      iset.getDepGraphNode((t - 1) * num_per_thread + k)
+          ->addDepTask(t * num_per_thread + k);
+      iset.getDepGraphNode(t * num_per_thread + k)->semaphoreReloadValue() = 1;
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  std::vector<int> order(iset.getLength(), -1);
+  std::atomic<int> clock(0);
+  int* order_data = order.data();
+  std::atomic<int>* clock_ptr = &clock;
+
+  using policy =
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit, RAJA::seq_exec>;
+  for (int sweep = 0; sweep < 2; ++sweep) {
+    RAJA::forall<policy>(iset, [=](RAJA::Index_type i) {
+      order_data[i] = (*clock_ptr)++;
+    });
+
+    for (int t = 1; t < num_threads; ++t) {
+      for (int k = 0; k < num_per_thread; ++k) {
+        const int seg = t * num_per_thread + k;
+        ASSERT_LT(order[(seg - num_per_thread) * 10 + 9], order[seg * 10]);
+      }
+    }
+  }
+}
+
+TEST(IndexSet, taskgraph_not_set)
+{
+  UnitIndexSet iset;
+  iset.push_back(RAJA::RangeSegment(0, 10));
+  ASSERT_FALSE(iset.dependencyGraphSet());
+  ASSERT_THROW(
+      (RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit,
+                                     RAJA::seq_exec>>(iset,
+                                                      [](RAJA::Index_type) {})),
+      std::runtime_error);
+}
+
+#endif
+
+using AlignedIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>;
+
+// runs of consecutive indices at random offsets mixed with scattered indices
+static std::vector<RAJA::Index_type> alignedBuilderIndices(int seed,
+                                                           RAJA::Index_type n)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> run_length(1, 200);
+  std::uniform_int_distribution<int> gap(1, 7);
+  std::bernoulli_distribution scattered(0.3);
+
+  std::vector<RAJA::Index_type> indices;
+  RAJA::Index_type next = 0;
+  while (static_cast<RAJA::Index_type>(indices.size()) < n) {
+    const int len = scattered(gen) ? 1 : run_length(gen);
+    for (int i = 0; i < len; ++i) {
+      indices.push_back(next++);
+    }
+    next += gap(gen);
+  }
+  indices.resize(n);
+  return indices;
+}
+
+static std::vector<RAJA::Index_type> indexSetIndices(AlignedIndexSet& iset)
+{
+  std::vector<RAJA::Index_type> indices;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      iset, [&](RAJA::Index_type i) { indices.push_back(i); });
+  return indices;
+}
+
+static void checkParallelAlignedBuilder(
+    const std::vector<RAJA::Index_type>& indices)
+{
+  const RAJA::Index_type n = indices.size();
+
+  AlignedIndexSet serial;
+  RAJA::buildIndexSetAligned(serial, indices.data(), n);
+  ASSERT_EQ(indices, indexSetIndices(serial));
+
+  int max_threads = 1;
+#if defined(RAJA_ENABLE_OPENMP)
+  max_threads = omp_get_max_threads();
+  for (int nt = 1; nt <= 7; ++nt) {
+    omp_set_num_threads(nt);
+#endif
+    AlignedIndexSet parallel;
+    RAJA::buildIndexSetAlignedParallel(parallel, indices.data(), n);
+    ASSERT_EQ(serial.getNumSegments(), parallel.getNumSegments());
+    ASSERT_EQ(serial, parallel);
+#if defined(RAJA_ENABLE_OPENMP)
+  }
+  omp_set_num_threads(max_threads);
+#endif
+  (void)max_threads;
+}
+
+TEST(IndexSet, buildAligned_parallel)
+{
+  for (int seed = 0; seed < 4; ++seed) {
+    checkParallelAlignedBuilder(alignedBuilderIndices(seed, 20000 + seed));
+  }
+}
+
+TEST(IndexSet, buildAligned_parallel_edge_cases)
+{
+  std::vector<RAJA::Index_type> consecutive(1000);
+  for (RAJA::Index_type i = 0; i < 1000; ++i) {
+    consecutive[i] = i;
+  }
+  checkParallelAlignedBuilder(consecutive);
+
+  AlignedIndexSet iset;
+  RAJA::buildIndexSetAlignedParallel(iset, consecutive.data(), 1000);
+  ASSERT_EQ(1u, iset.getNumSegments());
+  ASSERT_EQ(RAJA::RangeSegment(0, 1000),
+            iset.getSegment<RAJA::RangeSegment>(0));
+
+  // no ranges at all: a single list
+  std::vector<RAJA::Index_type> strided(1000);
+  for (RAJA::Index_type i = 0; i < 1000; ++i) {
+    strided[i] = 2 * i;
+  }
+  checkParallelAlignedBuilder(strided);
+
+  // short arrays and consecutive indices shorter than the chunks
+  checkParallelAlignedBuilder(alignedBuilderIndices(11, 7));
+  checkParallelAlignedBuilder(alignedBuilderIndices(12, RAJA::RANGE_MIN_LENGTH));
+  checkParallelAlignedBuilder(
+      alignedBuilderIndices(13, RAJA::RANGE_MIN_LENGTH + 1));
+
+  AlignedIndexSet empty;
+  RAJA::buildIndexSetAlignedParallel(empty, consecutive.data(), 0);
+  ASSERT_EQ(0u, empty.getNumSegments());
+}
+
+using BlockIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                          RAJA::ListSegment,
+                                          RAJA::BlockListSegment<8>>;
+
+// aligned blocks of 8 selected at random, with scattered indices between
+static std::vector<RAJA::Index_type> blockBuilderIndices(RAJA::Index_type n)
+{
+  std::mt19937 gen(17);
+  std::bernoulli_distribution selected(0.6);
+  std::bernoulli_distribution scattered(0.01);
+  std::vector<RAJA::Index_type> indices;
+  for (RAJA::Index_type block = 0;
+       static_cast<RAJA::Index_type>(indices.size()) < n;
+       ++block) {
+    if (scattered(gen)) {
+      indices.push_back(8 * block + 3);
+    } else if (selected(gen)) {
+      for (RAJA::Index_type j = 0; j < 8; ++j) {
+        indices.push_back(8 * block + j);
+      }
+    }
+  }
+  indices.resize(n);
+  return indices;
+}
+
+static size_t countBlockLists(const BlockIndexSet& iset)
+{
+  size_t count = 0;
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    count += iset.checkSegmentType<RAJA::BlockListSegment<8>>(s);
+  }
+  return count;
+}
+
+TEST(IndexSet, buildAligned_blocks)
+{
+  const std::vector<RAJA::Index_type> indices = blockBuilderIndices(40000);
+  const RAJA::Index_type n = indices.size();
+
+  AlignedIndexSet plain;
+  RAJA::buildIndexSetAligned(plain, indices.data(), n);
+  BlockIndexSet blocks;
+  RAJA::buildIndexSetAligned(blocks, indices.data(), n);
+
+  std::vector<RAJA::Index_type> visited;
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      blocks, [&](RAJA::Index_type i) { visited.push_back(i); });
+  ASSERT_EQ(indices, visited);
+  ASSERT_EQ(static_cast<size_t>(n), blocks.getLength());
+
+  ASSERT_GT(countBlockLists(blocks), 0u);
+  ASSERT_LT(4 * blocks.getNumSegments(), plain.getNumSegments());
+
+  // forall_Icount numbers the indices in array order
+  std::vector<RAJA::Index_type> position(indices.back() + 1, -1);
+  RAJA::Index_type* position_data = position.data();
+  RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec>>(
+      blocks, [=](RAJA::Index_type icount, RAJA::Index_type i) {
+        position_data[i] = icount;
+      });
+  for (RAJA::Index_type k = 0; k < n; ++k) {
+    ASSERT_EQ(k, position[indices[k]]);
+  }
+}
+
+TEST(IndexSet, buildAligned_blocks_edge_cases)
+{
+  // one run of consecutive indices stays a range
+  std::vector<RAJA::Index_type> consecutive(1000);
+  for (RAJA::Index_type i = 0; i < 1000; ++i) {
+    consecutive[i] = 16 + i;
+  }
+  BlockIndexSet iset;
+  RAJA::buildIndexSetAligned(iset, consecutive.data(), 1000);
+  ASSERT_EQ(1u, iset.getNumSegments());
+  ASSERT_EQ(RAJA::RangeSegment(16, 1016),
+            iset.getSegment<RAJA::RangeSegment>(0));
+
+  // so does a single short block
+  std::vector<RAJA::Index_type> one_block(consecutive.begin(),
+                                          consecutive.begin() + 8);
+  for (RAJA::Index_type i = 0; i < 40; ++i) {
+    one_block.push_back(100 + 3 * i);
+  }
+  BlockIndexSet short_set;
+  RAJA::buildIndexSetAligned(short_set, one_block.data(), one_block.size());
+  ASSERT_EQ(0u, countBlockLists(short_set));
+
+  // no blocks at all: a single list
+  std::vector<RAJA::Index_type> strided(1000);
+  for (RAJA::Index_type i = 0; i < 1000; ++i) {
+    strided[i] = 2 * i;
+  }
+  BlockIndexSet list_set;
+  RAJA::buildIndexSetAligned(list_set, strided.data(), 1000);
+  ASSERT_EQ(1u, list_set.getNumSegments());
+  ASSERT_EQ(RAJA::ListSegment(strided.data(), 1000),
+            list_set.getSegment<RAJA::ListSegment>(0));
+
+  BlockIndexSet empty;
+  RAJA::buildIndexSetAligned(empty, strided.data(), 0);
+  ASSERT_EQ(0u, empty.getNumSegments());
+
+  // blocks spanning first to last index that are not one run stay blocks
+  const std::vector<std::vector<RAJA::Index_type>> block_orders = {
+      {0, 0, 16, 24, 32, 40, 48, 56},  // repeated block
+      {0, 16, 8, 24},                  // permuted blocks
+      {64, 16, 8, 24, 32, 40, 48, 0}};
+  for (const auto& order : block_orders) {
+    std::vector<RAJA::Index_type> indices;
+    for (RAJA::Index_type start : order) {
+      for (RAJA::Index_type j = 0; j < 8; ++j) {
+        indices.push_back(start + j);
+      }
+    }
+    const RAJA::Index_type n = indices.size();
+    BlockIndexSet iset;
+    RAJA::buildIndexSetAligned(iset, indices.data(), n);
+
+    std::vector<RAJA::Index_type> visited;
+    std::vector<RAJA::Index_type> icounts;
+    RAJA::forall_Icount<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+        iset, [&](RAJA::Index_type icount, RAJA::Index_type i) {
+          icounts.push_back(icount);
+          visited.push_back(i);
+        });
+    ASSERT_EQ(indices, visited);
+    for (RAJA::Index_type k = 0; k < n; ++k) {
+      ASSERT_EQ(k, icounts[k]);
+    }
+  }
+}
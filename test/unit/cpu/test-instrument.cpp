@@ -0,0 +1,207 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA launch instrumentation
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+//! Listener recording every event it receives
+struct RecordingListener : RAJA::instrument::Listener {
+  struct Event {
+    bool post;
+    RAJA::instrument::Pattern pattern;
+    std::string policy;
+    std::string label;
+    RAJA::Index_type num_iterations;
+  };
+
+  std::vector<Event> events;
+
+  void preLaunch(const RAJA::instrument::LaunchInfo& info) override
+  {
+    record(false, info);
+  }
+
+  void postLaunch(const RAJA::instrument::LaunchInfo& info) override
+  {
+    record(true, info);
+  }
+
+  void record(bool post, const RAJA::instrument::LaunchInfo& info)
+  {
+    events.push_back(Event{post,
+                           info.pattern,
+                           info.policy,
+                           info.label ? info.label : "",
+                           info.num_iterations});
+  }
+};
+
+class InstrumentTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { RAJA::instrument::addListener(&listener); }
+
+  void TearDown() override { RAJA::instrument::removeListener(&listener); }
+
+  RecordingListener listener;
+};
+
+}  // end anonymous namespace
+
+#if defined(RAJA_ENABLE_INSTRUMENTATION)
+
+TEST_F(InstrumentTest, forall)
+{
+  {
+    RAJA::instrument::ScopedLabel label("outer");
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                                 [](RAJA::Index_type) {});
+    {
+      RAJA::instrument::ScopedLabel inner("inner");
+      RAJA::forall<RAJA::loop_exec>(RAJA::RangeStrideSegment(0, 100, 3),
+                                    [](RAJA::Index_type) {});
+    }
+  }
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 7),
+                               [](RAJA::Index_type) {});
+
+  ASSERT_EQ(6u, listener.events.size());
+
+  EXPECT_FALSE(listener.events[0].post);
+  EXPECT_TRUE(listener.events[1].post);
+  EXPECT_EQ(RAJA::instrument::Pattern::forall, listener.events[0].pattern);
+  EXPECT_EQ("outer", listener.events[0].label);
+  EXPECT_EQ(100, listener.events[0].num_iterations);
+  EXPECT_EQ("RAJA::policy::sequential::seq_exec", listener.events[0].policy);
+
+  EXPECT_EQ("inner", listener.events[2].label);
+  EXPECT_EQ(34, listener.events[2].num_iterations);
+  EXPECT_EQ("RAJA::policy::loop::loop_exec", listener.events[2].policy);
+
+  EXPECT_EQ("", listener.events[4].label);
+  EXPECT_EQ(7, listener.events[4].num_iterations);
+  EXPECT_EQ(nullptr, RAJA::instrument::getLabel());
+}
+
+TEST_F(InstrumentTest, kernel)
+{
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1,
+                           RAJA::seq_exec,
+                           RAJA::statement::For<0,
+                                                RAJA::seq_exec,
+                                                RAJA::statement::Lambda<0>>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, 5),
+                                     RAJA::RangeSegment(0, 6)),
+                    [](RAJA::Index_type, RAJA::Index_type) {});
+
+  ASSERT_EQ(2u, listener.events.size());
+  EXPECT_EQ(RAJA::instrument::Pattern::kernel, listener.events[0].pattern);
+  EXPECT_EQ(30, listener.events[0].num_iterations);
+}
+
+TEST_F(InstrumentTest, scan_sort_reduce)
+{
+  std::vector<int> data{3, 1, 2, 5, 4};
+
+  RAJA::inclusive_scan_inplace<RAJA::seq_exec>(data.begin(), data.end());
+  RAJA::sort<RAJA::seq_exec>(data);
+
+  RAJA::ReduceSum<RAJA::seq_reduce, int> sum(0);
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 5),
+                               [=](RAJA::Index_type i) { sum += i; });
+  ASSERT_EQ(10, sum.get());
+
+  ASSERT_EQ(8u, listener.events.size());
+  EXPECT_EQ(RAJA::instrument::Pattern::scan, listener.events[0].pattern);
+  EXPECT_EQ(5, listener.events[0].num_iterations);
+  EXPECT_EQ(RAJA::instrument::Pattern::sort, listener.events[2].pattern);
+  EXPECT_EQ(5, listener.events[2].num_iterations);
+  EXPECT_EQ(RAJA::instrument::Pattern::forall, listener.events[4].pattern);
+  EXPECT_EQ(RAJA::instrument::Pattern::reduce, listener.events[6].pattern);
+  EXPECT_EQ(0, listener.events[6].num_iterations);
+}
+
+TEST_F(InstrumentTest, profiler)
+{
+  RAJA::instrument::Profiler profiler;
+  RAJA::instrument::addListener(&profiler);
+
+  for (int i = 0; i < 3; ++i) {
+    RAJA::instrument::ScopedLabel label("loop");
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 1000),
+                                 [](RAJA::Index_type) {});
+  }
+
+  RAJA::instrument::removeListener(&profiler);
+
+  // not recorded
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 1000),
+                               [](RAJA::Index_type) {});
+
+  auto records = profiler.getRecords();
+  ASSERT_EQ(1u, records.size());
+  const auto& entry = *records.begin();
+  EXPECT_EQ("loop", std::get<0>(entry.first));
+  EXPECT_EQ("forall", std::get<1>(entry.first));
+  EXPECT_EQ(3, entry.second.num_calls);
+  EXPECT_EQ(3000, entry.second.num_iterations);
+
+  std::ostringstream os;
+  profiler.report(os);
+  EXPECT_NE(std::string::npos, os.str().find("loop"));
+  EXPECT_NE(std::string::npos, os.str().find("seq_exec"));
+
+  profiler.reset();
+  EXPECT_TRUE(profiler.getRecords().empty());
+}
+
+TEST(Instrument, parseTypeName)
+{
+  using RAJA::instrument::detail::parseTypeName;
+
+  EXPECT_EQ("RAJA::seq_exec",
+            parseTypeName("const char* f() [with T = RAJA::seq_exec]", "x"));
+  EXPECT_EQ("A<int[2]>", parseTypeName("const char* f() [T = A<int[2]>]", "x"));
+  EXPECT_EQ("B",
+            parseTypeName("const char* f() [with T = B; std::string = x]",
+                          "x"));
+  EXPECT_EQ("x", parseTypeName("f()", "x"));
+}
+
+#else
+
+TEST_F(InstrumentTest, disabled)
+{
+  RAJA::instrument::ScopedLabel label("unused");
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                               [](RAJA::Index_type) {});
+
+  EXPECT_TRUE(listener.events.empty());
+}
+
+#endif
@@ -0,0 +1,203 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the RAJA memory pools
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+//! generic_allocator that counts outstanding allocations
+struct counting_allocator {
+  static int num_outstanding;
+
+  void* malloc(size_t nbytes)
+  {
+    ++num_outstanding;
+    return std::malloc(nbytes);
+  }
+
+  bool free(void* ptr)
+  {
+    --num_outstanding;
+    std::free(ptr);
+    return true;
+  }
+};
+
+int counting_allocator::num_outstanding = 0;
+
+template <typename T>
+class MemPoolTest : public ::testing::Test
+{
+};
+
+using PoolTypes = ::testing::Types<
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>,
+    RAJA::basic_mempool::SlabMemPool<RAJA::basic_mempool::generic_allocator>>;
+
+TYPED_TEST_CASE(MemPoolTest, PoolTypes);
+
+TYPED_TEST(MemPoolTest, malloc_free)
+{
+  auto& pool = TypeParam::getInstance();
+
+  std::vector<int*> ptrs;
+  for (int i = 0; i < 200; ++i) {
+    const int len = 1 + (i * 37) % 3000;
+    int* ptr = pool.template malloc<int>(len);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(ptr) % alignof(int));
+    for (int j = 0; j < len; ++j) {
+      ptr[j] = i;
+    }
+    ptrs.push_back(ptr);
+  }
+
+  // no allocation overlaps another
+  for (int i = 0; i < 200; ++i) {
+    const int len = 1 + (i * 37) % 3000;
+    for (int j = 0; j < len; ++j) {
+      ASSERT_EQ(i, ptrs[i][j]);
+    }
+  }
+
+  for (int* ptr : ptrs) {
+    pool.free(ptr);
+  }
+
+  // freed memory is handed out again
+  double* ptr = pool.template malloc<double>(100);
+  ASSERT_NE(nullptr, ptr);
+  pool.free(ptr);
+
+  pool.free_chunks();
+}
+
+TYPED_TEST(MemPoolTest, alignment)
+{
+  auto& pool = TypeParam::getInstance();
+
+  for (size_t alignment : {8, 64, 256, 4096}) {
+    char* ptr = pool.template malloc<char>(3, alignment);
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(ptr) % alignment);
+    pool.free(ptr);
+  }
+
+  pool.free_chunks();
+}
+
+TYPED_TEST(MemPoolTest, large)
+{
+  auto& pool = TypeParam::getInstance();
+
+  const size_t len = 5 * 1024 * 1024;
+  char* ptr = pool.template malloc<char>(len);
+  ASSERT_NE(nullptr, ptr);
+  ptr[0] = 1;
+  ptr[len - 1] = 2;
+  pool.free(ptr);
+
+  pool.free_chunks();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TYPED_TEST(MemPoolTest, threads)
+{
+  auto& pool = TypeParam::getInstance();
+
+  int num_errors = 0;
+
+#pragma omp parallel reduction(+ : num_errors)
+  {
+    const int tid = omp_get_thread_num();
+    for (int iter = 0; iter < 1000; ++iter) {
+      const int len = 1 + (iter % 7) * 16;
+      int* a = pool.template malloc<int>(len);
+      int* b = pool.template malloc<int>(len * 3);
+      for (int j = 0; j < len; ++j) {
+        a[j] = tid;
+      }
+      for (int j = 0; j < len * 3; ++j) {
+        b[j] = -tid;
+      }
+      for (int j = 0; j < len; ++j) {
+        num_errors += (a[j] != tid);
+      }
+      pool.free(a);
+      pool.free(b);
+    }
+  }
+
+  ASSERT_EQ(0, num_errors);
+
+  pool.free_chunks();
+}
+#endif
+
+TEST(MemPoolTest, slab_free_chunks)
+{
+  using pool_type = RAJA::basic_mempool::SlabMemPool<counting_allocator>;
+  pool_type pool;
+
+  pool.arena_size(4 * pool_type::slab_size);
+  ASSERT_EQ(4 * pool_type::slab_size, pool.arena_size());
+
+  std::vector<void*> ptrs;
+  for (int i = 0; i < 1000; ++i) {
+    ptrs.push_back(pool.malloc<double>(1 + i % 500));
+  }
+  ptrs.push_back(pool.malloc<char>(3 * pool_type::slab_size));
+  ASSERT_LT(0, counting_allocator::num_outstanding);
+
+  for (void* ptr : ptrs) {
+    ASSERT_NE(nullptr, ptr);
+    pool.free(ptr);
+  }
+
+  pool.free_chunks();
+  ASSERT_EQ(0, counting_allocator::num_outstanding);
+
+  // the pool is usable after free_chunks
+  void* ptr = pool.malloc<int>(10);
+  ASSERT_NE(nullptr, ptr);
+  pool.free(ptr);
+  pool.free_chunks();
+  ASSERT_EQ(0, counting_allocator::num_outstanding);
+}
+
+TEST(MemPoolTest, slab_reuse)
+{
+  using pool_type =
+      RAJA::basic_mempool::SlabMemPool<RAJA::basic_mempool::generic_allocator>;
+  pool_type pool;
+
+  // a block freed by this thread is the next one handed out in its class
+  double* a = pool.malloc<double>(10);
+  pool.free(a);
+  double* b = pool.malloc<double>(12);
+  ASSERT_EQ(a, b);
+  pool.free(b);
+
+  ASSERT_EQ(nullptr, pool.malloc<char>(1, 2 * pool_type::slab_size));
+
+  pool.free_chunks();
+}
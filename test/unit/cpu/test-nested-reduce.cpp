@@ -61,6 +61,27 @@ TEST(NestedReduce, seq_omp)
   test<RAJA::seq_exec, RAJA::omp_parallel_for_exec, RAJA::omp_reduce>(10, 20);
   test<RAJA::seq_exec, RAJA::omp_parallel_for_exec, RAJA::omp_reduce>(37, 73);
 }
+
+TEST(NestedReduce, omp_seq_slots)
+{
+  test<RAJA::omp_parallel_for_exec, RAJA::seq_exec, RAJA::omp_reduce_slots>(
+      10, 20);
+  test<RAJA::omp_parallel_for_exec, RAJA::seq_exec, RAJA::omp_reduce_slots>(
+      37, 73);
+}
+
+TEST(NestedReduce, omp_omp_slots_not_nested)
+{
+  // the inner regions are inactive, so every inner thread is thread 0
+  const int max_active_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(1);
+  for (int rep = 0; rep < 20; ++rep) {
+    test<RAJA::omp_parallel_for_exec,
+         RAJA::omp_parallel_for_exec,
+         RAJA::omp_reduce_slots>(100, 400);
+  }
+  omp_set_max_active_levels(max_active_levels);
+}
 #endif
 #if defined(RAJA_ENABLE_TBB)
 TEST(NestedReduce, tbb_seq)
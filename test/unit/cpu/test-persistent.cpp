@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the OpenMP persistent team policies
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(PersistentTest, forall)
+{
+  const RAJA::Index_type n = 10007;
+  std::vector<double> data(n, 0.0);
+  double* ptr = data.data();
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    // dependent loops, launched back to back
+    for (int step = 0; step < 100; ++step) {
+      RAJA::forall<RAJA::omp_persistent_exec>(
+          RAJA::RangeSegment(0, n),
+          [=](RAJA::Index_type i) { ptr[i] += 1.0; });
+      RAJA::forall<RAJA::omp_persistent_exec>(
+          RAJA::RangeSegment(0, n),
+          [=](RAJA::Index_type i) { ptr[n - 1 - i] *= 2.0; });
+    }
+  });
+
+  // x -> 2 * (x + 1) a hundred times from 0
+  double expected = 0.0;
+  for (int step = 0; step < 100; ++step) {
+    expected = 2.0 * (expected + 1.0);
+  }
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    ASSERT_EQ(expected, data[i]);
+  }
+}
+
+TEST(PersistentTest, team)
+{
+  const RAJA::Index_type n = 1003;
+  std::vector<int> first(n, -1);
+  std::vector<int> second(n, -1);
+  int* f = first.data();
+  int* s = second.data();
+  int team_size = 0;
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    team_size = omp_get_num_threads();
+    RAJA::forall<RAJA::omp_persistent_exec>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { f[i] = omp_get_thread_num(); });
+    RAJA::forall<RAJA::omp_persistent_exec>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { s[i] = omp_get_thread_num(); });
+  });
+
+  ASSERT_EQ(omp_get_max_threads(), team_size);
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(0, first[0]);
+  ASSERT_EQ(team_size - 1, first[n - 1]);
+
+  // same partition as omp_parallel_for_static_block
+  std::vector<int> block(n, -1);
+  int* b = block.data();
+  RAJA::forall<RAJA::omp_parallel_for_static_block>(
+      RAJA::RangeSegment(0, n),
+      [=](RAJA::Index_type i) { b[i] = omp_get_thread_num(); });
+  ASSERT_EQ(block, first);
+}
+
+TEST(PersistentTest, reduce)
+{
+  const RAJA::Index_type n = 1000;
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    for (int k = 0; k < 10; ++k) {
+      RAJA::ReduceSum<RAJA::omp_reduce, RAJA::Index_type> sum(0);
+      RAJA::ReduceMax<RAJA::omp_reduce_ordered, RAJA::Index_type> max(-1);
+      RAJA::forall<RAJA::omp_persistent_exec>(
+          RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+            sum += i;
+            max.max(i + k);
+          });
+      ASSERT_EQ(n * (n - 1) / 2, sum.get());
+      ASSERT_EQ(n - 1 + k, max.get());
+    }
+  });
+}
+
+TEST(PersistentTest, kernel)
+{
+  const RAJA::Index_type n = 64;
+  std::vector<int> data(n * n, 0);
+  int* ptr = data.data();
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1,
+                           RAJA::omp_persistent_exec,
+                           RAJA::statement::For<0,
+                                                RAJA::loop_exec,
+                                                RAJA::statement::Lambda<0>>>>;
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    for (int k = 0; k < 3; ++k) {
+      RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                         RAJA::RangeSegment(0, n)),
+                        [=](RAJA::Index_type i, RAJA::Index_type j) {
+                          ptr[i + n * j] += 1;
+                        });
+    }
+  });
+
+  for (RAJA::Index_type i = 0; i < n * n; ++i) {
+    ASSERT_EQ(3, data[i]);
+  }
+}
+
+TEST(PersistentTest, nested_and_outside)
+{
+  const RAJA::Index_type n = 100;
+  std::vector<int> data(n * n, 0);
+  int* ptr = data.data();
+
+  // outside a region the policy forks its own team
+  RAJA::forall<RAJA::omp_persistent_exec>(RAJA::RangeSegment(0, n * n),
+                                          [=](RAJA::Index_type i) {
+                                            ptr[i] = 1;
+                                          });
+
+  RAJA::region<RAJA::omp_persistent_region>([&]() {
+    RAJA::forall<RAJA::omp_persistent_exec>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+          // nested launches run on the calling team thread
+          RAJA::forall<RAJA::omp_persistent_exec>(
+              RAJA::RangeSegment(0, n),
+              [=](RAJA::Index_type j) { ptr[i * n + j] += 1; });
+        });
+  });
+
+  for (RAJA::Index_type i = 0; i < n * n; ++i) {
+    ASSERT_EQ(2, data[i]);
+  }
+}
+
+#endif
@@ -0,0 +1,217 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for reproducible OpenMP reductions
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <omp.h>
+
+namespace
+{
+
+//! Values spanning many orders of magnitude, so that summation order shows.
+std::vector<double> makeData(int n)
+{
+  std::vector<double> data(n);
+  srand(4242);
+  for (int i = 0; i < n; ++i) {
+    const double mag = std::pow(10.0, rand() % 16 - 8);
+    data[i] = (rand() % 2 ? mag : -mag) * (1.0 + (rand() % 1000) / 999.0);
+  }
+  return data;
+}
+
+bool bitwiseEqual(double a, double b)
+{
+  return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+template <typename ExecPolicy>
+double reproducibleSum(const std::vector<double>& data, int num_threads)
+{
+  omp_set_num_threads(num_threads);
+  const double* a = data.data();
+  RAJA::ReduceSum<RAJA::omp_reduce_reproducible, double> sum(0.0);
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, data.size()),
+                           [=](RAJA::Index_type i) { sum += a[i]; });
+  return sum.get();
+}
+
+}  // end anonymous namespace
+
+TEST(ReduceReproducibleTest, independent_of_thread_count)
+{
+  using ExecPolicy = RAJA::omp_parallel_for_reproducible<512>;
+  const int max_threads = omp_get_max_threads();
+
+  for (int n : {1, 511, 512, 100000, 250007}) {
+    std::vector<double> data = makeData(n);
+    const double reference = reproducibleSum<ExecPolicy>(data, 1);
+    for (int nt : {2, 3, 4, 7, 16}) {
+      ASSERT_TRUE(bitwiseEqual(reference, reproducibleSum<ExecPolicy>(data, nt)))
+          << "n = " << n << ", threads = " << nt;
+    }
+
+    double serial = 0.0;
+    for (double v : data) {
+      serial += v;
+    }
+    ASSERT_NEAR(serial, reference, 1e-6 * std::abs(serial) + 1e-12);
+  }
+
+  omp_set_num_threads(max_threads);
+}
+
+TEST(ReduceReproducibleTest, repeated_launches_and_ops)
+{
+  const int max_threads = omp_get_max_threads();
+  const int n = 50000;
+  std::vector<double> data = makeData(n);
+  const double* a = data.data();
+
+  using ExecPolicy = RAJA::omp_parallel_for_reproducible<1000>;
+  using ReducePolicy = RAJA::omp_reduce_reproducible;
+
+  double ref_sum = 0.0;
+  double ref_half = 0.0;
+  double ref_min = 0.0;
+  RAJA::Index_type ref_loc = -1;
+
+  for (int nt : {1, 2, 5, 8}) {
+    omp_set_num_threads(nt);
+
+    RAJA::ReduceSum<ReducePolicy, double> sum(1.0);
+    RAJA::ReduceMinLoc<ReducePolicy, double> minloc(1e30, -1);
+    RAJA::ReduceTuple<ReducePolicy,
+                      RAJA::reduce::sum<double>,
+                      RAJA::reduce::max<double>>
+        vals(0.0, -1e30);
+
+    // launches of different lengths fold into the same blocks in order
+    for (int len : {n, n / 3, n}) {
+      RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, len),
+                               [=](RAJA::Index_type i) {
+                                 sum += a[i];
+                                 minloc.minloc(a[i], i);
+                                 vals.combine<0>(a[i] * 0.5);
+                                 vals.combine<1>(a[i]);
+                               });
+    }
+
+    if (nt == 1) {
+      ref_sum = sum.get();
+      ref_half = vals.get<0>();
+      ref_min = minloc.get();
+      ref_loc = minloc.getLoc();
+    }
+    ASSERT_TRUE(bitwiseEqual(ref_sum, sum.get()));
+    ASSERT_TRUE(bitwiseEqual(ref_min, minloc.get()));
+    ASSERT_EQ(ref_loc, minloc.getLoc());
+    ASSERT_TRUE(bitwiseEqual(ref_half, vals.get<0>()));
+    ASSERT_EQ(*std::max_element(data.begin(), data.end()), vals.get<1>());
+
+    // combine outside a loop and reset
+    sum += 1.0;
+    sum.reset(0.0);
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, 10),
+                             [=](RAJA::Index_type) { sum += 1.0; });
+    ASSERT_EQ(10.0, sum.get());
+  }
+
+  omp_set_num_threads(max_threads);
+}
+
+TEST(ReduceReproducibleTest, other_policies)
+{
+  const int n = 10000;
+  std::vector<int> data(n);
+  for (int i = 0; i < n; ++i) {
+    data[i] = i % 17;
+  }
+  const int* a = data.data();
+
+  // integer sums are exact with any loop policy
+  RAJA::ReduceSum<RAJA::omp_reduce_reproducible, long> sum(0);
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, n),
+                                            [=](RAJA::Index_type i) {
+                                              sum += a[i];
+                                            });
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, n),
+                               [=](RAJA::Index_type i) { sum += a[i]; });
+
+  using KernelPol = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      RAJA::omp_parallel_for_reproducible<64>,
+      RAJA::statement::For<1, RAJA::seq_exec, RAJA::statement::Lambda<0>>>>;
+  RAJA::kernel<KernelPol>(RAJA::make_tuple(RAJA::RangeSegment(0, 100),
+                                           RAJA::RangeSegment(0, 100)),
+                          [=](RAJA::Index_type i, RAJA::Index_type j) {
+                            sum += a[i * 100 + j];
+                          });
+
+  long expected = 0;
+  for (int i = 0; i < n; ++i) {
+    expected += data[i];
+  }
+  ASSERT_EQ(3 * expected, sum.get());
+}
+
+TEST(ReduceReproducibleTest, graph_replay)
+{
+  using ExecPolicy = RAJA::omp_parallel_for_reproducible<512>;
+  const int max_threads = omp_get_max_threads();
+  const int n = 100000;
+  std::vector<double> data = makeData(n);
+  const double* a = data.data();
+  const double reference = reproducibleSum<ExecPolicy>(data, 1);
+
+  for (int nt : {1, 3, 7}) {
+    omp_set_num_threads(nt);
+
+    RAJA::ReduceSum<RAJA::omp_reduce_reproducible, double> sum(0.0);
+    RAJA::LoopGraph graph;
+    graph.forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { sum += a[i]; })
+        .reads(a);
+
+    // reproducible launches keep their own blocks, so they run whole
+    ASSERT_EQ(0, graph.getNode(0).length());
+
+    graph.replay<RAJA::omp_persistent_exec>();
+    ASSERT_TRUE(bitwiseEqual(reference, sum.get())) << "threads = " << nt;
+  }
+
+  omp_set_num_threads(max_threads);
+}
+
+TEST(ReduceReproducibleTest, ordered_padding)
+{
+  RAJA::ReduceSum<RAJA::omp_reduce_ordered, int> sum(0);
+  RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, 1000),
+                                            [=](RAJA::Index_type i) {
+                                              sum += static_cast<int>(i);
+                                            });
+  ASSERT_EQ(999 * 1000 / 2, sum.get());
+}
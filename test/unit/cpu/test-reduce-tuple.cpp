@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for tuple reducers
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+
+using namespace RAJA;
+
+template <typename T>
+class ReduceTupleTest : public ::testing::Test
+{
+};
+
+using ReduceTupleTypes = ::testing::Types<
+    std::tuple<seq_exec, seq_reduce>,
+    std::tuple<loop_exec, loop_reduce>
+#if defined(RAJA_ENABLE_OPENMP)
+    ,
+    std::tuple<omp_parallel_for_exec, omp_reduce>,
+    std::tuple<omp_parallel_for_exec, omp_reduce_ordered>,
+    std::tuple<omp_parallel_for_exec, omp_reduce_slots>
+#endif
+#if defined(RAJA_ENABLE_TBB)
+    ,
+    std::tuple<tbb_for_exec, tbb_reduce>
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+    ,
+    std::tuple<thread_pool_exec, thread_pool_reduce>
+#endif
+    >;
+
+TYPED_TEST_CASE(ReduceTupleTest, ReduceTupleTypes);
+
+TYPED_TEST(ReduceTupleTest, mixed_ops)
+{
+  using ExecPolicy = typename std::tuple_element<0, TypeParam>::type;
+  using ReducePolicy = typename std::tuple_element<1, TypeParam>::type;
+
+  const int n = 10000;
+  std::vector<double> a(n);
+  std::vector<int> b(n);
+  srand(7);
+  for (int i = 0; i < n; ++i) {
+    a[i] = (rand() % 20001) - 10000.0;
+    b[i] = rand() % 1000;
+  }
+  a[n / 3] = -20000.0;
+  a[n / 2] = 20000.0;
+  const double* pa = a.data();
+  const int* pb = b.data();
+
+  ReduceTuple<ReducePolicy,
+              reduce::sum<double>,
+              reduce::min<double>,
+              reduce::min<int>,
+              reduce::maxloc<double>,
+              reduce::minloc<double>>
+      vals(1.0, 0.0, 500, -1e9, 1e9);
+
+  forall<ExecPolicy>(RangeSegment(0, n), [=](Index_type i) {
+    vals.template combine<0>(pa[i]);
+    vals.template combine<1>(pa[i]);
+    vals.template combine<2>(pb[i]);
+    vals.template combine<3>(pa[i], i);
+    vals.template combine<4>(pa[i], i);
+  });
+
+  double sum = 1.0;
+  int min_b = 500;
+  for (int i = 0; i < n; ++i) {
+    sum += a[i];
+    min_b = std::min(min_b, b[i]);
+  }
+
+  ASSERT_DOUBLE_EQ(sum, vals.template get<0>());
+  ASSERT_EQ(-20000.0, vals.template get<1>());
+  ASSERT_EQ(min_b, vals.template get<2>());
+  ASSERT_EQ(20000.0, static_cast<double>(vals.template get<3>()));
+  ASSERT_EQ(n / 2, vals.template getLoc<3>());
+  ASSERT_EQ(n / 3, vals.template getLoc<4>());
+
+  // one get() returns every value
+  auto all = vals.get();
+  ASSERT_DOUBLE_EQ(sum, camp::get<0>(all.values));
+  ASSERT_EQ(min_b, camp::get<2>(all.values));
+
+  // reset and reuse; default initial values are the identities
+  vals.reset(0.0, 1e9, 1 << 30, -1e9, 1e9);
+  forall<ExecPolicy>(RangeSegment(0, 10), [=](Index_type i) {
+    vals.template combine<0>(1.0);
+    vals.template combine<1>(pa[i]);
+  });
+  ASSERT_EQ(10.0, vals.template get<0>());
+
+  ReduceTuple<ReducePolicy, reduce::max<int>, reduce::sum<long>> defaults;
+  forall<ExecPolicy>(RangeSegment(0, n), [=](Index_type i) {
+    defaults.template combine<0>(pb[i]);
+    defaults.template combine<1>(1L);
+  });
+  ASSERT_EQ(n, defaults.template get<1>());
+  ASSERT_EQ(*std::max_element(b.begin(), b.end()), defaults.template get<0>());
+}
+
+TEST(ReduceTupleTest, value_tuple)
+{
+  using op = reduce::detail::TupleReduce<reduce::sum<int>,
+                                         reduce::maxloc<double>>;
+  op::value_type x(1, reduce::detail::ValueLoc<double, false>(2.0, 4));
+  op::value_type y(2, reduce::detail::ValueLoc<double, false>(3.0, 7));
+
+  ASSERT_TRUE(x == x);
+  ASSERT_TRUE(x != y);
+  ASSERT_TRUE(op::identity() == op::value_type());
+
+  op{}(x, y);
+  ASSERT_EQ(3, camp::get<0>(x.values));
+  ASSERT_EQ(7, camp::get<1>(x.values).getLoc());
+
+  op::value_type z = op::operator_type{}(y, op::identity());
+  ASSERT_TRUE(z == y);
+}
@@ -44,10 +44,15 @@ using TestingTypes = ::testing::
   
   ,std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>, omp_reduce>
   ,std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>,omp_reduce_ordered>              
+  ,std::tuple<ExecPolicy<omp_parallel_for_segit, loop_exec>, omp_reduce_slots>
 #endif
 #if defined (RAJA_ENABLE_TBB)
           ,std::tuple<ExecPolicy<seq_segit, tbb_for_exec>, tbb_reduce>
            ,std::tuple<ExecPolicy<tbb_for_exec, loop_exec>, tbb_reduce>
+#endif
+#if defined (RAJA_ENABLE_THREADS)
+          ,std::tuple<ExecPolicy<seq_segit, thread_pool_exec>, thread_pool_reduce>
+          ,std::tuple<ExecPolicy<thread_pool_segit, loop_exec>, thread_pool_reduce>
 #endif
         >;
 
@@ -99,7 +99,16 @@ using constructor_types =
                      std::tuple<RAJA::omp_reduce, double>,
                      std::tuple<RAJA::omp_reduce_ordered, int>,
                      std::tuple<RAJA::omp_reduce_ordered, float>,
-                     std::tuple<RAJA::omp_reduce_ordered, double>
+                     std::tuple<RAJA::omp_reduce_ordered, double>,
+                     std::tuple<RAJA::omp_reduce_slots, int>,
+                     std::tuple<RAJA::omp_reduce_slots, float>,
+                     std::tuple<RAJA::omp_reduce_slots, double>
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+                     ,
+                     std::tuple<RAJA::thread_pool_reduce, int>,
+                     std::tuple<RAJA::thread_pool_reduce, float>,
+                     std::tuple<RAJA::thread_pool_reduce, double>
 #endif
                      >;
 
@@ -368,11 +377,17 @@ using types = ::testing::Types<
 #if defined(RAJA_ENABLE_OPENMP)
     ,
     std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>,
-    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered>
+    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered>,
+    std::tuple<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_slots>
 #endif
 #if defined(RAJA_ENABLE_TBB)
     ,
     std::tuple<RAJA::tbb_for_exec, RAJA::tbb_reduce>
+#endif
+#if defined(RAJA_ENABLE_THREADS)
+    ,
+    std::tuple<RAJA::thread_pool_exec, RAJA::thread_pool_reduce>,
+    std::tuple<RAJA::thread_pool_static<>, RAJA::thread_pool_reduce>
 #endif
     >;
 
@@ -488,7 +503,13 @@ using nested_types = ::testing::Types<
                                           RAJA::omp_collapse_nowait_exec,
                                           RAJA::omp_collapse_nowait_exec>,
                            RAJA::OMP_Parallel<>>,
-        RAJA::omp_reduce_ordered>>;
+        RAJA::omp_reduce_ordered>,
+    std::tuple<
+        RAJA::NestedPolicy<RAJA::ExecList<RAJA::omp_collapse_nowait_exec,
+                                          RAJA::omp_collapse_nowait_exec,
+                                          RAJA::omp_collapse_nowait_exec>,
+                           RAJA::OMP_Parallel<>>,
+        RAJA::omp_reduce_slots>>;
 #else
 using nested_types = ::testing::Types<std::tuple<
     RAJA::NestedPolicy<
@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA CPU sort operations.
+///
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+
+#include "RAJA_gtest.hpp"
+#include "type_helper.hpp"
+
+const int N = 100000;
+
+// Unit Test Space Exploration
+
+using ExecTypes = std::tuple<
+    RAJA::seq_exec,
+    RAJA::loop_exec
+#if defined (RAJA_ENABLE_OPENMP)
+    ,RAJA::omp_parallel_for_exec
+#endif
+#if defined (RAJA_ENABLE_TBB)
+    ,RAJA::tbb_for_exec
+#endif
+>;
+
+using CompareTypes = std::tuple<RAJA::operators::less<int>,
+                                RAJA::operators::less<unsigned>,
+                                RAJA::operators::less<long>,
+                                RAJA::operators::less<double>,
+                                RAJA::operators::greater<int>,
+                                RAJA::operators::greater<double>>;
+
+using CrossTypes =
+    ForTesting<typename types::product<ExecTypes, CompareTypes>::type>;
+
+template <typename Tuple>
+struct Info {
+  using exec = typename std::tuple_element<0, Tuple>::type;
+  using compare = typename std::tuple_element<1, Tuple>::type;
+  using data_type = typename compare::first_argument_type;
+};
+
+template <typename Tuple>
+struct Sort : public ::testing::Test {
+
+  using data_type = typename Info<Tuple>::data_type;
+  static std::vector<data_type> data;
+
+  // Few distinct keys, including negative ones for the signed types, so
+  // that stability is observable and the radix sort sees every byte.
+  static void SetUpTestCase()
+  {
+    std::mt19937 gen{std::random_device{}()};
+    std::uniform_int_distribution<int> dist(-500, 500);
+    data.resize(N);
+    for (auto& v : data) {
+      const int k = dist(gen);
+      v = static_cast<data_type>(std::is_signed<data_type>::value ? k : k + 500)
+          * static_cast<data_type>(1 << 20);
+    }
+  }
+
+  static void TearDownTestCase() { data.clear(); }
+};
+
+template <typename Tuple>
+std::vector<typename Info<Tuple>::data_type> Sort<Tuple>::data;
+
+TYPED_TEST_CASE_P(Sort);
+
+TYPED_TEST_P(Sort, sort)
+{
+  using Compare = typename Info<TypeParam>::compare;
+
+  auto actual = Sort<TypeParam>::data;
+  auto expected = Sort<TypeParam>::data;
+
+  RAJA::sort(typename Info<TypeParam>::exec(),
+             actual.begin(),
+             actual.end(),
+             Compare{});
+  std::sort(expected.begin(), expected.end(), Compare{});
+
+  ASSERT_EQ(expected, actual);
+}
+
+TYPED_TEST_P(Sort, sort_container)
+{
+  using Compare = typename Info<TypeParam>::compare;
+
+  auto actual = Sort<TypeParam>::data;
+  auto expected = Sort<TypeParam>::data;
+
+  RAJA::stable_sort<typename Info<TypeParam>::exec>(actual, Compare{});
+  std::stable_sort(expected.begin(), expected.end(), Compare{});
+
+  ASSERT_EQ(expected, actual);
+}
+
+TYPED_TEST_P(Sort, sort_pairs)
+{
+  using Compare = typename Info<TypeParam>::compare;
+
+  auto keys = Sort<TypeParam>::data;
+  std::vector<int> vals(N);
+  std::iota(vals.begin(), vals.end(), 0);
+
+  RAJA::sort_pairs(typename Info<TypeParam>::exec(),
+                   keys.begin(),
+                   keys.end(),
+                   vals.begin(),
+                   Compare{});
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(Sort<TypeParam>::data[vals[i]], keys[i]);
+  }
+  for (int i = 1; i < N; ++i) {
+    ASSERT_FALSE(Compare{}(keys[i], keys[i - 1]));
+    if (!Compare{}(keys[i - 1], keys[i])) {
+      ASSERT_LT(vals[i - 1], vals[i]);
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_CASE_P(Sort, sort, sort_container, sort_pairs);
+
+INSTANTIATE_TYPED_TEST_CASE_P(Sort, Sort, CrossTypes);
+
+TEST(Sort, short_and_empty)
+{
+  std::vector<int> empty;
+  RAJA::sort<RAJA::seq_exec>(empty.begin(), empty.end());
+
+  std::vector<long> keys{3, -1, 2, -1};
+  std::vector<char> vals{'a', 'b', 'c', 'd'};
+  RAJA::sort_pairs<RAJA::seq_exec>(keys, vals);
+  ASSERT_EQ((std::vector<long>{-1, -1, 2, 3}), keys);
+  ASSERT_EQ((std::vector<char>{'b', 'd', 'c', 'a'}), vals);
+}
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-18, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-689114
+//
+// All rights reserved.
+//
+// This file is part of RAJA.
+//
+// For details about use and distribution, please read RAJA/LICENSE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the std::thread pool back-end
+///
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(RAJA_ENABLE_THREADS)
+
+TEST(ThreadPoolTest, reduce_from_other_threads)
+{
+  // reducer copies destroyed on threads outside the pool must not race
+  // with the launching thread, which also uses slot 0
+  const RAJA::Index_type n = 10000;
+  const int num_outside = 4;
+  const int repeat = 20;
+
+  RAJA::ReduceSum<RAJA::thread_pool_reduce, RAJA::Index_type> sum(0);
+
+  std::vector<std::thread> outside;
+  for (int t = 0; t < num_outside; ++t) {
+    outside.emplace_back([=]() {
+      for (int k = 0; k < repeat; ++k) {
+        auto copy = sum;
+        for (RAJA::Index_type i = 0; i < n; ++i) {
+          copy += 1;
+        }
+      }
+    });
+  }
+  for (int k = 0; k < repeat; ++k) {
+    RAJA::forall<RAJA::thread_pool_static<>>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type) { sum += 1; });
+  }
+  for (auto& thread : outside) {
+    thread.join();
+  }
+
+  ASSERT_EQ((num_outside + 1) * repeat * n, sum.get());
+}
+
+template <typename Policy>
+void checkThrow()
+{
+  const RAJA::Index_type n = 10000;
+  std::vector<int> data(n, 0);
+  int* ptr = data.data();
+
+  // throw on the calling thread (first iterations) and on a worker (last)
+  for (RAJA::Index_type bad : {RAJA::Index_type(0), n - 1}) {
+    ASSERT_THROW(RAJA::forall<Policy>(RAJA::RangeSegment(0, n),
+                                      [=](RAJA::Index_type i) {
+                                        if (i == bad) {
+                                          throw std::runtime_error("bad");
+                                        }
+                                        ptr[i] = 1;
+                                      }),
+                 std::runtime_error);
+  }
+
+  // the pool is usable after a throwing launch
+  RAJA::ReduceSum<RAJA::thread_pool_reduce, RAJA::Index_type> sum(0);
+  RAJA::forall<Policy>(RAJA::RangeSegment(0, n),
+                       [=](RAJA::Index_type i) { sum += i; });
+  ASSERT_EQ(n * (n - 1) / 2, sum.get());
+}
+
+TEST(ThreadPoolTest, throw_static) { checkThrow<RAJA::thread_pool_static<>>(); }
+
+TEST(ThreadPoolTest, throw_dynamic)
+{
+  checkThrow<RAJA::thread_pool_dynamic<16>>();
+}
+
+#endif
@@ -334,6 +334,57 @@ void testAtomicLogicalPol()
 }
 
 
+template <typename ExecPolicy, typename AtomicPolicy, typename T>
+void testReplicatedAtomicView()
+{
+  using replicated = RAJA::atomic::replicated_atomic<4, AtomicPolicy>;
+  const RAJA::Index_type N = 100000;
+  const RAJA::Index_type M = 10;
+
+  T *dest = new T[M];
+  for (RAJA::Index_type m = 0; m < M; ++m) {
+    dest[m] = (T)1;
+  }
+
+  // every update hits one of a few elements
+  RAJA::View<T, RAJA::Layout<1>> dest_view(dest, M);
+  auto sum_view = RAJA::make_atomic_view<replicated>(dest_view);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N), [=](RAJA::Index_type i) {
+    sum_view(i % M) += (T)3;
+    sum_view(i % M) -= (T)1;
+    sum_view((i + 1) % M)++;
+  });
+
+  // updates stay in the replicas until flushed
+  EXPECT_EQ((T)1, dest[0]);
+
+  sum_view.template flush<ExecPolicy>();
+  for (RAJA::Index_type m = 0; m < M; ++m) {
+    EXPECT_EQ((T)(1 + 3 * N / M), dest[m]);
+  }
+
+  // replicas are cleared by flush and can be reused
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+                           [=](RAJA::Index_type i) { sum_view(i % M)--; });
+  sum_view.template flush<ExecPolicy>();
+  for (RAJA::Index_type m = 0; m < M; ++m) {
+    EXPECT_EQ((T)(1 + 2 * N / M), dest[m]);
+  }
+
+  delete[] dest;
+}
+
+
+template <typename ExecPolicy, typename AtomicPolicy>
+void testReplicatedAtomicViewPol()
+{
+  testReplicatedAtomicView<ExecPolicy, AtomicPolicy, int>();
+  testReplicatedAtomicView<ExecPolicy, AtomicPolicy, unsigned long long>();
+  testReplicatedAtomicView<ExecPolicy, AtomicPolicy, double>();
+}
+
+
 #if defined(RAJA_ENABLE_OPENMP)
 
 TEST(Atomic, basic_OpenMP_AtomicFunction)
@@ -341,6 +392,9 @@ TEST(Atomic, basic_OpenMP_AtomicFunction)
   testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::atomic::auto_atomic>();
   testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::atomic::omp_atomic>();
   testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicFunctionPol<RAJA::omp_for_exec, RAJA::atomic::seq_cst_atomic>();
 }
 
 
@@ -349,6 +403,9 @@ TEST(Atomic, basic_OpenMP_AtomicRef)
   testAtomicRefPol<RAJA::omp_for_exec, RAJA::atomic::auto_atomic>();
   testAtomicRefPol<RAJA::omp_for_exec, RAJA::atomic::omp_atomic>();
   testAtomicRefPol<RAJA::omp_for_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicRefPol<RAJA::omp_for_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicRefPol<RAJA::omp_for_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicRefPol<RAJA::omp_for_exec, RAJA::atomic::seq_cst_atomic>();
 }
 
 
@@ -357,6 +414,47 @@ TEST(Atomic, basic_OpenMP_AtomicView)
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::auto_atomic>();
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::omp_atomic>();
   testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicViewPol<RAJA::omp_for_exec, RAJA::atomic::seq_cst_atomic>();
+}
+
+
+TEST(Atomic, OpenMP_ReleaseAcquireFlag)
+{
+  const int N = 1000;
+  int *data = new int[N];
+  int ready = 0;
+  int sum = 0;
+
+#pragma omp parallel num_threads(2)
+  {
+    if (omp_get_thread_num() == 0) {
+      for (int i = 0; i < N; ++i) {
+        data[i] = i;
+      }
+      RAJA::atomic::atomicStore<RAJA::atomic::release_atomic>(&ready, 1);
+    }
+    if (omp_get_thread_num() == omp_get_num_threads() - 1) {
+      while (!RAJA::atomic::atomicLoad<RAJA::atomic::acquire_atomic>(&ready)) {
+      }
+      for (int i = 0; i < N; ++i) {
+        sum += data[i];
+      }
+    }
+  }
+
+  EXPECT_EQ(N * (N - 1) / 2, sum);
+  delete[] data;
+}
+
+
+TEST(Atomic, basic_OpenMP_ReplicatedAtomicView)
+{
+  testReplicatedAtomicViewPol<RAJA::omp_parallel_for_exec,
+                              RAJA::atomic::auto_atomic>();
+  testReplicatedAtomicViewPol<RAJA::omp_parallel_for_exec,
+                              RAJA::atomic::omp_atomic>();
 }
 
 
@@ -365,6 +463,9 @@ TEST(Atomic, basic_OpenMP_Logical)
   testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::atomic::auto_atomic>();
   testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::atomic::omp_atomic>();
   testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicLogicalPol<RAJA::omp_for_exec, RAJA::atomic::seq_cst_atomic>();
 }
 
 #endif
@@ -404,6 +505,9 @@ TEST(Atomic, basic_seq_AtomicFunction)
   testAtomicFunctionPol<RAJA::seq_exec, RAJA::atomic::auto_atomic>();
   testAtomicFunctionPol<RAJA::seq_exec, RAJA::atomic::seq_atomic>();
   testAtomicFunctionPol<RAJA::seq_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicFunctionPol<RAJA::seq_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicFunctionPol<RAJA::seq_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicFunctionPol<RAJA::seq_exec, RAJA::atomic::seq_cst_atomic>();
 }
 
 TEST(Atomic, basic_seq_AtomicRef)
@@ -411,6 +515,9 @@ TEST(Atomic, basic_seq_AtomicRef)
   testAtomicRefPol<RAJA::seq_exec, RAJA::atomic::auto_atomic>();
   testAtomicRefPol<RAJA::seq_exec, RAJA::atomic::seq_atomic>();
   testAtomicRefPol<RAJA::seq_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicRefPol<RAJA::seq_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicRefPol<RAJA::seq_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicRefPol<RAJA::seq_exec, RAJA::atomic::seq_cst_atomic>();
 }
 
 TEST(Atomic, basic_seq_AtomicView)
@@ -418,6 +525,9 @@ TEST(Atomic, basic_seq_AtomicView)
   testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::auto_atomic>();
   testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::seq_atomic>();
   testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicViewPol<RAJA::seq_exec, RAJA::atomic::seq_cst_atomic>();
 }
 
 
@@ -426,4 +536,39 @@ TEST(Atomic, basic_seq_Logical)
   testAtomicLogicalPol<RAJA::seq_exec, RAJA::atomic::auto_atomic>();
   testAtomicLogicalPol<RAJA::seq_exec, RAJA::atomic::seq_atomic>();
   testAtomicLogicalPol<RAJA::seq_exec, RAJA::atomic::builtin_atomic>();
+  testAtomicLogicalPol<RAJA::seq_exec, RAJA::atomic::relaxed_atomic>();
+  testAtomicLogicalPol<RAJA::seq_exec, RAJA::atomic::acq_rel_atomic>();
+  testAtomicLogicalPol<RAJA::seq_exec, RAJA::atomic::seq_cst_atomic>();
+}
+
+TEST(Atomic, basic_seq_ReplicatedAtomicView)
+{
+  testReplicatedAtomicViewPol<RAJA::seq_exec, RAJA::atomic::auto_atomic>();
+  testReplicatedAtomicViewPol<RAJA::seq_exec, RAJA::atomic::seq_atomic>();
+}
+
+
+TEST(Atomic, ReplicatedAtomicView_offset_layout)
+{
+  using replicated =
+      RAJA::atomic::replicated_atomic<2, RAJA::atomic::auto_atomic>;
+  double data[3 * 4] = {0.0};
+
+  // 2D element-to-node accumulation, nodes indexed from (1, 1)
+  RAJA::View<double, RAJA::OffsetLayout<2>> nodes(
+      data, RAJA::make_offset_layout<2>({{1, 1}}, {{3, 4}}));
+  auto node_view = RAJA::make_atomic_view<replicated>(nodes);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                               [=](RAJA::Index_type e) {
+                                 node_view(1 + e % 3, 1 + e % 4) += 0.5;
+                               });
+  node_view.flush();
+
+  double total = 0.0;
+  for (double v : data) {
+    total += v;
+  }
+  EXPECT_EQ(50.0, total);
+  EXPECT_EQ(0.5 * 9, nodes(1, 1));
 }
@@ -21,6 +21,7 @@
 #include <iostream>
 #include <cmath>
 #include <cassert>
+#include <vector>
 
 
 using namespace RAJA;
@@ -53,3 +54,182 @@ TEST(SIMD, align){
     }
 
 }
+
+TEST(SIMD, register_ops){
+
+  using reg_t = RAJA::simd_register<double, 4>;
+
+  double a[4] = {1.0, 2.0, 3.0, 4.0};
+  double b[4] = {0.5, 0.5, 0.5, 0.5};
+
+  reg_t x = reg_t::load(a);
+  reg_t y = reg_t::load(b);
+  reg_t z = 2.0 * x + y / 0.5 - 1.0;
+
+  for(int i=0; i<4; ++i)
+    {
+      ASSERT_DOUBLE_EQ(z[i], 2.0 * a[i]);
+    }
+
+  ASSERT_DOUBLE_EQ(x.sum(), 10.0);
+  ASSERT_DOUBLE_EQ(x.sum(3), 6.0);
+  ASSERT_DOUBLE_EQ(x.min(), 1.0);
+  ASSERT_DOUBLE_EQ(x.max(), 4.0);
+  ASSERT_DOUBLE_EQ(x.max(2), 2.0);
+  ASSERT_DOUBLE_EQ((-x)[3], -4.0);
+
+  // masked load leaves inactive lanes zero, masked store leaves memory alone
+  reg_t p = reg_t::load(a, 2);
+  ASSERT_DOUBLE_EQ(p[1], 2.0);
+  ASSERT_DOUBLE_EQ(p[2], 0.0);
+
+  double out[4] = {-1.0, -1.0, -1.0, -1.0};
+  x.store(out, 3);
+  ASSERT_DOUBLE_EQ(out[2], 3.0);
+  ASSERT_DOUBLE_EQ(out[3], -1.0);
+
+  RAJA::simd_register<int, 4> idx;
+  idx[0] = 3; idx[1] = 0; idx[2] = 2; idx[3] = 1;
+  reg_t g = reg_t::gather(a, idx);
+  ASSERT_DOUBLE_EQ(g[0], 4.0);
+  ASSERT_DOUBLE_EQ(g[3], 2.0);
+
+  double s[4] = {};
+  g.scatter(s, idx);
+  for(int i=0; i<4; ++i)
+    {
+      ASSERT_DOUBLE_EQ(s[i], a[i]);
+    }
+}
+
+TEST(SIMD, vector_exec_daxpy){
+
+  const int N = 1003;
+  using vec_idx = RAJA::simd_vector_index<RAJA::Index_type, 4>;
+
+  std::vector<double> xdata(N), ydata(N, 1.0);
+  for(int i=0; i<N; ++i)
+    {
+      xdata[i] = i;
+    }
+
+  RAJA::View<double, RAJA::Layout<1>> x(xdata.data(), N);
+  RAJA::View<double, RAJA::Layout<1>> y(ydata.data(), N);
+
+  int num_calls = 0;
+  int num_partial = 0;
+  RAJA::forall<RAJA::simd_vector_exec<4>>(RAJA::RangeSegment(0, N),
+                                          [&] (vec_idx i) {
+      y(i) += 2.0 * x(i);
+      ++num_calls;
+      num_partial += i.is_partial() ? 1 : 0;
+    });
+
+  ASSERT_EQ(num_calls, 251);
+  ASSERT_EQ(num_partial, 1);
+  for(int i=0; i<N; ++i)
+    {
+      ASSERT_DOUBLE_EQ(ydata[i], 1.0 + 2.0 * i);
+    }
+}
+
+TEST(SIMD, vector_exec_reduce){
+
+  const int N = 37;
+  std::vector<double> data(N);
+  for(int i=0; i<N; ++i)
+    {
+      data[i] = i + 1;
+    }
+  RAJA::View<const double, RAJA::Layout<1>> v(data.data(), N);
+
+  RAJA::ReduceSum<RAJA::seq_reduce, double> sum(0.0);
+  RAJA::ReduceMax<RAJA::seq_reduce, double> vmax(0.0);
+  RAJA::forall<RAJA::simd_vector_exec<8>>(
+      RAJA::RangeSegment(0, N),
+      [=] (RAJA::simd_vector_index<RAJA::Index_type, 8> i) {
+        RAJA::simd_register<double, 8> val = v(i);
+        sum += val.sum(i.size);
+        vmax.max(val.max(i.size));
+      });
+
+  ASSERT_DOUBLE_EQ(sum.get(), N * (N + 1) / 2.0);
+  ASSERT_DOUBLE_EQ(vmax.get(), double(N));
+}
+
+TEST(SIMD, vector_exec_layout){
+
+  const int Ni = 5, Nj = 11;
+  using vec_idx = RAJA::simd_vector_index<RAJA::Index_type, 4>;
+
+  using layout_t = RAJA::Layout<2, RAJA::Index_type, 1>;
+  layout_t layout(Ni, Nj);
+
+  // only a vector index in the stride one dimension is contiguous
+  static_assert(decltype(layout(0, vec_idx(0)))::contiguous, "");
+  static_assert(!decltype(layout(vec_idx(0), 0))::contiguous, "");
+  static_assert(!decltype(RAJA::Layout<2>(Ni, Nj)(0, vec_idx(0)))::contiguous,
+                "");
+
+  auto lin = layout(2, vec_idx(3, 2));
+  ASSERT_EQ(lin.value, 2 * Nj + 3);
+  ASSERT_EQ(lin.stride(), 1);
+  ASSERT_EQ(lin.size, 2u);
+  ASSERT_EQ(layout(vec_idx(1), 3).stride(), Nj);
+
+  std::vector<double> adata(Ni * Nj), bdata(Ni * Nj, 0.0);
+  for(int i=0; i<Ni; ++i)
+    {
+      for(int j=0; j<Nj; ++j)
+        {
+          adata[i * Nj + j] = j * j + i;
+        }
+    }
+  RAJA::View<double, layout_t> a(adata.data(), layout);
+  RAJA::View<double, layout_t> b(bdata.data(), layout);
+
+  // 3-point stencil along the stride one dimension
+  for(int i=0; i<Ni; ++i)
+    {
+      RAJA::forall<RAJA::simd_vector_exec<4>>(RAJA::RangeSegment(1, Nj - 1),
+                                              [=] (vec_idx j) {
+          b(i, j) = a(i, j - 1) + a(i, j + 1) - 2.0 * a(i, j);
+        });
+    }
+
+  // transpose-like strided access along the other dimension
+  std::vector<double> cdata(Ni * Nj, 0.0);
+  RAJA::View<double, layout_t> c(cdata.data(), layout);
+  for(int j=0; j<Nj; ++j)
+    {
+      RAJA::forall<RAJA::simd_vector_exec<4>>(RAJA::RangeSegment(0, Ni),
+                                              [=] (vec_idx i) {
+          c(i, j) = a(i, j);
+        });
+    }
+
+  for(int i=0; i<Ni; ++i)
+    {
+      for(int j=0; j<Nj; ++j)
+        {
+          double expect = (j == 0 || j == Nj - 1) ? 0.0 : 2.0;
+          ASSERT_DOUBLE_EQ(b(i, j), expect);
+          ASSERT_DOUBLE_EQ(c(i, j), a(i, j));
+        }
+    }
+}
+
+TEST(SIMD, vector_exec_list){
+
+  std::vector<RAJA::Index_type> idx{7, 3, 5};
+  RAJA::ListSegment list(idx.data(), idx.size());
+
+  std::vector<RAJA::Index_type> seen;
+  RAJA::forall<RAJA::simd_vector_exec<4>>(list,
+      [&] (RAJA::simd_vector_index<RAJA::Index_type, 4> i) {
+        ASSERT_EQ(i.size, 1u);
+        seen.push_back(i.value);
+      });
+
+  ASSERT_EQ(seen, idx);
+}